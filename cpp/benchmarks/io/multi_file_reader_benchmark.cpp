@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/io/cuio_benchmark_common.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/io/orc.hpp>
+#include <cudf/io/parquet.hpp>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+constexpr int64_t file_size        = 1 << 20;
+constexpr cudf::size_type num_cols = 16;
+
+namespace cudf_io = cudf::io;
+
+enum class file_format : int32_t { PARQUET, ORC };
+
+class MultiFileRead : public cudf::benchmark {
+};
+
+/**
+ * @brief Measures the time until the first row of a multi-file read is decoded.
+ *
+ * Reading a single row makes the footer fetch and parse dominate the read time, which is the
+ * overhead that grows with the number of files.
+ */
+void BM_multi_file_read_first_row(benchmark::State& state)
+{
+  auto const format    = static_cast<file_format>(state.range(0));
+  auto const num_files = state.range(1);
+
+  auto const tbl  = create_random_table({cudf::type_id::INT32, cudf::type_id::FLOAT64},
+                                       num_cols,
+                                       table_size_bytes{file_size});
+  auto const view = tbl->view();
+
+  std::vector<std::unique_ptr<cuio_source_sink_pair>> source_sinks;
+  std::vector<std::string> file_paths;
+  for (int64_t f = 0; f < num_files; ++f) {
+    source_sinks.emplace_back(std::make_unique<cuio_source_sink_pair>(io_type::FILEPATH));
+    auto& source_sink = *source_sinks.back();
+    if (format == file_format::PARQUET) {
+      cudf_io::write_parquet(
+        cudf_io::parquet_writer_options::builder(source_sink.make_sink_info(), view));
+    } else {
+      cudf_io::write_orc(cudf_io::orc_writer_options::builder(source_sink.make_sink_info(), view));
+    }
+    file_paths.push_back(source_sink.make_source_info().filepaths()[0]);
+  }
+  auto const source = cudf_io::source_info{file_paths};
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    if (format == file_format::PARQUET) {
+      cudf_io::read_parquet(cudf_io::parquet_reader_options::builder(source).num_rows(1));
+    } else {
+      cudf_io::read_orc(cudf_io::orc_reader_options::builder(source).num_rows(1));
+    }
+  }
+
+  state.counters["files_per_second"] = benchmark::Counter(
+    static_cast<double>(num_files * state.iterations()), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_DEFINE_F(MultiFileRead, first_row)
+(::benchmark::State& state) { BM_multi_file_read_first_row(state); }
+BENCHMARK_REGISTER_F(MultiFileRead, first_row)
+  ->ArgsProduct({{int32_t(file_format::PARQUET), int32_t(file_format::ORC)},
+                 {1, 16, 64, 256, 512}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
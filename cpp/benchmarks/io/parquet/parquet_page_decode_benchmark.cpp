@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/io/parquet.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+constexpr size_t data_size             = 512 << 20;
+constexpr int64_t rows_per_page        = 20000;
+constexpr int64_t pages_per_row_group  = 50;
+constexpr uint32_t delta_block_size    = 128;
+constexpr uint32_t delta_mini_blocks   = 4;
+constexpr int32_t parquet_int32        = 1;
+constexpr int32_t parquet_int64        = 2;
+constexpr int32_t parquet_plain        = 0;
+constexpr int32_t parquet_rle          = 3;
+constexpr int32_t parquet_delta_binary = 5;
+constexpr int32_t parquet_data_page    = 0;
+constexpr int32_t parquet_required     = 0;
+constexpr int32_t parquet_uncompressed = 0;
+constexpr uint8_t thrift_i32           = 5;
+constexpr uint8_t thrift_i64           = 6;
+constexpr uint8_t thrift_binary        = 8;
+constexpr uint8_t thrift_list          = 9;
+constexpr uint8_t thrift_struct        = 12;
+
+namespace cudf_io = cudf::io;
+
+class ParquetPageDecode : public cudf::benchmark {
+};
+
+/**
+ * @brief Minimal Thrift compact protocol writer for the file and page metadata
+ *
+ * The cudf writer does not produce DELTA-encoded pages, so the benchmark files are assembled by
+ * hand.
+ */
+class thrift_writer {
+ public:
+  explicit thrift_writer(std::vector<uint8_t>& out) : out_(out) {}
+
+  void varint(uint64_t v)
+  {
+    for (; v >= 0x80; v >>= 7) {
+      out_.push_back(static_cast<uint8_t>(v | 0x80));
+    }
+    out_.push_back(static_cast<uint8_t>(v));
+  }
+  void zigzag(int64_t v) { varint((static_cast<uint64_t>(v) << 1) ^ (v >> 63)); }
+
+  void field_i32(int id, int32_t v)
+  {
+    field(id, thrift_i32);
+    zigzag(v);
+  }
+  void field_i64(int id, int64_t v)
+  {
+    field(id, thrift_i64);
+    zigzag(v);
+  }
+  void field_string(int id, std::string const& v)
+  {
+    field(id, thrift_binary);
+    varint(v.size());
+    out_.insert(out_.end(), v.begin(), v.end());
+  }
+  void field_list(int id, uint8_t element_type, size_t size)
+  {
+    field(id, thrift_list);
+    if (size < 15) {
+      out_.push_back(static_cast<uint8_t>((size << 4) | element_type));
+    } else {
+      out_.push_back(0xf0 | element_type);
+      varint(size);
+    }
+  }
+  void field_struct(int id)
+  {
+    field(id, thrift_struct);
+    begin_struct();
+  }
+  // Starts a struct that is a list element
+  void begin_struct() { last_ids_.push_back(0); }
+  void end_struct()
+  {
+    out_.push_back(0);
+    last_ids_.pop_back();
+  }
+
+ private:
+  void field(int id, uint8_t type)
+  {
+    out_.push_back(static_cast<uint8_t>(((id - last_ids_.back()) << 4) | type));
+    last_ids_.back() = id;
+  }
+
+  std::vector<uint8_t>& out_;
+  std::vector<int> last_ids_{0};
+};
+
+/**
+ * @brief Appends values in the DELTA_BINARY_PACKED encoding
+ */
+void encode_delta_binary_packed(std::vector<uint8_t>& out, int64_t const* values, int64_t count)
+{
+  thrift_writer w(out);
+  auto const values_per_mini_block = delta_block_size / delta_mini_blocks;
+  w.varint(delta_block_size);
+  w.varint(delta_mini_blocks);
+  w.varint(count);
+  w.zigzag(count > 0 ? values[0] : 0);
+  std::vector<uint64_t> deltas(delta_block_size);
+  for (int64_t i = 1; i < count; i += delta_block_size) {
+    auto const num_deltas = std::min<int64_t>(delta_block_size, count - i);
+    for (int64_t k = 0; k < num_deltas; ++k) {
+      deltas[k] = static_cast<uint64_t>(values[i + k]) - static_cast<uint64_t>(values[i + k - 1]);
+    }
+    auto min_delta = static_cast<int64_t>(deltas[0]);
+    for (int64_t k = 1; k < num_deltas; ++k) {
+      min_delta = std::min(min_delta, static_cast<int64_t>(deltas[k]));
+    }
+    w.zigzag(min_delta);
+    std::fill(deltas.begin() + num_deltas, deltas.end(), static_cast<uint64_t>(min_delta));
+    for (auto& d : deltas) {
+      d -= static_cast<uint64_t>(min_delta);
+    }
+
+    auto const used_mini_blocks = (num_deltas + values_per_mini_block - 1) / values_per_mini_block;
+    std::vector<uint8_t> bit_widths(delta_mini_blocks, 0);
+    for (int64_t m = 0; m < used_mini_blocks; ++m) {
+      uint64_t mask = 0;
+      for (uint32_t k = 0; k < values_per_mini_block; ++k) {
+        mask |= deltas[m * values_per_mini_block + k];
+      }
+      while (bit_widths[m] < 64 && (mask >> bit_widths[m]) != 0) {
+        ++bit_widths[m];
+      }
+    }
+    out.insert(out.end(), bit_widths.begin(), bit_widths.end());
+    for (int64_t m = 0; m < used_mini_blocks; ++m) {
+      auto const width = bit_widths[m];
+      auto const start = out.size();
+      out.resize(start + width * values_per_mini_block / 8, 0);
+      for (uint32_t k = 0; k < values_per_mini_block; ++k) {
+        auto const d = deltas[m * values_per_mini_block + k];
+        for (uint32_t b = 0; b < width; ++b) {
+          auto const bit = static_cast<size_t>(k) * width + b;
+          if ((d >> b) & 1) { out[start + bit / 8] |= 1 << (bit % 8); }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Builds a Parquet file with a single required integer column
+ *
+ * @param values Column values
+ * @param is_int64 Whether the column is INT64 rather than INT32
+ * @param encoding Parquet encoding of the values, PLAIN or DELTA_BINARY_PACKED
+ */
+std::vector<uint8_t> make_integer_parquet(std::vector<int64_t> const& values,
+                                          bool is_int64,
+                                          int32_t encoding)
+{
+  auto const physical_type = is_int64 ? parquet_int64 : parquet_int32;
+  auto const num_rows      = static_cast<int64_t>(values.size());
+  std::vector<uint8_t> file{'P', 'A', 'R', '1'};
+
+  struct chunk_info {
+    int64_t offset;
+    int64_t size;
+    int64_t num_rows;
+  };
+  std::vector<chunk_info> chunks;
+  std::vector<uint8_t> page_data;
+  for (int64_t row = 0; row < num_rows;) {
+    chunk_info chunk{static_cast<int64_t>(file.size()), 0, 0};
+    for (int64_t p = 0; p < pages_per_row_group && row < num_rows; ++p) {
+      auto const page_rows = std::min(rows_per_page, num_rows - row);
+      page_data.clear();
+      if (encoding == parquet_delta_binary) {
+        encode_delta_binary_packed(page_data, values.data() + row, page_rows);
+      } else {
+        auto const value_size = is_int64 ? sizeof(int64_t) : sizeof(int32_t);
+        page_data.resize(page_rows * value_size);
+        for (int64_t i = 0; i < page_rows; ++i) {
+          // Little-endian host; INT32 values are truncated
+          std::memcpy(page_data.data() + i * value_size, &values[row + i], value_size);
+        }
+      }
+      thrift_writer header(file);
+      header.field_i32(1, parquet_data_page);
+      header.field_i32(2, page_data.size());
+      header.field_i32(3, page_data.size());
+      header.field_struct(5);
+      header.field_i32(1, page_rows);
+      header.field_i32(2, encoding);
+      header.field_i32(3, parquet_rle);
+      header.field_i32(4, parquet_rle);
+      header.end_struct();
+      header.end_struct();
+      file.insert(file.end(), page_data.begin(), page_data.end());
+      row += page_rows;
+      chunk.num_rows += page_rows;
+    }
+    chunk.size = file.size() - chunk.offset;
+    chunks.push_back(chunk);
+  }
+
+  auto const footer_start = file.size();
+  thrift_writer footer(file);
+  footer.field_i32(1, 1);
+  footer.field_list(2, thrift_struct, 2);
+  footer.begin_struct();
+  footer.field_string(4, "schema");
+  footer.field_i32(5, 1);
+  footer.end_struct();
+  footer.begin_struct();
+  footer.field_i32(1, physical_type);
+  footer.field_i32(3, parquet_required);
+  footer.field_string(4, "values");
+  footer.end_struct();
+  footer.field_i64(3, num_rows);
+  footer.field_list(4, thrift_struct, chunks.size());
+  for (auto const& chunk : chunks) {
+    footer.begin_struct();
+    footer.field_list(1, thrift_struct, 1);
+    footer.begin_struct();
+    footer.field_i64(2, chunk.offset);
+    footer.field_struct(3);
+    footer.field_i32(1, physical_type);
+    footer.field_list(2, thrift_i32, 2);
+    footer.zigzag(encoding);
+    footer.zigzag(parquet_rle);
+    footer.field_list(3, thrift_binary, 1);
+    footer.varint(6);
+    file.insert(file.end(), {'v', 'a', 'l', 'u', 'e', 's'});
+    footer.field_i32(4, parquet_uncompressed);
+    footer.field_i64(5, chunk.num_rows);
+    footer.field_i64(6, chunk.size);
+    footer.field_i64(7, chunk.size);
+    footer.field_i64(9, chunk.offset);
+    footer.end_struct();
+    footer.end_struct();
+    footer.field_i64(2, chunk.size);
+    footer.field_i64(3, chunk.num_rows);
+    footer.end_struct();
+  }
+  footer.end_struct();
+
+  uint32_t const footer_size = file.size() - footer_start;
+  for (int i = 0; i < 4; ++i) {
+    file.push_back(static_cast<uint8_t>(footer_size >> (8 * i)));
+  }
+  file.insert(file.end(), {'P', 'A', 'R', '1'});
+  return file;
+}
+
+/**
+ * @brief Measures the decoding of a monotonic integer column, such as sorted IDs or timestamps
+ *
+ * Compares DELTA_BINARY_PACKED with PLAIN pages; the file is read from host memory.
+ */
+void BM_parq_page_decode(benchmark::State& state)
+{
+  auto const encoding   = static_cast<int32_t>(state.range(0));
+  auto const is_int64   = state.range(1) != 0;
+  auto const max_step   = state.range(2);
+  auto const value_size = is_int64 ? sizeof(int64_t) : sizeof(int32_t);
+  auto const num_rows   = static_cast<int64_t>(data_size / value_size);
+
+  std::mt19937 engine(1234);
+  std::uniform_int_distribution<int64_t> step(0, max_step);
+  std::vector<int64_t> values(num_rows);
+  int64_t value = 1'000'000;
+  for (auto& v : values) {
+    value += step(engine);
+    v = value;
+  }
+  auto const file = make_integer_parquet(values, is_int64, encoding);
+
+  cudf_io::parquet_reader_options read_opts = cudf_io::parquet_reader_options::builder(
+    cudf_io::source_info{reinterpret_cast<char const*>(file.data()), file.size()});
+
+  for (auto _ : state) {
+    cuda_event_timer const raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::read_parquet(read_opts);
+  }
+
+  state.SetBytesProcessed(data_size * state.iterations());
+  state.counters["encoded_file_size"] = file.size();
+}
+
+BENCHMARK_DEFINE_F(ParquetPageDecode, monotonic_integers)
+(::benchmark::State& state) { BM_parq_page_decode(state); }
+BENCHMARK_REGISTER_F(ParquetPageDecode, monotonic_integers)
+  ->ArgsProduct({{parquet_plain, parquet_delta_binary}, {0, 1}, {1, 100, 1 << 20}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
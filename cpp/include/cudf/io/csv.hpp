@@ -22,6 +22,7 @@
 #include <cudf/utilities/error.hpp>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <variant>
@@ -52,6 +53,8 @@ class csv_reader_options {
 
   // Specify the compression format of the source or infer from file extension
   compression_type _compression = compression_type::AUTO;
+  // Random access index of a gzip compressed source; needed to read byte ranges of the source
+  std::optional<source_info> _compression_index;
   // Bytes to skip from the source start
   std::size_t _byte_range_offset = 0;
   // Bytes to read; always reads complete rows
@@ -130,6 +133,12 @@ class csv_reader_options {
   bool _dayfirst = false;
   // Cast timestamp columns to a specific type
   data_type _timestamp_type{type_id::EMPTY};
+  // Rows to infer column types from; 0 is all rows
+  size_type _type_inference_rows = 0;
+  // Bytes to infer column types from; 0 is all bytes
+  std::size_t _type_inference_bytes = 0;
+  // Number of evenly spaced row ranges to take the type inference sample from
+  size_type _type_inference_ranges = 1;
 
   /**
    * @brief Constructor from source info.
@@ -166,6 +175,14 @@ class csv_reader_options {
    */
   [[nodiscard]] compression_type get_compression() const { return _compression; }
 
+  /**
+   * @brief Returns the random access index of the compressed source, if any.
+   */
+  [[nodiscard]] std::optional<source_info> const& get_compression_index() const
+  {
+    return _compression_index;
+  }
+
   /**
    * @brief Returns number of bytes to skip from source start.
    */
@@ -390,6 +407,21 @@ class csv_reader_options {
    */
   data_type get_timestamp_type() const { return _timestamp_type; }
 
+  /**
+   * @brief Returns the number of rows to infer column types from; 0 is all rows.
+   */
+  [[nodiscard]] size_type get_type_inference_rows() const { return _type_inference_rows; }
+
+  /**
+   * @brief Returns the number of bytes to infer column types from; 0 is all bytes.
+   */
+  [[nodiscard]] std::size_t get_type_inference_bytes() const { return _type_inference_bytes; }
+
+  /**
+   * @brief Returns the number of evenly spaced row ranges to take the type inference sample from.
+   */
+  [[nodiscard]] size_type get_type_inference_ranges() const { return _type_inference_ranges; }
+
   /**
    * @brief Sets compression format of the source.
    *
@@ -397,6 +429,17 @@ class csv_reader_options {
    */
   void set_compression(compression_type comp) { _compression = comp; }
 
+  /**
+   * @brief Sets the random access index of the compressed source, as written by
+   * `write_gzip_index()`.
+   *
+   * Byte ranges of a compressed source refer to its uncompressed data, and can only be read with
+   * an index.
+   *
+   * @param index Source of the index.
+   */
+  void set_compression_index(source_info const& index) { _compression_index = index; }
+
   /**
    * @brief Sets number of bytes to skip from source start.
    *
@@ -721,6 +764,46 @@ class csv_reader_options {
    * @param type Dtype to which all timestamp column will be cast.
    */
   void set_timestamp_type(data_type type) { _timestamp_type = type; }
+
+  /**
+   * @brief Sets the number of rows to infer column types from.
+   *
+   * Types are inferred from a sample of the rows, and the rows outside of the sample are only
+   * checked while they are converted. Columns with values that would change the inferred type are
+   * then inferred from all rows and converted again, so the result is the same as with inference
+   * from all rows.
+   *
+   * @param rows Number of rows; 0 is all rows
+   */
+  void set_type_inference_rows(size_type rows)
+  {
+    CUDF_EXPECTS(rows >= 0, "type_inference_rows cannot be negative");
+    _type_inference_rows = rows;
+  }
+
+  /**
+   * @brief Sets the number of bytes to infer column types from.
+   *
+   * The sample consists of whole rows, and includes at least one row of each range. If the number
+   * of rows is also set, the sample is limited by both.
+   *
+   * @param bytes Number of bytes; 0 is all bytes
+   */
+  void set_type_inference_bytes(std::size_t bytes) { _type_inference_bytes = bytes; }
+
+  /**
+   * @brief Sets the number of evenly spaced row ranges to take the type inference sample from.
+   *
+   * The sample rows or bytes are split evenly between the ranges. A single range samples the first
+   * rows of the input.
+   *
+   * @param ranges Number of ranges
+   */
+  void set_type_inference_ranges(size_type ranges)
+  {
+    CUDF_EXPECTS(ranges > 0, "type_inference_ranges must be positive");
+    _type_inference_ranges = ranges;
+  }
 };
 
 class csv_reader_options_builder {
@@ -753,6 +836,18 @@ class csv_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the random access index of the compressed source.
+   *
+   * @param index Source of the index.
+   * @return this for chaining.
+   */
+  csv_reader_options_builder& compression_index(source_info const& index)
+  {
+    options._compression_index = index;
+    return *this;
+  }
+
   /**
    * @brief Sets number of bytes to skip from source start.
    *
@@ -1185,6 +1280,42 @@ class csv_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the number of rows to infer column types from.
+   *
+   * @param rows Number of rows; 0 is all rows
+   * @return this for chaining.
+   */
+  csv_reader_options_builder& type_inference_rows(size_type rows)
+  {
+    options.set_type_inference_rows(rows);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the number of bytes to infer column types from.
+   *
+   * @param bytes Number of bytes; 0 is all bytes
+   * @return this for chaining.
+   */
+  csv_reader_options_builder& type_inference_bytes(std::size_t bytes)
+  {
+    options.set_type_inference_bytes(bytes);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the number of evenly spaced row ranges to take the type inference sample from.
+   *
+   * @param ranges Number of ranges
+   * @return this for chaining.
+   */
+  csv_reader_options_builder& type_inference_ranges(size_type ranges)
+  {
+    options.set_type_inference_ranges(ranges);
+    return *this;
+  }
+
   /**
    * @brief move csv_reader_options member once it's built.
    */
@@ -1218,6 +1349,37 @@ table_with_metadata read_csv(
   csv_reader_options options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Writes a random access index of a gzip compressed CSV source.
+ *
+ * The index stores decompression checkpoints roughly every `checkpoint_spacing` uncompressed
+ * bytes. With the index, `read_csv()` can read byte ranges of the uncompressed data: only the
+ * compressed data of the range is read, and the range is decompressed from the checkpoints within
+ * it in parallel.
+ *
+ * The following code snippet demonstrates how to index a file and read a byte range of it:
+ * @code
+ *  cudf::io::write_gzip_index(cudf::io::source_info("dataset.csv.gz"),
+ *                             cudf::io::sink_info("dataset.csv.gz.idx"));
+ *  auto source  = cudf::io::source_info("dataset.csv.gz");
+ *  auto options = cudf::io::csv_reader_options::builder(source)
+ *                   .compression_index(cudf::io::source_info("dataset.csv.gz.idx"))
+ *                   .header(-1)
+ *                   .byte_range_offset(offset)
+ *                   .byte_range_size(size);
+ *  auto result  = cudf::io::read_csv(options);
+ * @endcode
+ *
+ * @throw cudf::logic_error if the source is not a single-member gzip file
+ *
+ * @param source gzip compressed source.
+ * @param index Destination of the index.
+ * @param checkpoint_spacing Minimum number of uncompressed bytes between checkpoints.
+ */
+void write_gzip_index(source_info const& source,
+                      sink_info const& index,
+                      std::size_t checkpoint_spacing = 16 * 1024 * 1024);
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -32,6 +32,7 @@
 
 #include <future>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 //! IO interfaces
@@ -68,6 +69,14 @@ class datasource {
     static std::unique_ptr<buffer> create(Container&& data_owner);
   };
 
+  /**
+   * @brief Byte range within the source, used to describe the reads in a batch.
+   */
+  struct range {
+    size_t offset;  ///< Bytes from the start
+    size_t size;    ///< Bytes to read
+  };
+
   /**
    * @brief Creates a source from a file path.
    *
@@ -143,6 +152,50 @@ class datasource {
    */
   virtual size_t host_read(size_t offset, size_t size, uint8_t* dst) = 0;
 
+  /**
+   * @brief Asynchronously reads a selected range into a preallocated buffer.
+   *
+   * Returns a future value that contains the number of bytes read. Calling `get()` method of the
+   * return value synchronizes this function. The destination buffer must remain valid until the
+   * read is synchronized.
+   *
+   * The default implementation defers to the blocking `host_read()`; data source implementations
+   * that can keep multiple reads in flight should override this function.
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   * @param[in] dst Address of the existing host memory
+   *
+   * @return The number of bytes read as a future value (can be smaller than size)
+   */
+  virtual std::future<size_t> host_read_async(size_t offset, size_t size, uint8_t* dst)
+  {
+    return std::async(std::launch::deferred,
+                      [this, offset, size, dst] { return host_read(offset, size, dst); });
+  }
+
+  /**
+   * @brief Returns buffers with the data from each of the selected ranges.
+   *
+   * The default implementation issues a `host_read()` call per range, in order. Data source
+   * implementations that can read multiple ranges concurrently should override this function.
+   *
+   * @param[in] ranges Byte ranges to read
+   *
+   * @return The data buffers, one per range (each can be smaller than the range size)
+   */
+  virtual std::vector<std::unique_ptr<datasource::buffer>> host_read_batch(
+    std::vector<range> const& ranges)
+  {
+    std::vector<std::unique_ptr<datasource::buffer>> buffers;
+    buffers.reserve(ranges.size());
+    std::transform(
+      ranges.cbegin(), ranges.cend(), std::back_inserter(buffers), [this](auto const& r) {
+        return host_read(r.offset, r.size);
+      });
+    return buffers;
+  }
+
   /**
    * @brief Whether or not this source supports reading directly into device memory.
    *
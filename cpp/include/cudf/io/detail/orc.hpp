@@ -42,10 +42,15 @@ namespace orc {
  * @brief Class to read ORC dataset data into columns.
  */
 class reader {
- private:
+ protected:
   class impl;
   std::unique_ptr<impl> _impl;
 
+  /**
+   * @brief Default constructor, needed for subclassing.
+   */
+  reader();
+
  public:
   /**
    * @brief Constructor from an array of datasources
@@ -77,6 +82,55 @@ class reader {
                            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 };
 
+/**
+ * @brief Class to read ORC dataset data into a series of tables, one batch of stripes at a time.
+ *
+ * The class privately subclasses `reader` to hide its `read()` API; only the chunked reading APIs
+ * are supported.
+ */
+class chunked_reader : private reader {
+ public:
+  /**
+   * @brief Constructor from a read limit and an array of datasources
+   *
+   * The selected stripes are split into batches so that the estimated device memory needed to
+   * decode each batch stays within `chunk_read_limit`.
+   *
+   * @param chunk_read_limit Limit on the device memory used to read each chunk, in bytes, or `0`
+   * to read all the selected stripes in a single chunk
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(std::size_t chunk_read_limit,
+                          std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                          orc_reader_options const& options,
+                          rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Destructor explicitly declared to avoid inlining in header
+   */
+  ~chunked_reader();
+
+  /**
+   * @brief Returns whether there are chunks left to read
+   *
+   * @return `true` until all the chunks have been read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Reads the next batch of stripes
+   *
+   * @throw cudf::logic_error if all the chunks have already been read
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with table metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+};
+
 /**
  * @brief Class to write ORC dataset data into columns.
  */
@@ -36,6 +36,8 @@ namespace io {
 class parquet_reader_options;
 class parquet_writer_options;
 class chunked_parquet_writer_options;
+struct parquet_metadata;
+struct parquet_column_chunk_encoding;
 
 namespace detail {
 namespace parquet {
@@ -44,10 +46,15 @@ namespace parquet {
  * @brief Class to read Parquet dataset data into columns.
  */
 class reader {
- private:
+ protected:
   class impl;
   std::unique_ptr<impl> _impl;
 
+  /**
+   * @brief Default constructor, needed for subclassing.
+   */
+  reader();
+
  public:
   /**
    * @brief Constructor from an array of datasources
@@ -77,6 +84,56 @@ class reader {
                            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 };
 
+/**
+ * @brief Class to read Parquet dataset data into a series of tables, chunk by chunk.
+ *
+ * The class privately subclasses `reader` to hide its `read()` API; only the chunked reading APIs
+ * are supported.
+ */
+class chunked_reader : private reader {
+ public:
+  /**
+   * @brief Constructor from a read limit and an array of datasources
+   *
+   * The selected rows are split into chunks so that the estimated device memory needed to decode
+   * each chunk stays within `chunk_read_limit`. A single row group is split on page boundaries if
+   * it doesn't fit on its own.
+   *
+   * @param chunk_read_limit Limit on the device memory used to read each chunk, in bytes, or `0`
+   * to read all the selected rows in a single chunk
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(std::size_t chunk_read_limit,
+                          std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                          parquet_reader_options const& options,
+                          rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_reader();
+
+  /**
+   * @brief Returns whether there are chunks left to read
+   *
+   * @return `true` until all the chunks have been read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of rows
+   *
+   * @throw cudf::logic_error if all the chunks have already been read
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with table metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+};
+
 /**
  * @brief Class to write parquet dataset data into columns.
  */
@@ -143,6 +200,11 @@ class writer {
   std::unique_ptr<std::vector<uint8_t>> close(
     std::vector<std::string> const& column_chunks_file_path = {});
 
+  /**
+   * @brief Returns the encoding decision of each column chunk written so far, in write order.
+   */
+  [[nodiscard]] std::vector<parquet_column_chunk_encoding> const& column_chunk_encodings() const;
+
   /**
    * @brief Merges multiple metadata blobs returned by write_all into a single metadata blob
    *
@@ -153,6 +215,15 @@ class writer {
     const std::vector<std::unique_ptr<std::vector<uint8_t>>>& metadata_list);
 };
 
+/**
+ * @brief Reads the metadata of a Parquet file without reading any column data.
+ *
+ * @param source Input `datasource` object to read the footer from
+ *
+ * @return Schema, row group and column chunk metadata of the file
+ */
+parquet_metadata read_parquet_metadata(datasource* source);
+
 };  // namespace parquet
 };  // namespace detail
 };  // namespace io
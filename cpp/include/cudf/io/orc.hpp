@@ -22,6 +22,7 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -37,6 +38,7 @@ namespace io {
 constexpr size_t default_stripe_size_bytes   = 64 * 1024 * 1024;
 constexpr size_type default_stripe_size_rows = 1000000;
 constexpr size_type default_row_index_stride = 10000;
+constexpr size_t default_orc_tail_read_size  = 256 * 1024;
 
 /**
  * @brief Builds settings to use for `read_orc()`.
@@ -58,9 +60,13 @@ class orc_reader_options {
   size_type _skip_rows = 0;
   // Rows to read; -1 is all
   size_type _num_rows = -1;
+  // Conjunction of predicates used to skip stripes based on statistics (ignored if empty)
+  std::vector<column_predicate> _filters;
 
   // Whether to use row index to speed-up reading
   bool _use_index = true;
+  // Bytes read from the end of each source to get the postscript and footer in a single request
+  size_t _tail_read_size = default_orc_tail_read_size;
 
   // Whether to use numpy-compatible dtypes
   bool _use_np_dtypes = true;
@@ -124,11 +130,21 @@ class orc_reader_options {
    */
   size_type get_num_rows() const { return _num_rows; }
 
+  /**
+   * @brief Returns the predicates used to skip stripes based on column statistics.
+   */
+  [[nodiscard]] std::vector<column_predicate> const& get_filters() const { return _filters; }
+
   /**
    * @brief Whether to use row index to speed-up reading.
    */
   bool is_enabled_use_index() const { return _use_index; }
 
+  /**
+   * @brief Returns the number of bytes read from the end of each source to get its metadata.
+   */
+  [[nodiscard]] size_t get_tail_read_size() const { return _tail_read_size; }
+
   /**
    * @brief Whether to use numpy-compatible dtypes.
    */
@@ -178,6 +194,26 @@ class orc_reader_options {
     _stripes = std::move(stripes);
   }
 
+  /**
+   * @brief Sets the predicates used to skip stripes based on column statistics.
+   *
+   * Stripes whose statistics prove that no row satisfies all predicates are not read. Applied on
+   * top of the stripes selection. When the row index is used, row groups of the remaining stripes
+   * are skipped the same way based on the row index statistics, and their rows are not returned.
+   * Rows of the remaining row groups are returned unfiltered.
+   *
+   * Timestamp columns are compared in milliseconds since the UNIX epoch, the unit of the ORC
+   * timestamp statistics.
+   *
+   * @param filters Conjunction of column predicates.
+   */
+  void set_filters(std::vector<column_predicate> filters)
+  {
+    CUDF_EXPECTS(filters.empty() or (_skip_rows == 0), "Can't set filters along with skip_rows");
+    CUDF_EXPECTS(filters.empty() or (_num_rows == -1), "Can't set filters along with num_rows");
+    _filters = std::move(filters);
+  }
+
   /**
    * @brief Sets number of rows to skip from the start.
    *
@@ -186,6 +222,7 @@ class orc_reader_options {
   void set_skip_rows(size_type rows)
   {
     CUDF_EXPECTS(rows == 0 or _stripes.empty(), "Can't set both skip_rows along with stripes");
+    CUDF_EXPECTS(rows == 0 or _filters.empty(), "Can't set both skip_rows along with filters");
     _skip_rows = rows;
   }
 
@@ -197,6 +234,7 @@ class orc_reader_options {
   void set_num_rows(size_type nrows)
   {
     CUDF_EXPECTS(nrows == -1 or _stripes.empty(), "Can't set both num_rows along with stripes");
+    CUDF_EXPECTS(nrows == -1 or _filters.empty(), "Can't set both num_rows along with filters");
     _num_rows = nrows;
   }
 
@@ -207,6 +245,17 @@ class orc_reader_options {
    */
   void enable_use_index(bool use) { _use_index = use; }
 
+  /**
+   * @brief Sets the number of bytes read from the end of each source to get its metadata.
+   *
+   * The postscript, the file footer and the metadata section are parsed from this single read
+   * when they fit in it; larger footers take one more read. Larger values save round trips to
+   * high-latency sources (e.g. object stores) at the cost of reading unused bytes.
+   *
+   * @param size Number of bytes; values below 256 (the maximum postscript size) are rounded up
+   */
+  void set_tail_read_size(size_t size) { _tail_read_size = size; }
+
   /**
    * @brief Enable/Disable use of numpy-compatible dtypes
    *
@@ -291,6 +340,18 @@ class orc_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the predicates used to skip stripes based on column statistics.
+   *
+   * @param filters Conjunction of column predicates.
+   * @return this for chaining.
+   */
+  orc_reader_options_builder& filters(std::vector<column_predicate> filters)
+  {
+    options.set_filters(std::move(filters));
+    return *this;
+  }
+
   /**
    * @brief Sets number of rows to skip from the start.
    *
@@ -327,6 +388,18 @@ class orc_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the number of bytes read from the end of each source to get its metadata.
+   *
+   * @param size Number of bytes.
+   * @return this for chaining.
+   */
+  orc_reader_options_builder& tail_read_size(size_t size)
+  {
+    options.set_tail_read_size(size);
+    return *this;
+  }
+
   /**
    * @brief Enable/Disable use of numpy-compatible dtypes.
    *
@@ -422,6 +495,78 @@ table_with_metadata read_orc(
   orc_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Reads an ORC dataset into a series of tables, one batch of stripes at a time.
+ *
+ * The stripes selected by the reader options are split into batches of consecutive stripes that
+ * can each be decoded within a device memory budget, and each batch is returned as a table. The
+ * memory needed to decode a stripe is estimated from the stripe sizes and the selected column
+ * types, so the budget is a target rather than a hard limit; a batch always holds at least one
+ * stripe. The file metadata and the timezone table are shared by all the batches, and the stripe
+ * data of the next batch is read ahead, in host memory, while the current batch is decoded.
+ *
+ * The following code snippet demonstrates how to read a dataset in chunks of up to 1GB:
+ * @code
+ *  auto source  = cudf::io::source_info("dataset.orc");
+ *  auto options = cudf::io::orc_reader_options::builder(source);
+ *  auto reader  = cudf::io::chunked_orc_reader(1024 * 1024 * 1024, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    // ...
+ *  }
+ * @endcode
+ */
+class chunked_orc_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *        This is added just to satisfy cython.
+   */
+  chunked_orc_reader() = default;
+
+  /**
+   * @brief Constructor with a read limit and reader options
+   *
+   * @param chunk_read_limit Limit on the device memory used to read each chunk, in bytes, or `0`
+   * to read all the selected stripes in a single chunk
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource used to allocate device memory of the returned tables
+   */
+  chunked_orc_reader(
+    std::size_t chunk_read_limit,
+    orc_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   */
+  ~chunked_orc_reader();
+
+  /**
+   * @brief Returns whether there are chunks left to read.
+   *
+   * At least one chunk, possibly empty, is returned for any set of options.
+   *
+   * @return `true` until all the chunks have been read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Reads the next batch of stripes.
+   *
+   * The metadata of the first chunk also reports the number of stripes skipped by the reader
+   * filters.
+   *
+   * @throw cudf::logic_error if all the chunks have already been read
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::orc::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -454,6 +599,8 @@ class orc_writer_options {
   sink_info _sink;
   // Specify the compression format to use
   compression_type _compression = compression_type::AUTO;
+  // Specify the compression level; the default level of the compression type if not set
+  std::optional<int> _compression_level;
   // Specify frequency of statistics collection
   statistics_freq _stats_freq = ORC_STATISTICS_ROW_GROUP;
   // Maximum size of each stripe (unless smaller than a single row group)
@@ -510,6 +657,11 @@ class orc_writer_options {
    */
   [[nodiscard]] compression_type get_compression() const { return _compression; }
 
+  /**
+   * @brief Returns the compression level, if set.
+   */
+  [[nodiscard]] std::optional<int> get_compression_level() const { return _compression_level; }
+
   /**
    * @brief Whether writing column statistics is enabled/disabled.
    */
@@ -569,6 +721,16 @@ class orc_writer_options {
    */
   void set_compression(compression_type comp) { _compression = comp; }
 
+  /**
+   * @brief Sets the compression level.
+   *
+   * Valid levels are 1 to 22 for ZSTD, and 0 to 9 for GZIP and ZLIB. The other compression types
+   * ignore the level.
+   *
+   * @param level The compression level to use.
+   */
+  void set_compression_level(int level) { _compression_level = level; }
+
   /**
    * @brief Choose granularity of statistics collection.
    *
@@ -671,6 +833,18 @@ class orc_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the compression level.
+   *
+   * @param level The compression level to use; see `set_compression_level`.
+   * @return this for chaining.
+   */
+  orc_writer_options_builder& compression_level(int level)
+  {
+    options._compression_level = level;
+    return *this;
+  }
+
   /**
    * @brief Choose granularity of column statistics to be written
    *
@@ -805,6 +979,8 @@ class chunked_orc_writer_options {
   sink_info _sink;
   // Specify the compression format to use
   compression_type _compression = compression_type::AUTO;
+  // Specify the compression level; the default level of the compression type if not set
+  std::optional<int> _compression_level;
   // Specify granularity of statistics collection
   statistics_freq _stats_freq = ORC_STATISTICS_ROW_GROUP;
   // Maximum size of each stripe (unless smaller than a single row group)
@@ -854,6 +1030,11 @@ class chunked_orc_writer_options {
    */
   [[nodiscard]] compression_type get_compression() const { return _compression; }
 
+  /**
+   * @brief Returns the compression level, if set.
+   */
+  [[nodiscard]] std::optional<int> get_compression_level() const { return _compression_level; }
+
   /**
    * @brief Returns granularity of statistics collection.
    */
@@ -900,6 +1081,16 @@ class chunked_orc_writer_options {
    */
   void set_compression(compression_type comp) { _compression = comp; }
 
+  /**
+   * @brief Sets the compression level.
+   *
+   * Valid levels are 1 to 22 for ZSTD, and 0 to 9 for GZIP and ZLIB. The other compression types
+   * ignore the level.
+   *
+   * @param level The compression level to use.
+   */
+  void set_compression_level(int level) { _compression_level = level; }
+
   /**
    * @brief Choose granularity of statistics collection
    *
@@ -992,6 +1183,18 @@ class chunked_orc_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the compression level.
+   *
+   * @param level The compression level to use; see `set_compression_level`.
+   * @return this for chaining.
+   */
+  chunked_orc_writer_options_builder& compression_level(int level)
+  {
+    options._compression_level = level;
+    return *this;
+  }
+
   /**
    * @brief Choose granularity of statistics collection
    *
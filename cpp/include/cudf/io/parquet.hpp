@@ -26,6 +26,7 @@
 
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -60,6 +61,8 @@ class parquet_reader_options {
   size_type _skip_rows = 0;
   // Number of rows to read; -1 is all
   size_type _num_rows = -1;
+  // Conjunction of predicates used to skip row groups based on statistics (ignored if empty)
+  std::vector<column_predicate> _filters;
 
   // Whether to store string data as categorical type
   bool _convert_strings_to_categories = false;
@@ -132,6 +135,11 @@ class parquet_reader_options {
    */
   std::vector<std::vector<size_type>> const& get_row_groups() const { return _row_groups; }
 
+  /**
+   * @brief Returns the predicates used to skip row groups based on column statistics.
+   */
+  [[nodiscard]] std::vector<column_predicate> const& get_filters() const { return _filters; }
+
   /**
    * @brief Returns timestamp type used to cast timestamp columns.
    */
@@ -158,6 +166,23 @@ class parquet_reader_options {
     _row_groups = std::move(row_groups);
   }
 
+  /**
+   * @brief Sets the predicates used to skip row groups based on column statistics.
+   *
+   * Row groups whose statistics prove that no row satisfies all predicates are not read. Rows of
+   * the remaining row groups are returned unfiltered. Applied on top of the row groups selection.
+   *
+   * @param filters Conjunction of column predicates.
+   */
+  void set_filters(std::vector<column_predicate> filters)
+  {
+    if ((!filters.empty()) and ((_skip_rows != 0) or (_num_rows != -1))) {
+      CUDF_FAIL("filters can't be set along with skip_rows and num_rows");
+    }
+
+    _filters = std::move(filters);
+  }
+
   /**
    * @brief Sets to enable/disable conversion of strings to categories.
    *
@@ -182,6 +207,9 @@ class parquet_reader_options {
     if ((val != 0) and (!_row_groups.empty())) {
       CUDF_FAIL("skip_rows can't be set along with a non-empty row_groups");
     }
+    if ((val != 0) and (!_filters.empty())) {
+      CUDF_FAIL("skip_rows can't be set along with non-empty filters");
+    }
 
     _skip_rows = val;
   }
@@ -196,6 +224,9 @@ class parquet_reader_options {
     if ((val != -1) and (!_row_groups.empty())) {
       CUDF_FAIL("num_rows can't be set along with a non-empty row_groups");
     }
+    if ((val != -1) and (!_filters.empty())) {
+      CUDF_FAIL("num_rows can't be set along with non-empty filters");
+    }
 
     _num_rows = val;
   }
@@ -250,6 +281,18 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the predicates used to skip row groups based on column statistics.
+   *
+   * @param filters Conjunction of column predicates.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& filters(std::vector<column_predicate> filters)
+  {
+    options.set_filters(std::move(filters));
+    return *this;
+  }
+
   /**
    * @brief Sets enable/disable conversion of strings to categories.
    *
@@ -343,6 +386,115 @@ table_with_metadata read_parquet(
   parquet_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Reads a Parquet dataset into a series of tables, chunk by chunk.
+ *
+ * The rows selected by the reader options are split into chunks that can each be read within a
+ * device memory budget. Consecutive row groups are read together while they fit in the budget,
+ * and a row group that doesn't fit on its own is split into ranges of rows aligned to its page
+ * boundaries (using the page index when the file has one). The memory needed to read a chunk is
+ * estimated from the column chunk metadata, so the budget is a target rather than a hard limit;
+ * a chunk always holds at least one page of rows.
+ *
+ * The following code snippet demonstrates how to read a dataset in chunks of up to 1GB:
+ * @code
+ *  auto source  = cudf::io::source_info("dataset.parquet");
+ *  auto options = cudf::io::parquet_reader_options::builder(source);
+ *  auto reader  = cudf::io::chunked_parquet_reader(1024 * 1024 * 1024, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    // ...
+ *  }
+ * @endcode
+ */
+class chunked_parquet_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *        This is added just to satisfy cython.
+   */
+  chunked_parquet_reader() = default;
+
+  /**
+   * @brief Constructor with a read limit and reader options
+   *
+   * @param chunk_read_limit Limit on the device memory used to read each chunk, in bytes, or `0`
+   * to read all the selected rows in a single chunk
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource used to allocate device memory of the returned tables
+   */
+  chunked_parquet_reader(
+    std::size_t chunk_read_limit,
+    parquet_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   */
+  ~chunked_parquet_reader();
+
+  /**
+   * @brief Returns whether there are chunks left to read.
+   *
+   * At least one chunk, possibly empty, is returned for any set of options.
+   *
+   * @return `true` until all the chunks have been read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of rows.
+   *
+   * The metadata of the first chunk also reports the number of row groups skipped by the reader
+   * filters.
+   *
+   * @throw cudf::logic_error if all the chunks have already been read
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::parquet::chunked_reader> reader;
+};
+
+/**
+ * @brief Counters and size of the process-wide Parquet footer cache.
+ */
+struct parquet_footer_cache_statistics {
+  size_t hits;        ///< Number of footer lookups served from the cache
+  size_t misses;      ///< Number of footer lookups that had to read and parse the footer
+  size_t entries;     ///< Number of cached footers
+  size_t size_bytes;  ///< Total serialized size of the cached footers
+};
+
+/**
+ * @brief Sets the capacity of the process-wide cache of parsed Parquet footers.
+ *
+ * The cache is shared by all Parquet readers in the process and is disabled by default. When
+ * enabled, the parsed footer (`FileMetaData`) of each file source is cached, keyed on the file
+ * path, size and modification time, so that repeated reads of the same file (e.g. one row group
+ * at a time) skip the footer I/O and parsing. Sources that are not files (host buffers,
+ * user-implemented sources) are never cached. When the capacity is exceeded, the least recently
+ * used footers are evicted.
+ *
+ * @param capacity_bytes Maximum total serialized size of the cached footers; zero disables the
+ * cache and releases all entries
+ */
+void set_parquet_footer_cache_capacity(size_t capacity_bytes);
+
+/**
+ * @brief Returns the hit/miss counters and the current size of the Parquet footer cache.
+ *
+ * @return Cache statistics
+ */
+parquet_footer_cache_statistics get_parquet_footer_cache_statistics();
+
+/**
+ * @brief Removes all entries from the Parquet footer cache; the counters are not reset.
+ */
+void clear_parquet_footer_cache();
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -350,6 +502,26 @@ table_with_metadata read_parquet(
  * @file
  */
 
+/**
+ * @brief Encoding decision made by the writer for one column chunk.
+ *
+ * Before building a dictionary for a column chunk, the writer estimates the number of distinct
+ * values in the chunk with a HyperLogLog sketch. Chunks whose estimated cardinality is too high
+ * for a dictionary to fit, or to be smaller than the PLAIN encoded data, skip the dictionary pass
+ * and are written with PLAIN encoding.
+ */
+struct parquet_column_chunk_encoding {
+  std::string column_path;     ///< Dot-separated path of the leaf column in the Parquet schema
+  size_type partition;         ///< Index of the output partition (file)
+  size_type row_group;         ///< Index of the row group within the partition
+  bool is_dictionary_encoded;  ///< Whether the chunk is written with dictionary encoding
+  bool is_dictionary_skipped;  ///< Whether the dictionary pass was skipped based on the estimate
+  /// Estimated number of distinct values; -1 if the cardinality of the chunk was not estimated
+  size_type estimated_cardinality;
+  /// Exact number of distinct values; -1 if no dictionary was built, or it overflowed
+  size_type cardinality;
+};
+
 /**
  * @brief Class to build `parquet_writer_options`.
  */
@@ -363,6 +535,8 @@ class parquet_writer_options {
   sink_info _sink;
   // Specify the compression format to use
   compression_type _compression = compression_type::SNAPPY;
+  // Specify the compression level; the default level of the compression type if not set
+  std::optional<int> _compression_level;
   // Specify the level of statistics in the output file
   statistics_freq _stats_level = statistics_freq::STATISTICS_ROWGROUP;
   // Sets of columns to output
@@ -431,6 +605,11 @@ class parquet_writer_options {
    */
   [[nodiscard]] compression_type get_compression() const { return _compression; }
 
+  /**
+   * @brief Returns the compression level, if set.
+   */
+  [[nodiscard]] std::optional<int> get_compression_level() const { return _compression_level; }
+
   /**
    * @brief Returns level of statistics requested in output file.
    */
@@ -528,6 +707,16 @@ class parquet_writer_options {
    */
   void set_compression(compression_type compression) { _compression = compression; }
 
+  /**
+   * @brief Sets the compression level.
+   *
+   * Valid levels are 1 to 22 for ZSTD, and 0 to 9 for GZIP and ZLIB. The other compression types
+   * ignore the level.
+   *
+   * @param level The compression level to use.
+   */
+  void set_compression_level(int level) { _compression_level = level; }
+
   /**
    * @brief Sets timestamp writing preferences. INT96 timestamps will be written
    * if `true` and TIMESTAMP_MICROS will be written if `false`.
@@ -660,6 +849,18 @@ class parquet_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the compression level.
+   *
+   * @param level The compression level to use; see `set_compression_level`.
+   * @return this for chaining.
+   */
+  parquet_writer_options_builder& compression_level(int level)
+  {
+    options._compression_level = level;
+    return *this;
+  }
+
   /**
    * @brief Sets column chunks file path to be set in the raw output metadata.
    *
@@ -745,6 +946,23 @@ std::unique_ptr<std::vector<uint8_t>> write_parquet(
   parquet_writer_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Writes a set of columns to parquet format, and returns the encoding decision of each
+ * written column chunk.
+ *
+ * @param options Settings for controlling writing behavior.
+ * @param column_chunk_encodings Output encoding decision of each written column chunk, in write
+ *        order; replaces the previous contents.
+ * @param mr Device memory resource to use for device memory allocation.
+ *
+ * @return A blob that contains the file metadata (parquet FileMetadata thrift message) if
+ *         requested in parquet_writer_options (empty blob otherwise).
+ */
+std::unique_ptr<std::vector<uint8_t>> write_parquet(
+  parquet_writer_options const& options,
+  std::vector<parquet_column_chunk_encoding>& column_chunk_encodings,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Merges multiple raw metadata blobs that were previously created by write_parquet
  * into a single metadata blob.
@@ -770,6 +988,8 @@ class chunked_parquet_writer_options {
   sink_info _sink;
   // Specify the compression format to use
   compression_type _compression = compression_type::AUTO;
+  // Specify the compression level; the default level of the compression type if not set
+  std::optional<int> _compression_level;
   // Specify the level of statistics in the output file
   statistics_freq _stats_level = statistics_freq::STATISTICS_ROWGROUP;
   // Optional associated metadata.
@@ -811,6 +1031,11 @@ class chunked_parquet_writer_options {
    */
   [[nodiscard]] compression_type get_compression() const { return _compression; }
 
+  /**
+   * @brief Returns the compression level, if set.
+   */
+  [[nodiscard]] std::optional<int> get_compression_level() const { return _compression_level; }
+
   /**
    * @brief Returns level of statistics requested in output file.
    */
@@ -877,6 +1102,16 @@ class chunked_parquet_writer_options {
    */
   void set_compression(compression_type compression) { _compression = compression; }
 
+  /**
+   * @brief Sets the compression level.
+   *
+   * Valid levels are 1 to 22 for ZSTD, and 0 to 9 for GZIP and ZLIB. The other compression types
+   * ignore the level.
+   *
+   * @param level The compression level to use.
+   */
+  void set_compression_level(int level) { _compression_level = level; }
+
   /**
    * @brief Sets timestamp writing preferences. INT96 timestamps will be written
    * if `true` and TIMESTAMP_MICROS will be written if `false`.
@@ -986,6 +1221,18 @@ class chunked_parquet_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the compression level.
+   *
+   * @param level The compression level to use; see `set_compression_level`.
+   * @return this for chaining.
+   */
+  chunked_parquet_writer_options_builder& compression_level(int level)
+  {
+    options._compression_level = level;
+    return *this;
+  }
+
   /**
    * @brief Set to true if timestamps should be written as
    * int96 types instead of int64 types. Even though int96 is deprecated and is
@@ -1099,6 +1346,11 @@ class parquet_chunked_writer {
   std::unique_ptr<std::vector<uint8_t>> close(
     std::vector<std::string> const& column_chunks_file_paths = {});
 
+  /**
+   * @brief Returns the encoding decision of each column chunk written so far, in write order.
+   */
+  [[nodiscard]] std::vector<parquet_column_chunk_encoding> const& column_chunk_encodings() const;
+
   // Unique pointer to impl writer class
   std::unique_ptr<cudf::io::detail::parquet::writer> writer;
 };
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file parquet_metadata.hpp
+ * @brief cuDF-IO API for reading the metadata of Parquet files without reading their data
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief Physical type of a Parquet column; the values match the Parquet format.
+ */
+enum class parquet_physical_type : int32_t {
+  BOOLEAN              = 0,
+  INT32                = 1,
+  INT64                = 2,
+  INT96                = 3,
+  FLOAT                = 4,
+  DOUBLE               = 5,
+  BYTE_ARRAY           = 6,
+  FIXED_LEN_BYTE_ARRAY = 7,
+};
+
+/**
+ * @brief Repetition of a Parquet schema element; the values match the Parquet format.
+ */
+enum class parquet_repetition_type : int32_t {
+  REQUIRED = 0,
+  OPTIONAL = 1,
+  REPEATED = 2,
+};
+
+/**
+ * @brief Encoding of Parquet pages; the values match the Parquet format.
+ */
+enum class parquet_encoding : int32_t {
+  PLAIN                   = 0,
+  PLAIN_DICTIONARY        = 2,
+  RLE                     = 3,
+  BIT_PACKED              = 4,
+  DELTA_BINARY_PACKED     = 5,
+  DELTA_LENGTH_BYTE_ARRAY = 6,
+  DELTA_BYTE_ARRAY        = 7,
+  RLE_DICTIONARY          = 8,
+  BYTE_STREAM_SPLIT       = 9,
+};
+
+/**
+ * @brief Compression codec of a Parquet column chunk; the values match the Parquet format.
+ */
+enum class parquet_compression : int32_t {
+  UNCOMPRESSED = 0,
+  SNAPPY       = 1,
+  GZIP         = 2,
+  LZO          = 3,
+  BROTLI       = 4,
+  LZ4          = 5,
+  ZSTD         = 6,
+  LZ4_RAW      = 7,
+};
+
+/**
+ * @brief Element of the schema tree of a Parquet file.
+ *
+ * Groups (structs, lists and maps) have children and no physical type; leaf columns have a
+ * physical type and no children.
+ */
+struct parquet_schema_element {
+  std::string name;                                    ///< Name of the element
+  std::optional<parquet_physical_type> physical_type;  ///< Physical type; not set for groups
+  parquet_repetition_type repetition_type;             ///< Repetition of the element
+  int32_t type_length;                    ///< Byte length of FIXED_LEN_BYTE_ARRAY values
+  std::optional<int32_t> converted_type;  ///< Parquet `ConvertedType` annotation, if any
+  int32_t decimal_scale;                  ///< Scale of decimal columns, 0 otherwise
+  int32_t decimal_precision;              ///< Precision of decimal columns, 0 otherwise
+  std::vector<parquet_schema_element> children;  ///< Children of groups
+};
+
+/**
+ * @brief Typed value of Parquet statistics.
+ *
+ * BOOLEAN, INT32 and INT64 values are `int64_t`, or `uint64_t` for columns annotated as unsigned.
+ * FLOAT and DOUBLE values are `double`. Other physical types hold the plain-encoded bytes of the
+ * value in a `std::string`, which for BYTE_ARRAY columns is the value itself.
+ */
+using parquet_statistics_value = std::variant<int64_t, uint64_t, double, std::string>;
+
+/**
+ * @brief Statistics of a Parquet column chunk; members that are not in the file are not set.
+ */
+struct parquet_column_statistics {
+  std::optional<int64_t> null_count;                ///< Number of null values
+  std::optional<int64_t> distinct_count;            ///< Number of distinct values
+  std::optional<parquet_statistics_value> minimum;  ///< Minimum value
+  std::optional<parquet_statistics_value> maximum;  ///< Maximum value
+};
+
+/**
+ * @brief Metadata of a Parquet column chunk.
+ */
+struct parquet_column_chunk_metadata {
+  std::vector<std::string> path_in_schema;        ///< Names of the schema elements from the root
+  std::string file_path;                          ///< File holding the data; empty if this file
+  parquet_physical_type physical_type;            ///< Physical type of the values
+  std::vector<parquet_encoding> encodings;        ///< Encodings used in the chunk
+  parquet_compression codec;                      ///< Compression codec of the pages
+  int64_t num_values;                             ///< Number of values, including nulls
+  int64_t total_uncompressed_size;                ///< Size of the uncompressed pages
+  int64_t total_compressed_size;                  ///< Size of the compressed pages
+  int64_t data_page_offset;                       ///< File offset of the first data page
+  std::optional<int64_t> dictionary_page_offset;  ///< File offset of the dictionary page
+  parquet_column_statistics statistics;           ///< Chunk-level statistics
+};
+
+/**
+ * @brief Metadata of a Parquet row group.
+ */
+struct parquet_row_group_metadata {
+  int64_t num_rows;                                    ///< Number of rows
+  int64_t total_byte_size;                             ///< Size of the uncompressed column data
+  std::vector<parquet_column_chunk_metadata> columns;  ///< One element per leaf column
+};
+
+/**
+ * @brief Metadata of a Parquet file, as stored in its footer.
+ */
+struct parquet_metadata {
+  int32_t version;                                        ///< Version of the Parquet format
+  std::string created_by;                                 ///< Application that wrote the file
+  int64_t num_rows;                                       ///< Number of rows in the file
+  parquet_schema_element schema;                          ///< Root of the schema tree
+  std::vector<parquet_row_group_metadata> row_groups;     ///< Row groups of the file
+  std::map<std::string, std::string> key_value_metadata;  ///< Application-defined metadata
+};
+
+/**
+ * @brief Reads the metadata of a Parquet file without reading any column data.
+ *
+ * @ingroup io_readers
+ *
+ * Only the footer of the file is read and parsed, on the host; no device memory is used. File
+ * sources use the footer cache when it is enabled (see `set_parquet_footer_cache_capacity`).
+ *
+ * The following code snippet demonstrates how to list the row counts of the row groups of a file:
+ * @code
+ *  auto const metadata = cudf::io::read_parquet_metadata(cudf::io::source_info("dataset.parquet"));
+ *  for (auto const& row_group : metadata.row_groups) {
+ *    std::cout << row_group.num_rows << std::endl;
+ *  }
+ * @endcode
+ *
+ * @throw cudf::logic_error if the source is not a single Parquet file or the footer is corrupted
+ *
+ * @param src_info Dataset source
+ *
+ * @return Schema, row group and column chunk metadata of the file
+ */
+parquet_metadata read_parquet_metadata(source_info const& src_info);
+
+}  // namespace io
+}  // namespace cudf
@@ -22,12 +22,14 @@
 #pragma once
 
 #include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
 
 #include <thrust/optional.h>
 
 #include <map>
 #include <memory>
 #include <string>
+#include <variant>
 #include <vector>
 
 // Forward declarations
@@ -60,7 +62,10 @@ enum class compression_type {
   BZIP2,   ///< BZIP2 format, using Burrows-Wheeler transform
   BROTLI,  ///< BROTLI format, using LZ77 + Huffman + 2nd order context modeling
   ZIP,     ///< ZIP format, using DEFLATE algorithm
-  XZ       ///< XZ format, using LZMA(2) algorithm
+  XZ,      ///< XZ format, using LZMA(2) algorithm
+  ZLIB,    ///< ZLIB format, using DEFLATE algorithm
+  LZ4,     ///< LZ4 format, using LZ77
+  ZSTD     ///< Zstandard format, using LZ77 + Huffman + finite state entropy coding
 };
 
 /**
@@ -92,6 +97,47 @@ enum statistics_freq {
   STATISTICS_PAGE     = 2,  ///< Per-page column statistics
 };
 
+/**
+ * @brief Comparison operators supported in a `column_predicate`
+ */
+enum class predicate_op : int32_t {
+  EQUAL,          ///< column == value
+  NOT_EQUAL,      ///< column != value
+  LESS,           ///< column < value
+  LESS_EQUAL,     ///< column <= value
+  GREATER,        ///< column > value
+  GREATER_EQUAL,  ///< column >= value
+  IS_NULL,        ///< column is null; value is ignored
+  IS_NOT_NULL,    ///< column is not null; value is ignored
+  IN              ///< column is equal to one of the values; value is ignored
+};
+
+/**
+ * @brief A single `column <op> value` term of a reader filter.
+ *
+ * Readers combine the terms of a filter as a conjunction and use the column statistics stored in
+ * the file to skip blocks of rows (e.g. Parquet row groups or ORC stripes) in which no row can
+ * satisfy all terms. The filter is not applied to individual rows: the returned table contains
+ * every row of the blocks that are not skipped.
+ *
+ * Integer values can be compared against integral and floating point columns, floating point
+ * values against floating point columns and string values against string columns. Timestamp,
+ * duration and decimal columns are compared using their stored integer representation. Terms
+ * that cannot be evaluated from the available statistics never cause a block to be skipped.
+ *
+ * An `IN` term is satisfied by the rows equal to any of its `values`; a block is skipped when it
+ * would be skipped for each value as an `EQUAL` term. Readers also consult the Bloom filters
+ * stored in the file, if any, for `EQUAL` and `IN` terms.
+ */
+struct column_predicate {
+  using value_type = std::variant<int64_t, double, std::string>;  ///< Type of the values
+
+  std::string column_name;         ///< Name of the top-level column
+  predicate_op op;                 ///< Comparison operator
+  value_type value;                ///< Value to compare against
+  std::vector<value_type> values;  ///< Values of an `IN` term
+};
+
 /**
  * @brief Detailed name information for output columns.
  *
@@ -125,6 +171,11 @@ struct table_metadata {
   std::vector<column_name_info>
     schema_info;  //!< Detailed name information for the entire output hierarchy
   std::map<std::string, std::string> user_data;  //!< Format-dependent metadata as key-values pairs
+  size_type num_row_groups_pruned = 0;  //!< Number of row groups skipped based on statistics
+  size_type num_stripes_pruned    = 0;  //!< Number of ORC stripes skipped based on statistics
+  size_t num_bytes_requested      = 0;  //!< Bytes of the byte ranges coalesced into reads
+  size_t num_bytes_over_read      = 0;  //!< Unrequested bytes read to coalesce nearby ranges
+  size_t num_read_requests_saved  = 0;  //!< Source reads avoided by coalescing nearby ranges
 };
 
 /**
@@ -135,6 +186,38 @@ struct table_with_metadata {
   table_metadata metadata;
 };
 
+/**
+ * @brief Decompression statistics of a codec, for the blocks that the ORC and Parquet readers
+ * decompressed on the host
+ */
+struct host_decompression_statistics {
+  compression_type compression;  ///< Codec of the blocks
+  size_t num_blocks;             ///< Number of blocks decompressed
+  size_t num_failed;             ///< Number of blocks that could not be decompressed
+  size_t compressed_bytes;       ///< Total size of the compressed blocks
+  size_t decompressed_bytes;     ///< Total size of the decompressed blocks
+  double busy_seconds;           ///< Time spent decompressing, summed over all threads
+
+  /**
+   * @brief Returns the decompression throughput of a single thread, in decompressed bytes per
+   * second
+   */
+  [[nodiscard]] double throughput() const
+  {
+    return (busy_seconds > 0) ? decompressed_bytes / busy_seconds : 0.;
+  }
+};
+
+/**
+ * @brief Returns the statistics of the host decompression done by the ORC and Parquet readers.
+ *
+ * Blocks are decompressed on the host when device decompression is not available for their codec,
+ * or is disabled. The statistics are accumulated over all reads in the process.
+ *
+ * @return Statistics of each codec decompressed so far, ordered by codec
+ */
+std::vector<host_decompression_statistics> get_host_decompression_statistics();
+
 /**
  * @brief Non-owning view of a host memory buffer
  *
@@ -244,6 +327,8 @@ class column_in_metadata {
   bool _use_int96_timestamp = false;
   // bool _output_as_binary = false;
   thrust::optional<uint8_t> _decimal_precision;
+  thrust::optional<double> _bloom_filter_fpp;
+  bool _use_byte_stream_split = false;
   std::vector<column_in_metadata> children;
 
  public:
@@ -324,6 +409,42 @@ class column_in_metadata {
     return *this;
   }
 
+  /**
+   * @brief Enables a Bloom filter for this column, with the given false positive probability.
+   * Used by the Parquet writer, for leaf columns of integral, floating-point and string types, and
+   * by the ORC writer, for top-level columns of boolean, integral, floating-point, date and string
+   * types (one filter per row index group).
+   *
+   * Bloom filters let readers skip the column chunks that don't contain a value, which min/max
+   * statistics cannot do for high-cardinality columns such as identifiers.
+   *
+   * @param fpp False positive probability, in the (0, 1) range
+   * @return this for chaining
+   */
+  column_in_metadata& set_bloom_filter(double fpp = 0.01)
+  {
+    CUDF_EXPECTS(fpp > 0 && fpp < 1, "Bloom filter false positive probability must be in (0, 1)");
+    _bloom_filter_fpp = fpp;
+    return *this;
+  }
+
+  /**
+   * @brief Specifies whether this column uses the BYTE_STREAM_SPLIT encoding. Only used by the
+   * Parquet writer, for leaf columns of FLOAT and DOUBLE physical types; ignored otherwise.
+   *
+   * The encoding stores the first byte of every value, then the second byte of every value, and
+   * so on. Floating-point data compresses better that way, because each stream holds bytes of
+   * the same significance. Dictionary encoding is not used for these columns.
+   *
+   * @param req True = use BYTE_STREAM_SPLIT, false = use the default encoding
+   * @return this for chaining
+   */
+  column_in_metadata& set_byte_stream_split(bool req)
+  {
+    _use_byte_stream_split = req;
+    return *this;
+  }
+
   /**
    * @brief Get reference to a child of this column
    *
@@ -379,6 +500,23 @@ class column_in_metadata {
    */
   [[nodiscard]] uint8_t get_decimal_precision() const { return _decimal_precision.value(); }
 
+  /**
+   * @brief Get whether a Bloom filter is to be written for this column
+   */
+  [[nodiscard]] bool is_bloom_filter_enabled() const { return _bloom_filter_fpp.has_value(); }
+
+  /**
+   * @brief Get the false positive probability of the Bloom filter of this column.
+   * @throws If the Bloom filter is not enabled for this column.
+   *         Check using `is_bloom_filter_enabled()` first.
+   */
+  [[nodiscard]] double get_bloom_filter_fpp() const { return _bloom_filter_fpp.value(); }
+
+  /**
+   * @brief Get whether to encode this column using BYTE_STREAM_SPLIT
+   */
+  [[nodiscard]] bool is_enabled_byte_stream_split() const { return _use_byte_stream_split; }
+
   /**
    * @brief Get the number of children of this column
    */
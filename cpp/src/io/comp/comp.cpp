@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io_comp.h"
+#include "unzstd.h"
+
+#include <io/utilities/file_io_utilities.hpp>
+
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <future>
+#include <string>
+#include <vector>
+
+#include <zlib.h>  // deflate
+
+namespace cudf {
+namespace io {
+
+size_t lz4_compress_bound(size_t len) { return len + len / 255 + 16; }
+
+size_t lz4_compress_block(uint8_t* dst, size_t dst_len, uint8_t const* src, size_t src_len)
+{
+  constexpr size_t min_match     = 4;
+  constexpr size_t last_literals = 5;   // The block ends with at least 5 literals
+  constexpr size_t match_limit   = 12;  // The last match starts at least 12 bytes before the end
+  constexpr size_t max_offset    = 65535;
+  constexpr int max_hash_log     = 16;
+
+  // Smaller blocks use a smaller hash table, which is cheaper to reset
+  int hash_log = 8;
+  while (hash_log < max_hash_log && (size_t{1} << hash_log) < src_len) {
+    ++hash_log;
+  }
+  // Reuse the hash table of the thread across blocks instead of allocating one per block
+  thread_local std::vector<int64_t> table;
+  table.assign(size_t{1} << hash_log, -1);
+
+  auto read_le32 = [](uint8_t const* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+  };
+  auto hash = [&](size_t pos) { return (read_le32(src + pos) * 2654435761u) >> (32 - hash_log); };
+
+  size_t out = 0;
+  auto write_length = [&](size_t length) {
+    for (; length >= 255; length -= 255) {
+      dst[out++] = 255;
+    }
+    dst[out++] = static_cast<uint8_t>(length);
+  };
+  // Writes a sequence; a zero match length denotes the final literals
+  auto write_sequence =
+    [&](uint8_t const* literals, size_t num_literals, size_t match, size_t offset) {
+      auto const extra_length =
+        (num_literals / 255 + 1) + (match ? (match - min_match) / 255 + 3 : 0);
+      if (out + 1 + num_literals + extra_length > dst_len) { return false; }
+      auto const match_code = match ? match - min_match : 0;
+      dst[out++]            = static_cast<uint8_t>((std::min<size_t>(num_literals, 15) << 4) |
+                                                   std::min<size_t>(match_code, 15));
+      if (num_literals >= 15) { write_length(num_literals - 15); }
+      std::memcpy(dst + out, literals, num_literals);
+      out += num_literals;
+      if (match) {
+        dst[out++] = static_cast<uint8_t>(offset);
+        dst[out++] = static_cast<uint8_t>(offset >> 8);
+        if (match_code >= 15) { write_length(match_code - 15); }
+      }
+      return true;
+    };
+
+  size_t anchor = 0;
+  size_t pos    = 0;
+  while (pos + match_limit <= src_len) {
+    auto const h         = hash(pos);
+    auto const candidate = table[h];
+    table[h]             = static_cast<int64_t>(pos);
+    if (candidate < 0 || pos - candidate > max_offset ||
+        read_le32(src + candidate) != read_le32(src + pos)) {
+      ++pos;
+      continue;
+    }
+    auto const match_end = src_len - last_literals;
+    auto length          = min_match;
+    while (pos + length < match_end && src[candidate + length] == src[pos + length]) {
+      ++length;
+    }
+    if (!write_sequence(src + anchor, pos - anchor, length, pos - candidate)) { return 0; }
+    pos += length;
+    anchor = pos;
+  }
+  if (!write_sequence(src + anchor, src_len - anchor, 0, 0)) { return 0; }
+  return out;
+}
+
+/**
+ * @brief ZLIB host compressor class
+ *
+ * Produces a GZIP member (RFC 1952) or a raw DEFLATE stream (RFC 1951).
+ */
+class HostCompressor_ZLIB : public HostCompressor {
+ public:
+  HostCompressor_ZLIB(bool gz_hdr_, int level_) : gz_hdr(gz_hdr_), level(level_) {}
+  size_t Compress(uint8_t* dstBytes, size_t dstLen, const uint8_t* srcBytes, size_t srcLen) override
+  {
+    z_stream strm{};
+    if (deflateInit2(&strm, level, Z_DEFLATED, gz_hdr ? 16 + MAX_WBITS : -MAX_WBITS, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+      return 0;
+    }
+    strm.next_in   = const_cast<Bytef*>(srcBytes);
+    strm.avail_in  = static_cast<uInt>(srcLen);
+    strm.next_out  = dstBytes;
+    strm.avail_out = static_cast<uInt>(dstLen);
+    auto const ret = deflate(&strm, Z_FINISH);
+    auto const len = strm.total_out;
+    deflateEnd(&strm);
+    return (ret == Z_STREAM_END) ? len : 0;
+  }
+  size_t GetMaxCompressedSize(size_t srcLen) override
+  {
+    // compressBound includes the 6-byte ZLIB wrapper; the GZIP wrapper takes 18 bytes
+    return compressBound(srcLen) + 12;
+  }
+
+ protected:
+  const bool gz_hdr;
+  const int level;
+};
+
+/**
+ * @brief LZ4 host compressor class; produces raw LZ4 blocks
+ */
+class HostCompressor_LZ4 : public HostCompressor {
+ public:
+  size_t Compress(uint8_t* dstBytes, size_t dstLen, const uint8_t* srcBytes, size_t srcLen) override
+  {
+    return lz4_compress_block(dstBytes, dstLen, srcBytes, srcLen);
+  }
+  size_t GetMaxCompressedSize(size_t srcLen) override { return lz4_compress_bound(srcLen); }
+};
+
+/**
+ * @brief ZSTD host compressor class; produces a single Zstandard frame
+ */
+class HostCompressor_ZSTD : public HostCompressor {
+ public:
+  HostCompressor_ZSTD(int level_) : level(level_) {}
+  size_t Compress(uint8_t* dstBytes, size_t dstLen, const uint8_t* srcBytes, size_t srcLen) override
+  {
+    return (cpu_zstd_compress(srcBytes, srcLen, dstBytes, &dstLen, level) == ZSTD_STATUS_OK)
+             ? dstLen
+             : 0;
+  }
+  size_t GetMaxCompressedSize(size_t srcLen) override { return cpu_zstd_compress_bound(srcLen); }
+
+ protected:
+  const int level;
+};
+
+/**
+ * @brief CPU compression class
+ *
+ * @param[in] stream_type compression method (IO_UNCOMP_STREAM_TYPE_XXX)
+ * @param[in] level compression level, or the default level of the method if not set
+ *
+ * @returns corresponding HostCompressor class
+ */
+std::unique_ptr<HostCompressor> HostCompressor::Create(int stream_type, std::optional<int> level)
+{
+  switch (stream_type) {
+    case IO_UNCOMP_STREAM_TYPE_GZIP:
+    case IO_UNCOMP_STREAM_TYPE_INFLATE: {
+      auto const zlib_level = level.value_or(Z_DEFAULT_COMPRESSION);
+      CUDF_EXPECTS(zlib_level == Z_DEFAULT_COMPRESSION ||
+                     (zlib_level >= Z_NO_COMPRESSION && zlib_level <= Z_BEST_COMPRESSION),
+                   "Invalid DEFLATE compression level " + std::to_string(zlib_level));
+      return std::make_unique<HostCompressor_ZLIB>(stream_type == IO_UNCOMP_STREAM_TYPE_GZIP,
+                                                   zlib_level);
+    }
+    case IO_UNCOMP_STREAM_TYPE_LZ4: return std::make_unique<HostCompressor_LZ4>();
+    case IO_UNCOMP_STREAM_TYPE_ZSTD: {
+      auto const zstd_level = level.value_or(zstd_default_compression_level);
+      CUDF_EXPECTS(
+        zstd_level >= zstd_min_compression_level && zstd_level <= zstd_max_compression_level,
+        "Invalid ZSTD compression level " + std::to_string(zstd_level));
+      return std::make_unique<HostCompressor_ZSTD>(zstd_level);
+    }
+  }
+  CUDF_FAIL("Unsupported compression type");
+}
+
+void host_compress(int stream_type,
+                   std::optional<int> level,
+                   device_span<gpu_inflate_input_s const> inputs,
+                   device_span<gpu_inflate_status_s> outputs,
+                   rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(inputs.size() == outputs.size(), "Mismatched compression inputs and outputs");
+  auto compressor = HostCompressor::Create(stream_type, level);
+  if (inputs.empty()) { return; }
+
+  std::vector<gpu_inflate_input_s> h_inputs(inputs.size());
+  CUDA_TRY(cudaMemcpyAsync(h_inputs.data(),
+                           inputs.data(),
+                           inputs.size_bytes(),
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+  stream.synchronize();
+
+  // Stage all uncompressed blocks in a single host buffer
+  std::vector<size_t> src_offsets(inputs.size() + 1, 0);
+  std::vector<size_t> dst_offsets(inputs.size() + 1, 0);
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    src_offsets[i + 1] = src_offsets[i] + h_inputs[i].srcSize;
+    dst_offsets[i + 1] = dst_offsets[i] + h_inputs[i].dstSize;
+  }
+  std::vector<uint8_t> src(src_offsets.back());
+  std::vector<uint8_t> dst(dst_offsets.back());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    CUDA_TRY(cudaMemcpyAsync(src.data() + src_offsets[i],
+                             h_inputs[i].srcDevice,
+                             h_inputs[i].srcSize,
+                             cudaMemcpyDeviceToHost,
+                             stream.value()));
+  }
+  stream.synchronize();
+
+  // Blocks are independent; worker threads claim them one at a time, each with its own compressor,
+  // and the calling thread works on the batch as well
+  std::vector<gpu_inflate_status_s> h_outputs(inputs.size());
+  std::atomic<size_t> next_block{0};
+  auto work = [&](HostCompressor& block_compressor) {
+    for (auto i = next_block++; i < inputs.size(); i = next_block++) {
+      auto const written = block_compressor.Compress(dst.data() + dst_offsets[i],
+                                                     h_inputs[i].dstSize,
+                                                     src.data() + src_offsets[i],
+                                                     h_inputs[i].srcSize);
+      h_outputs[i].bytes_written = written;
+      h_outputs[i].status        = (written == 0) ? 1 : 0;
+      h_outputs[i].reserved      = 0;
+    }
+  };
+  auto& pool             = detail::host_compression_pool();
+  auto const num_workers = std::min<size_t>(pool.get_thread_count() + 1, inputs.size());
+  std::vector<std::future<void>> workers;
+  for (size_t w = 1; w < num_workers; ++w) {
+    workers.push_back(pool.submit([&]() { work(*HostCompressor::Create(stream_type, level)); }));
+  }
+  work(*compressor);
+  // Workers reference the local state; wait for all of them before reporting any error
+  for (auto& worker : workers) {
+    worker.wait();
+  }
+  for (auto& worker : workers) {
+    worker.get();
+  }
+
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    auto const written = h_outputs[i].bytes_written;
+    if (written != 0) {
+      CUDA_TRY(cudaMemcpyAsync(h_inputs[i].dstDevice,
+                               dst.data() + dst_offsets[i],
+                               written,
+                               cudaMemcpyHostToDevice,
+                               stream.value()));
+    }
+  }
+  CUDA_TRY(cudaMemcpyAsync(outputs.data(),
+                           h_outputs.data(),
+                           outputs.size_bytes(),
+                           cudaMemcpyHostToDevice,
+                           stream.value()));
+  // The staging buffers must outlive the copies
+  stream.synchronize();
+}
+
+}  // namespace io
+}  // namespace cudf
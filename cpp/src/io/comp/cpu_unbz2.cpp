@@ -82,8 +82,15 @@ For more information on these sources, see the manual.
 #include "io_uncomp.h"
 #include "unbz2.h"
 
+#include <io/utilities/file_io_utilities.hpp>
+
+#include <algorithm>
+#include <array>
 #include <cstdio>
 #include <cstdlib>
+#include <limits>
+#include <new>
+#include <numeric>
 #include <vector>
 
 namespace cudf {
@@ -597,5 +604,258 @@ int32_t cpu_bz2_uncompress(
   return ret;
 }
 
+namespace {
+
+constexpr uint64_t bz2_block_magic = 0x314159265359;  // BCD of pi
+constexpr uint64_t bz2_eos_magic   = 0x177245385090;  // BCD of sqrt(pi)
+
+/**
+ * @brief Returns the 48 bits of the data that start at the given bit offset; missing bits are zero
+ */
+uint64_t read_bits48(const uint8_t* input, size_t inlen, uint64_t bit_offset)
+{
+  size_t const byte_offset = bit_offset >> 3;
+  uint64_t bits            = 0;
+  for (size_t i = 0; i < 8; ++i) {
+    bits = (bits << 8) | ((byte_offset + i < inlen) ? input[byte_offset + i] : 0);
+  }
+  return (bits >> (16 - (bit_offset & 7))) & ((1ull << 48) - 1);
+}
+
+/**
+ * @brief Finds the bit offsets of the bzip2 block signatures within a range of bytes.
+ *
+ * @param input Compressed data
+ * @param inlen Size of the compressed data
+ * @param begin First byte in which a signature may start
+ * @param end Byte after the last one in which a signature may start
+ * @param[out] signatures Vector to which the bit offsets of the signatures are appended
+ */
+void find_block_signatures(
+  const uint8_t* input, size_t inlen, size_t begin, size_t end, std::vector<uint64_t>& signatures)
+{
+  // The byte that follows the start of a signature is one of 8 values, one per bit alignment
+  std::array<bool, 256> is_second_byte{};
+  for (int shift = 0; shift < 8; ++shift) {
+    is_second_byte[(bz2_block_magic >> (32 + shift)) & 0xff] = true;
+  }
+  for (size_t i = begin; i < end && i + 1 < inlen; ++i) {
+    if (!is_second_byte[input[i + 1]]) { continue; }
+    for (int shift = 0; shift < 8; ++shift) {
+      uint64_t const bit_offset = i * 8 + shift;
+      if (read_bits48(input, inlen, bit_offset) == bz2_block_magic) {
+        signatures.push_back(bit_offset);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Decodes the bzip2 block that starts at the given bit offset, except for the final
+ * run-length decoding, which `unrle_block` performs.
+ *
+ * @param[in] input Compressed data
+ * @param[in] inlen Size of the compressed data
+ * @param[in] bit_offset Bit offset of the block signature
+ * @param[out] s Decoder state of the block
+ * @param[out] size Size of the uncompressed data of the block
+ * @param[out] end_bit Bit offset of the next block signature, or of the end of the end-of-stream
+ * signature if the block is the last one of a stream
+ *
+ * @return BZ_OK, BZ_STREAM_END if the block is the last one of a stream, or an error code
+ */
+int32_t decode_block_at(const uint8_t* input,
+                        size_t inlen,
+                        uint64_t bit_offset,
+                        unbz_state_s& s,
+                        size_t* size,
+                        uint64_t* end_bit)
+{
+  s.base = input;
+  s.end  = input + inlen - 4;  // Do not read the combined CRC of the last stream
+  s.cur  = input + (bit_offset >> 3);
+  if (s.cur + 8 > s.end) { return BZ_PARAM_ERROR; }
+  s.bitbuf = __builtin_bswap64(*reinterpret_cast<const uint64_t*>(s.cur));
+  s.bitpos = static_cast<uint32_t>(bit_offset & 7);
+  // Streams may use different block sizes; allow the largest one
+  s.blockSize100k = 9;
+  s.tt.resize(s.blockSize100k * 100000);
+
+  auto const ret = bz2_decompress_block(&s);
+  if (ret != BZ_OK && ret != BZ_STREAM_END) { return ret; }
+  // The output size is only known after the run-length decoding; count it without writing
+  uint8_t none;
+  s.out     = &none;
+  s.outend  = s.out;
+  s.outbase = s.out;
+  bzUnRLE(&s);
+  if (s.nblock_used != s.save_nblock + 1) { return BZ_DATA_ERROR; }
+  *size    = static_cast<size_t>(s.out - s.outbase);
+  *end_bit = ((s.cur - s.base) << 3) + s.bitpos;
+  return ret;
+}
+
+/**
+ * @brief Writes the uncompressed data of a block decoded with `decode_block_at`.
+ *
+ * @param s Decoder state of the block
+ * @param dst Destination of the uncompressed data; its size is the one returned by
+ * `decode_block_at`
+ */
+void unrle_block(unbz_state_s& s, host_span<char> dst)
+{
+  s.out     = reinterpret_cast<uint8_t*>(dst.data());
+  s.outend  = s.out + dst.size();
+  s.outbase = s.out;
+  bzUnRLE(&s);
+}
+
+}  // namespace
+
+bz2_block_decoder::bz2_block_decoder(const uint8_t* input, size_t inlen)
+  : _input(input), _inlen(inlen)
+{
+  // Scan slices of the data in parallel
+  auto& pool                   = detail::host_decompression_pool();
+  constexpr size_t slice_bytes = 4 * 1024 * 1024;
+  size_t const num_slices      = std::max<size_t>((inlen + slice_bytes - 1) / slice_bytes, 1);
+  std::vector<std::vector<uint64_t>> slice_signatures(num_slices);
+  detail::parallel_for(pool, 0, num_slices, [&](size_t i) {
+    find_block_signatures(input,
+                          inlen,
+                          i * slice_bytes,
+                          std::min((i + 1) * slice_bytes, inlen),
+                          slice_signatures[i]);
+  });
+  for (auto const& signatures : slice_signatures) {
+    _signatures.insert(_signatures.end(), signatures.cbegin(), signatures.cend());
+  }
+}
+
+/**
+ * @brief Starts decoding the stream that starts at the given byte, if any.
+ *
+ * @return false if the data does not start a stream at the given byte
+ */
+bool bz2_block_decoder::start_stream(size_t byte_offset)
+{
+  auto const* hdr = _input + byte_offset;
+  if (byte_offset + 4 > _inlen || hdr[0] != BZ_HDR_B || hdr[1] != BZ_HDR_Z || hdr[2] != BZ_HDR_h ||
+      hdr[3] < BZ_HDR_0 + 1 || hdr[3] > BZ_HDR_0 + 9) {
+    return false;
+  }
+  _next_block = (byte_offset + 4) * 8;
+  return true;
+}
+
+/**
+ * @brief Moves to the next stream, if any, after the end-of-stream signature of a stream.
+ *
+ * @param end_bit Bit offset of the end of the end-of-stream signature
+ */
+void bz2_block_decoder::end_stream(uint64_t end_bit)
+{
+  // The combined CRC follows the signature; the stream is padded to a whole byte
+  auto const next_stream = (end_bit + 32 + 7) / 8;
+  if (!start_stream(next_stream)) { _is_done = true; }
+}
+
+template <typename Allocate>
+int32_t bz2_block_decoder::decode_blocks(size_t max_blocks, Allocate const& allocate)
+{
+  if (!_is_started) {
+    if (!start_stream(0)) { return BZ_DATA_ERROR_MAGIC; }
+    _is_started = true;
+  }
+  auto& pool = detail::host_decompression_pool();
+  // Each decoder state holds the transformed data of a block until it is written out
+  auto const batch_size = std::max<size_t>(pool.get_thread_count(), 1);
+  size_t num_decoded    = 0;
+  while (!_is_done && num_decoded < max_blocks) {
+    if (read_bits48(_input, _inlen, _next_block) == bz2_eos_magic) {
+      // Stream without (other) blocks
+      end_stream(_next_block + 48);
+      continue;
+    }
+    // Skip the signatures found within the blocks decoded so far
+    while (_next_signature < _signatures.size() && _signatures[_next_signature] < _next_block) {
+      ++_next_signature;
+    }
+    if (_next_signature == _signatures.size() || _signatures[_next_signature] != _next_block) {
+      return BZ_DATA_ERROR;
+    }
+
+    // Decode the next candidate blocks in parallel
+    auto const count =
+      std::min({max_blocks - num_decoded, _signatures.size() - _next_signature, batch_size});
+    std::vector<unbz_state_s> states(count);
+    std::vector<size_t> sizes(count);
+    std::vector<uint64_t> end_bits(count);
+    std::vector<int32_t> results(count);
+    detail::parallel_for(pool, 0, count, [&](size_t i) {
+      results[i] = decode_block_at(
+        _input, _inlen, _signatures[_next_signature + i], states[i], &sizes[i], &end_bits[i]);
+    });
+
+    // Chain the blocks from the expected position of the next block
+    std::vector<size_t> chained;
+    for (size_t i = 0; i < count && !_is_done; ++i, ++_next_signature) {
+      auto const bit_offset = _signatures[_next_signature];
+      if (bit_offset < _next_block) { continue; }
+      if (bit_offset > _next_block) { break; }
+      if (results[i] != BZ_OK && results[i] != BZ_STREAM_END) { return results[i]; }
+      chained.push_back(i);
+      _next_block = end_bits[i];
+      if (results[i] == BZ_STREAM_END) { end_stream(_next_block); }
+    }
+    num_decoded += chained.size();
+
+    // Write the uncompressed data of the chained blocks directly to their destinations
+    std::vector<size_t> chained_sizes(chained.size());
+    std::transform(
+      chained.cbegin(), chained.cend(), chained_sizes.begin(), [&](auto i) { return sizes[i]; });
+    auto const dsts = allocate(chained_sizes);
+    detail::parallel_for(pool, 0, chained.size(), [&](size_t j) {
+      unrle_block(states[chained[j]], {dsts[j], chained_sizes[j]});
+    });
+  }
+  return BZ_OK;
+}
+
+int32_t bz2_block_decoder::decode(size_t max_blocks, std::vector<std::vector<char>>& blocks)
+{
+  // Allocation failures of the decoding threads are rethrown here and reported as an error code
+  try {
+    return decode_blocks(max_blocks, [&](std::vector<size_t> const& sizes) {
+      std::vector<char*> dsts;
+      for (auto const size : sizes) {
+        blocks.emplace_back(size);
+        dsts.push_back(blocks.back().data());
+      }
+      return dsts;
+    });
+  } catch (std::bad_alloc const&) {
+    return BZ_MEM_ERROR;
+  }
+}
+
+int32_t bz2_block_decoder::decode(std::vector<char>& dst)
+{
+  try {
+    return decode_blocks(std::numeric_limits<size_t>::max(), [&](std::vector<size_t> const& sizes) {
+      auto offset = dst.size();
+      dst.resize(offset + std::accumulate(sizes.cbegin(), sizes.cend(), size_t{0}));
+      std::vector<char*> dsts;
+      for (auto const size : sizes) {
+        dsts.push_back(dst.data() + offset);
+        offset += size;
+      }
+      return dsts;
+    });
+  } catch (std::bad_alloc const&) {
+    return BZ_MEM_ERROR;
+  }
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -0,0 +1,820 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file cpu_unzstd.cpp
+ * @brief Host Zstandard decoder, following the format description of RFC 8878
+ *
+ * Used by the readers for Zstandard-compressed data when device decompression is not available.
+ */
+
+#include "unzstd.h"
+#include "zstd_common.h"
+
+#include <io/parquet/bloom_filter.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace {
+
+using namespace zstd;
+using parquet::xxhash64;
+
+/**
+ * @brief Raised by the decoding functions; converted to a status code by the entry points
+ */
+struct zstd_error {
+  int32_t status;
+};
+
+inline void check(bool condition, int32_t status = ZSTD_STATUS_DATA_ERROR)
+{
+  if (!condition) { throw zstd_error{status}; }
+}
+
+inline uint32_t read_le16(uint8_t const* p) { return p[0] | (p[1] << 8); }
+
+inline uint32_t read_le24(uint8_t const* p) { return p[0] | (p[1] << 8) | (p[2] << 16); }
+
+inline uint32_t read_le32(uint8_t const* p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+/**
+ * @brief Reads `num_bits` (at most 32) bits starting at bit `bit_offset`, least significant first
+ */
+inline uint64_t read_bits_le(uint8_t const* src, int num_bits, size_t bit_offset)
+{
+  if (num_bits == 0) { return 0; }
+  auto byte        = bit_offset >> 3;
+  auto const shift = static_cast<int>(bit_offset & 7);
+  uint64_t bits    = 0;
+  for (int pos = 0; pos < num_bits + shift; pos += 8) {
+    bits |= uint64_t{src[byte++]} << pos;
+  }
+  return (bits >> shift) & ((uint64_t{1} << num_bits) - 1);
+}
+
+/**
+ * @brief Reader for the forward bit streams of the FSE table descriptions
+ *
+ * Bits past the end of the buffer read as zero; callers check the consumed size afterwards.
+ */
+class forward_bit_reader {
+ public:
+  forward_bit_reader(uint8_t const* src, size_t len) : _src(src), _len(len) {}
+
+  uint32_t read(int num_bits)
+  {
+    auto const bits_left = static_cast<int64_t>(_len * 8) - static_cast<int64_t>(_pos);
+    auto const available = static_cast<int>(std::clamp<int64_t>(bits_left, 0, num_bits));
+    auto const bits      = static_cast<uint32_t>(read_bits_le(_src, available, _pos));
+    _pos += num_bits;
+    return bits;
+  }
+
+  void rewind(int num_bits) { _pos -= num_bits; }
+
+  [[nodiscard]] size_t bytes_consumed() const { return (_pos + 7) / 8; }
+
+ private:
+  uint8_t const* _src;
+  size_t _len;
+  size_t _pos = 0;
+};
+
+/**
+ * @brief Reader for the backward bit streams of the Huffman and FSE-coded data
+ *
+ * The stream starts at the highest set bit of its last byte. Reading past the beginning of the
+ * stream returns zero bits, and leaves a negative number of remaining bits.
+ */
+class backward_bit_reader {
+ public:
+  backward_bit_reader(uint8_t const* src, size_t len) : _src(src)
+  {
+    check(len > 0 && src[len - 1] != 0);
+    _offset = static_cast<int64_t>(len - 1) * 8 + highest_set_bit(src[len - 1]);
+  }
+
+  uint32_t read(int num_bits)
+  {
+    _offset -= num_bits;
+    if (_offset >= 0) { return static_cast<uint32_t>(read_bits_le(_src, num_bits, _offset)); }
+    auto const available = num_bits + _offset;
+    if (available <= 0) { return 0; }
+    return static_cast<uint32_t>(read_bits_le(_src, available, 0) << -_offset);
+  }
+
+  [[nodiscard]] int64_t bits_remaining() const { return _offset; }
+
+ private:
+  uint8_t const* _src;
+  int64_t _offset = 0;
+};
+
+/**
+ * @brief Finite State Entropy decoding table
+ */
+struct fse_table {
+  int accuracy_log = 0;
+  std::vector<uint8_t> symbols;
+  std::vector<uint8_t> num_bits;
+  std::vector<uint16_t> new_state_base;
+};
+
+void build_fse_table(fse_table& table, int16_t const* dist, int num_symbols, int accuracy_log)
+{
+  auto const size    = size_t{1} << accuracy_log;
+  table.accuracy_log = accuracy_log;
+  table.symbols.assign(size, 0);
+  table.num_bits.assign(size, 0);
+  table.new_state_base.assign(size, 0);
+
+  // Symbols with a "less than one" probability take the last cells of the table
+  std::array<uint32_t, huffman_max_symbols> next_state{};
+  auto high_threshold = size;
+  for (int s = 0; s < num_symbols; ++s) {
+    if (dist[s] == -1) {
+      table.symbols[--high_threshold] = static_cast<uint8_t>(s);
+      next_state[s]                   = 1;
+    }
+  }
+  // Spread the other symbols over the remaining cells
+  auto const step = (size >> 1) + (size >> 3) + 3;
+  auto const mask = size - 1;
+  size_t pos      = 0;
+  for (int s = 0; s < num_symbols; ++s) {
+    if (dist[s] <= 0) { continue; }
+    next_state[s] = dist[s];
+    for (int i = 0; i < dist[s]; ++i) {
+      table.symbols[pos] = static_cast<uint8_t>(s);
+      do {
+        pos = (pos + step) & mask;
+      } while (pos >= high_threshold);
+    }
+  }
+  check(pos == 0);
+
+  for (size_t i = 0; i < size; ++i) {
+    auto const state        = next_state[table.symbols[i]]++;
+    auto const bits         = accuracy_log - highest_set_bit(state);
+    table.num_bits[i]       = static_cast<uint8_t>(bits);
+    table.new_state_base[i] = static_cast<uint16_t>((state << bits) - size);
+  }
+}
+
+void build_rle_fse_table(fse_table& table, uint8_t symbol)
+{
+  table.accuracy_log   = 0;
+  table.symbols        = {symbol};
+  table.num_bits       = {0};
+  table.new_state_base = {0};
+}
+
+/**
+ * @brief Reads an FSE table description and builds the corresponding decoding table
+ *
+ * @return The size of the description, in bytes
+ */
+size_t read_fse_table(
+  fse_table& table, uint8_t const* src, size_t len, int max_accuracy_log, int max_symbol)
+{
+  forward_bit_reader reader(src, len);
+  auto const accuracy_log = static_cast<int>(reader.read(4)) + 5;
+  check(accuracy_log <= max_accuracy_log);
+
+  std::array<int16_t, huffman_max_symbols> dist{};
+  int remaining   = 1 << accuracy_log;
+  int num_symbols = 0;
+  while (remaining > 0 && num_symbols <= max_symbol) {
+    auto const bits       = highest_set_bit(remaining + 1) + 1;
+    auto value            = reader.read(bits);
+    auto const lower_mask = (1u << (bits - 1)) - 1;
+    auto const threshold  = (1u << bits) - 1 - (remaining + 1);
+    if ((value & lower_mask) < threshold) {
+      reader.rewind(1);
+      value &= lower_mask;
+    } else if (value > lower_mask) {
+      value -= threshold;
+    }
+    auto const probability = static_cast<int16_t>(value) - 1;
+    remaining -= std::abs(probability);
+    dist[num_symbols++] = static_cast<int16_t>(probability);
+    if (probability == 0) {
+      // Runs of zero probabilities are coded as repeat flags
+      uint32_t repeat;
+      do {
+        repeat = reader.read(2);
+        for (uint32_t i = 0; i < repeat && num_symbols <= max_symbol; ++i) {
+          dist[num_symbols++] = 0;
+        }
+      } while (repeat == 3);
+    }
+  }
+  check(remaining == 0 && reader.bytes_consumed() <= len);
+
+  build_fse_table(table, dist.data(), num_symbols, accuracy_log);
+  return reader.bytes_consumed();
+}
+
+/**
+ * @brief Decoding state of an FSE-coded stream
+ */
+struct fse_state {
+  fse_table const* table = nullptr;
+  uint32_t state         = 0;
+
+  void init(backward_bit_reader& reader) { state = reader.read(table->accuracy_log); }
+
+  [[nodiscard]] uint8_t peek() const { return table->symbols[state]; }
+
+  void update(backward_bit_reader& reader)
+  {
+    state = table->new_state_base[state] + reader.read(table->num_bits[state]);
+  }
+};
+
+/**
+ * @brief Huffman decoding table for the literals
+ */
+struct huffman_table {
+  int max_bits = 0;
+  std::vector<uint8_t> symbols;
+  std::vector<uint8_t> num_bits;
+};
+
+void build_huffman_table(huffman_table& table, uint8_t const* weights, int num_weights)
+{
+  check(num_weights > 0 && num_weights < huffman_max_symbols);
+
+  // The weight of the last symbol is implied by the others
+  uint32_t weight_sum = 0;
+  for (int i = 0; i < num_weights; ++i) {
+    check(weights[i] <= huffman_max_bits);
+    if (weights[i] > 0) { weight_sum += 1u << (weights[i] - 1); }
+  }
+  check(weight_sum > 0);
+  auto const max_bits = highest_set_bit(weight_sum) + 1;
+  auto const left     = (1u << max_bits) - weight_sum;
+  check(max_bits <= huffman_max_bits && (left & (left - 1)) == 0);
+
+  auto const num_symbols = num_weights + 1;
+  std::array<uint8_t, huffman_max_symbols> bits{};
+  for (int i = 0; i < num_symbols; ++i) {
+    auto const weight = (i < num_weights) ? weights[i] : highest_set_bit(left) + 1;
+    bits[i]           = weight > 0 ? static_cast<uint8_t>(max_bits + 1 - weight) : 0;
+  }
+
+  // Codes are assigned in order of increasing length, then symbol value
+  auto const table_size = size_t{1} << max_bits;
+  table.max_bits        = max_bits;
+  table.symbols.assign(table_size, 0);
+  table.num_bits.assign(table_size, 0);
+  std::array<uint32_t, huffman_max_bits + 2> rank_count{};
+  for (int i = 0; i < num_symbols; ++i) {
+    ++rank_count[bits[i]];
+  }
+  std::array<uint32_t, huffman_max_bits + 2> rank_idx{};
+  for (int i = max_bits; i >= 1; --i) {
+    rank_idx[i - 1] = rank_idx[i] + rank_count[i] * (1u << (max_bits - i));
+    check(rank_idx[i - 1] <= table_size);
+    std::fill(table.num_bits.begin() + rank_idx[i], table.num_bits.begin() + rank_idx[i - 1], i);
+  }
+  check(rank_idx[0] == table_size);
+  for (int i = 0; i < num_symbols; ++i) {
+    if (bits[i] == 0) { continue; }
+    auto const code  = rank_idx[bits[i]];
+    auto const count = 1u << (max_bits - bits[i]);
+    std::fill(table.symbols.begin() + code, table.symbols.begin() + code + count, i);
+    rank_idx[bits[i]] += count;
+  }
+}
+
+/**
+ * @brief Reads a Huffman tree description and builds the corresponding decoding table
+ *
+ * @return The size of the description, in bytes
+ */
+size_t read_huffman_table(huffman_table& table, uint8_t const* src, size_t len)
+{
+  check(len >= 1);
+  std::array<uint8_t, huffman_max_symbols> weights{};
+  int num_weights    = 0;
+  auto const header  = src[0];
+  size_t description = 0;
+  if (header >= 128) {
+    // Weights are stored directly, as 4-bit values
+    num_weights = header - 127;
+    description = 1 + (num_weights + 1) / 2;
+    check(description <= len);
+    for (int i = 0; i < num_weights; ++i) {
+      auto const byte = src[1 + i / 2];
+      weights[i]      = (i % 2 == 0) ? (byte >> 4) : (byte & 0xf);
+    }
+  } else {
+    // Weights are FSE-compressed, with two interleaved states
+    description = 1 + header;
+    check(description <= len);
+    fse_table weight_table;
+    auto const table_size =
+      read_fse_table(weight_table, src + 1, header, weights_max_accuracy, huffman_max_symbols - 1);
+    check(table_size < header);
+    backward_bit_reader reader(src + 1 + table_size, header - table_size);
+    fse_state states[2] = {{&weight_table}, {&weight_table}};
+    states[0].init(reader);
+    states[1].init(reader);
+    for (int s = 0;; s ^= 1) {
+      check(num_weights < huffman_max_symbols - 1);
+      weights[num_weights++] = states[s].peek();
+      states[s].update(reader);
+      if (reader.bits_remaining() < 0) {
+        check(num_weights < huffman_max_symbols - 1);
+        weights[num_weights++] = states[s ^ 1].peek();
+        break;
+      }
+    }
+  }
+  build_huffman_table(table, weights.data(), num_weights);
+  return description;
+}
+
+void decode_huffman_stream(
+  huffman_table const& table, uint8_t const* src, size_t len, uint8_t* out, size_t num_out)
+{
+  backward_bit_reader reader(src, len);
+  auto const mask = (1u << table.max_bits) - 1;
+  uint32_t state  = reader.read(table.max_bits);
+  for (size_t i = 0; i < num_out; ++i) {
+    out[i]          = table.symbols[state];
+    auto const bits = table.num_bits[state];
+    state           = ((state << bits) + reader.read(bits)) & mask;
+  }
+  check(reader.bits_remaining() == -table.max_bits);
+}
+
+/**
+ * @brief Decoding tables and history that carry over from one block to the next in a frame
+ */
+struct frame_state {
+  huffman_table literals_tree;
+  bool has_literals_tree = false;
+  fse_table literals_length_table;
+  fse_table offset_table;
+  fse_table match_length_table;
+  bool has_sequence_tables = false;
+  std::array<uint64_t, 3> repeat_offsets{1, 4, 8};
+  std::vector<uint8_t> literals;
+};
+
+/**
+ * @brief Decodes the literals section of a compressed block into `state.literals`
+ *
+ * @return The size of the literals section, in bytes
+ */
+size_t decode_literals(frame_state& state, uint8_t const* src, size_t len)
+{
+  check(len >= 1);
+  auto const block_type  = src[0] & 3;
+  auto const size_format = (src[0] >> 2) & 3;
+
+  if (block_type < 2) {
+    // Raw or RLE literals
+    size_t header_size = 1;
+    uint32_t size      = src[0] >> 3;
+    if (size_format == 1) {
+      header_size = 2;
+      check(len >= header_size);
+      size = (src[0] >> 4) + (src[1] << 4);
+    } else if (size_format == 3) {
+      header_size = 3;
+      check(len >= header_size);
+      size = (src[0] >> 4) + (src[1] << 4) + (src[2] << 12);
+    }
+    check(size <= max_block_size);
+    if (block_type == 0) {
+      check(header_size + size <= len);
+      state.literals.assign(src + header_size, src + header_size + size);
+      return header_size + size;
+    }
+    check(header_size + 1 <= len);
+    state.literals.assign(size, src[header_size]);
+    return header_size + 1;
+  }
+
+  // Huffman-coded literals, with a new tree or the tree of the previous block
+  auto const num_streams = (size_format == 0) ? 1 : 4;
+  auto const header_size = size_t{size_format < 2 ? 3u : size_format + 2u};
+  auto const size_bits   = size_format < 2 ? 10 : 4 * size_format + 6;
+  check(len >= header_size);
+  uint64_t header = 0;
+  for (size_t i = 0; i < header_size; ++i) {
+    header |= uint64_t{src[i]} << (8 * i);
+  }
+  auto const size_mask       = (uint64_t{1} << size_bits) - 1;
+  auto const regenerated     = static_cast<size_t>((header >> 4) & size_mask);
+  auto const compressed_size = static_cast<size_t>((header >> (4 + size_bits)) & size_mask);
+  check(regenerated <= max_block_size && header_size + compressed_size <= len);
+
+  auto data      = src + header_size;
+  auto data_size = compressed_size;
+  if (block_type == 2) {
+    auto const tree_size = read_huffman_table(state.literals_tree, data, data_size);
+    data += tree_size;
+    data_size -= tree_size;
+    state.has_literals_tree = true;
+  }
+  check(state.has_literals_tree);
+
+  state.literals.resize(regenerated);
+  if (num_streams == 1) {
+    decode_huffman_stream(state.literals_tree, data, data_size, state.literals.data(), regenerated);
+  } else {
+    check(data_size >= 6);
+    size_t stream_sizes[4] = {read_le16(data), read_le16(data + 2), read_le16(data + 4), 0};
+    auto const jump_sizes  = 6 + stream_sizes[0] + stream_sizes[1] + stream_sizes[2];
+    check(jump_sizes <= data_size);
+    stream_sizes[3]         = data_size - jump_sizes;
+    auto const segment_size = (regenerated + 3) / 4;
+    check(3 * segment_size <= regenerated);
+    auto stream = data + 6;
+    for (int i = 0; i < 4; ++i) {
+      auto const out_size = (i < 3) ? segment_size : regenerated - 3 * segment_size;
+      decode_huffman_stream(state.literals_tree,
+                            stream,
+                            stream_sizes[i],
+                            state.literals.data() + i * segment_size,
+                            out_size);
+      stream += stream_sizes[i];
+    }
+  }
+  return header_size + compressed_size;
+}
+
+/**
+ * @brief Updates a sequence decoding table according to its compression mode
+ *
+ * @return The size of the table description, in bytes
+ */
+template <size_t N>
+size_t update_sequence_table(fse_table& table,
+                             int mode,
+                             uint8_t const* src,
+                             size_t len,
+                             std::array<int16_t, N> const& default_dist,
+                             int default_accuracy,
+                             int max_accuracy,
+                             int max_symbol,
+                             bool has_tables)
+{
+  switch (mode) {
+    case 0:  // Predefined
+      build_fse_table(table, default_dist.data(), N, default_accuracy);
+      return 0;
+    case 1:  // RLE
+      check(len >= 1 && src[0] <= max_symbol);
+      build_rle_fse_table(table, src[0]);
+      return 1;
+    case 2:  // FSE-compressed
+      return read_fse_table(table, src, len, max_accuracy, max_symbol);
+    default:  // Repeat
+      check(has_tables);
+      return 0;
+  }
+}
+
+/**
+ * @brief Returns the match offset of a sequence and updates the repeat offsets
+ */
+uint64_t resolve_offset(std::array<uint64_t, 3>& repeat, uint64_t offset_value, uint32_t literals)
+{
+  if (offset_value > 3) {
+    repeat[2] = repeat[1];
+    repeat[1] = repeat[0];
+    repeat[0] = offset_value - 3;
+    return repeat[0];
+  }
+  auto idx = offset_value - 1 + (literals == 0 ? 1 : 0);
+  if (idx == 0) { return repeat[0]; }
+  auto const offset = (idx < 3) ? repeat[idx] : repeat[0] - 1;
+  if (idx > 1) { repeat[2] = repeat[1]; }
+  repeat[1] = repeat[0];
+  repeat[0] = offset;
+  return offset;
+}
+
+/**
+ * @brief Decodes a compressed block and writes its content at `dst + out_pos`
+ */
+void decode_compressed_block(frame_state& state,
+                             uint8_t const* src,
+                             size_t len,
+                             uint8_t* dst,
+                             size_t dst_len,
+                             size_t frame_start,
+                             size_t& out_pos)
+{
+  auto const literals_size = decode_literals(state, src, len);
+  src += literals_size;
+  len -= literals_size;
+
+  check(len >= 1);
+  uint32_t num_sequences = src[0];
+  size_t pos             = 1;
+  if (num_sequences >= 255) {
+    check(len >= 3);
+    num_sequences = src[1] + (src[2] << 8) + 0x7F00;
+    pos           = 3;
+  } else if (num_sequences >= 128) {
+    check(len >= 2);
+    num_sequences = ((num_sequences - 128) << 8) + src[1];
+    pos           = 2;
+  }
+
+  auto const& literals = state.literals;
+  size_t literals_pos  = 0;
+  auto copy_literals   = [&](size_t count) {
+    check(literals_pos + count <= literals.size());
+    check(out_pos + count <= dst_len, ZSTD_STATUS_OUTBUFF_FULL);
+    std::memcpy(dst + out_pos, literals.data() + literals_pos, count);
+    literals_pos += count;
+    out_pos += count;
+  };
+
+  if (num_sequences > 0) {
+    check(pos < len);
+    auto const modes = src[pos++];
+    check((modes & 3) == 0);
+    pos += update_sequence_table(state.literals_length_table,
+                                 modes >> 6,
+                                 src + pos,
+                                 len - pos,
+                                 default_literals_length_dist,
+                                 default_literals_length_accuracy,
+                                 literals_max_accuracy,
+                                 max_literals_length_code,
+                                 state.has_sequence_tables);
+    check(pos <= len);
+    pos += update_sequence_table(state.offset_table,
+                                 (modes >> 4) & 3,
+                                 src + pos,
+                                 len - pos,
+                                 default_offset_dist,
+                                 default_offset_accuracy,
+                                 offsets_max_accuracy,
+                                 max_offset_code,
+                                 state.has_sequence_tables);
+    check(pos <= len);
+    pos += update_sequence_table(state.match_length_table,
+                                 (modes >> 2) & 3,
+                                 src + pos,
+                                 len - pos,
+                                 default_match_length_dist,
+                                 default_match_length_accuracy,
+                                 matches_max_accuracy,
+                                 max_match_length_code,
+                                 state.has_sequence_tables);
+    check(pos < len);
+    state.has_sequence_tables = true;
+
+    backward_bit_reader reader(src + pos, len - pos);
+    fse_state literals_length{&state.literals_length_table};
+    fse_state offset{&state.offset_table};
+    fse_state match_length{&state.match_length_table};
+    literals_length.init(reader);
+    offset.init(reader);
+    match_length.init(reader);
+
+    for (uint32_t s = 0; s < num_sequences; ++s) {
+      auto const offset_code          = offset.peek();
+      auto const match_length_code    = match_length.peek();
+      auto const literals_length_code = literals_length.peek();
+      check(offset_code <= max_offset_code);
+      check(match_length_code <= max_match_length_code);
+      check(literals_length_code <= max_literals_length_code);
+
+      auto const offset_value = (uint64_t{1} << offset_code) + reader.read(offset_code);
+      auto const match_bytes  = match_length_base[match_length_code] +
+                               reader.read(match_length_bits[match_length_code]);
+      auto const literal_bytes = literals_length_base[literals_length_code] +
+                                 reader.read(literals_length_bits[literals_length_code]);
+      if (s + 1 < num_sequences) {
+        literals_length.update(reader);
+        match_length.update(reader);
+        offset.update(reader);
+      }
+
+      copy_literals(literal_bytes);
+      auto const match_offset = resolve_offset(state.repeat_offsets, offset_value, literal_bytes);
+      check(match_offset > 0 && match_offset <= out_pos - frame_start);
+      check(out_pos + match_bytes <= dst_len, ZSTD_STATUS_OUTBUFF_FULL);
+      auto const match_src = dst + out_pos - match_offset;
+      if (match_offset >= match_bytes) {
+        std::memcpy(dst + out_pos, match_src, match_bytes);
+      } else {
+        // Overlapping copy repeats the last `match_offset` bytes
+        for (uint32_t i = 0; i < match_bytes; ++i) {
+          dst[out_pos + i] = match_src[i];
+        }
+      }
+      out_pos += match_bytes;
+    }
+    check(reader.bits_remaining() == 0);
+  }
+  copy_literals(literals.size() - literals_pos);
+}
+
+/**
+ * @brief Parsed frame header
+ */
+struct frame_header {
+  size_t header_size;
+  bool has_checksum;
+  bool has_content_size;
+  uint64_t content_size;
+};
+
+frame_header parse_frame_header(uint8_t const* src, size_t len)
+{
+  check(len >= 5 && read_le32(src) == zstd_magic);
+  auto const descriptor      = src[4];
+  auto const content_flag    = descriptor >> 6;
+  auto const single_segment  = (descriptor >> 5) & 1;
+  auto const dictionary_flag = descriptor & 3;
+  check((descriptor & 0x08) == 0);
+
+  frame_header header{};
+  header.has_checksum     = (descriptor >> 2) & 1;
+  size_t pos              = 5 + (single_segment ? 0 : 1);
+  auto const dict_id_size = size_t{dictionary_flag == 3 ? 4u : dictionary_flag};
+  check(pos + dict_id_size <= len);
+  uint32_t dictionary_id = 0;
+  for (size_t i = 0; i < dict_id_size; ++i) {
+    dictionary_id |= src[pos + i] << (8 * i);
+  }
+  check(dictionary_id == 0, ZSTD_STATUS_UNSUPPORTED);
+  pos += dict_id_size;
+
+  auto const content_size_bytes =
+    size_t{content_flag == 0 ? (single_segment ? 1u : 0u) : (1u << content_flag)};
+  check(pos + content_size_bytes <= len);
+  header.has_content_size = content_size_bytes > 0;
+  header.content_size     = 0;
+  for (size_t i = 0; i < content_size_bytes; ++i) {
+    header.content_size |= uint64_t{src[pos + i]} << (8 * i);
+  }
+  if (content_size_bytes == 2) { header.content_size += 256; }
+  header.header_size = pos + content_size_bytes;
+  return header;
+}
+
+/**
+ * @brief Returns the size of a skippable frame, or 0 if `src` does not start one
+ */
+size_t skippable_frame_size(uint8_t const* src, size_t len)
+{
+  if (len < 4 || (read_le32(src) & skippable_magic_mask) != skippable_magic) { return 0; }
+  check(len >= 8);
+  auto const size = size_t{8} + read_le32(src + 4);
+  check(size <= len);
+  return size;
+}
+
+/**
+ * @brief Decodes a frame and appends its content at `dst + out_pos`
+ *
+ * @return The size of the frame, in bytes
+ */
+size_t decode_frame(uint8_t const* src, size_t len, uint8_t* dst, size_t dst_len, size_t& out_pos)
+{
+  if (auto const skip = skippable_frame_size(src, len); skip > 0) { return skip; }
+
+  auto const header      = parse_frame_header(src, len);
+  auto const frame_start = out_pos;
+  frame_state state;
+  auto pos = header.header_size;
+  while (true) {
+    check(pos + 3 <= len);
+    auto const block_header = read_le24(src + pos);
+    auto const is_last      = block_header & 1;
+    auto const block_type   = (block_header >> 1) & 3;
+    auto const block_size   = size_t{block_header >> 3};
+    pos += 3;
+    switch (block_type) {
+      case 0:  // Raw
+        check(pos + block_size <= len);
+        check(out_pos + block_size <= dst_len, ZSTD_STATUS_OUTBUFF_FULL);
+        std::memcpy(dst + out_pos, src + pos, block_size);
+        out_pos += block_size;
+        pos += block_size;
+        break;
+      case 1:  // RLE
+        check(pos + 1 <= len);
+        check(out_pos + block_size <= dst_len, ZSTD_STATUS_OUTBUFF_FULL);
+        std::memset(dst + out_pos, src[pos], block_size);
+        out_pos += block_size;
+        pos += 1;
+        break;
+      case 2:  // Compressed
+        check(block_size <= max_block_size && pos + block_size <= len);
+        decode_compressed_block(state, src + pos, block_size, dst, dst_len, frame_start, out_pos);
+        pos += block_size;
+        break;
+      default: check(false);
+    }
+    if (is_last) { break; }
+  }
+  if (header.has_checksum) {
+    // The checksum is the low 32 bits of the XXH64 of the frame content
+    check(pos + 4 <= len);
+    auto const checksum = static_cast<uint32_t>(xxhash64(dst + frame_start, out_pos - frame_start));
+    check(checksum == read_le32(src + pos), ZSTD_STATUS_CHECKSUM);
+    pos += 4;
+  }
+  check(!header.has_content_size || out_pos - frame_start == header.content_size);
+  return pos;
+}
+
+/**
+ * @brief Returns the size of a frame, and its content size if the header stores it
+ */
+size_t frame_size(uint8_t const* src, size_t len, uint64_t& content_size, bool& has_content_size)
+{
+  if (auto const skip = skippable_frame_size(src, len); skip > 0) {
+    content_size     = 0;
+    has_content_size = true;
+    return skip;
+  }
+  auto const header = parse_frame_header(src, len);
+  content_size      = header.content_size;
+  has_content_size  = header.has_content_size;
+  auto pos          = header.header_size;
+  while (true) {
+    check(pos + 3 <= len);
+    auto const block_header = read_le24(src + pos);
+    auto const block_type   = (block_header >> 1) & 3;
+    check(block_type != 3);
+    pos += 3 + (block_type == 1 ? 1 : (block_header >> 3));
+    if (block_header & 1) { break; }
+  }
+  return pos + (header.has_checksum ? 4 : 0);
+}
+
+}  // namespace
+
+int32_t cpu_zstd_uncompress(const uint8_t* input, size_t inlen, uint8_t* dst, size_t* dstlen)
+{
+  try {
+    check(input != nullptr && inlen > 0);
+    size_t pos     = 0;
+    size_t out_pos = 0;
+    while (pos < inlen) {
+      pos += decode_frame(input + pos, inlen - pos, dst, *dstlen, out_pos);
+    }
+    *dstlen = out_pos;
+    return ZSTD_STATUS_OK;
+  } catch (zstd_error const& error) {
+    return error.status;
+  }
+}
+
+size_t cpu_zstd_decompressed_size(const uint8_t* input, size_t inlen)
+{
+  try {
+    size_t pos   = 0;
+    size_t total = 0;
+    while (pos < inlen) {
+      uint64_t content_size = 0;
+      bool has_content_size = false;
+      pos += frame_size(input + pos, inlen - pos, content_size, has_content_size);
+      if (!has_content_size) { return 0; }
+      total += content_size;
+    }
+    return total;
+  } catch (zstd_error const&) {
+    return 0;
+  }
+}
+
+}  // namespace io
+}  // namespace cudf
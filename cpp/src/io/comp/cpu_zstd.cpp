@@ -0,0 +1,949 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file cpu_zstd.cpp
+ * @brief Host Zstandard encoder, producing frames as described by RFC 8878
+ *
+ * Used by the writers for Zstandard compression when device compression is not available.
+ * Matches are found with hash chains whose search depth grows with the compression level. The
+ * literals are Huffman-coded, and each sequence code stream uses the predefined distribution or a
+ * distribution normalized from the block, whichever is estimated to be smaller.
+ */
+
+#include "io_comp.h"
+#include "unzstd.h"
+#include "zstd_common.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace {
+
+using namespace zstd;
+
+constexpr uint32_t min_match_length = 4;
+constexpr uint32_t max_match_length =
+  match_length_base.back() + (1u << match_length_bits.back()) - 1;
+constexpr uint32_t max_literals_length =
+  literals_length_base.back() + (1u << literals_length_bits.back()) - 1;
+
+constexpr int symbol_mode_predefined = 0;
+constexpr int symbol_mode_rle        = 1;
+constexpr int symbol_mode_compressed = 2;
+
+/**
+ * @brief Writer for little-endian bit streams
+ *
+ * Forward streams (FSE table descriptions) are padded with zero bits. Backward streams (Huffman
+ * and FSE-coded data) are read from their last bit, and end with a marker bit.
+ */
+class bit_writer {
+ public:
+  void add(uint64_t value, int num_bits)
+  {
+    _bits |= (value & ((uint64_t{1} << num_bits) - 1)) << _count;
+    _count += num_bits;
+    while (_count >= 8) {
+      _out.push_back(static_cast<uint8_t>(_bits));
+      _bits >>= 8;
+      _count -= 8;
+    }
+  }
+
+  std::vector<uint8_t> finish()
+  {
+    if (_count > 0) { _out.push_back(static_cast<uint8_t>(_bits)); }
+    _bits  = 0;
+    _count = 0;
+    return std::move(_out);
+  }
+
+  std::vector<uint8_t> close()
+  {
+    add(1, 1);
+    return finish();
+  }
+
+ private:
+  std::vector<uint8_t> _out;
+  uint64_t _bits = 0;
+  int _count     = 0;
+};
+
+inline void append_le(std::vector<uint8_t>& out, uint64_t value, int num_bytes)
+{
+  for (int i = 0; i < num_bytes; ++i) {
+    out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+  }
+}
+
+/**
+ * @brief Finite State Entropy encoding table
+ */
+struct fse_encoder {
+  int accuracy_log = 0;
+  std::vector<uint16_t> state_table;
+  std::vector<int32_t> delta_find_state;
+  std::vector<uint32_t> delta_num_bits;
+  std::vector<uint8_t> decoder_num_bits;  // Bits read by the decoder in each state
+};
+
+void build_fse_encoder(fse_encoder& enc, int16_t const* dist, int num_symbols, int accuracy_log)
+{
+  auto const size    = 1u << accuracy_log;
+  enc.accuracy_log   = accuracy_log;
+  enc.state_table    = std::vector<uint16_t>(size);
+  enc.decoder_num_bits = std::vector<uint8_t>(size);
+  enc.delta_find_state = std::vector<int32_t>(num_symbols);
+  enc.delta_num_bits   = std::vector<uint32_t>(num_symbols);
+
+  // Spread the symbols over the table exactly as the decoder does
+  std::vector<uint8_t> cells(size);
+  auto high_threshold = size;
+  for (int s = 0; s < num_symbols; ++s) {
+    if (dist[s] == -1) { cells[--high_threshold] = static_cast<uint8_t>(s); }
+  }
+  auto const step = (size >> 1) + (size >> 3) + 3;
+  auto const mask = size - 1;
+  uint32_t pos    = 0;
+  for (int s = 0; s < num_symbols; ++s) {
+    for (int i = 0; i < dist[s]; ++i) {
+      cells[pos] = static_cast<uint8_t>(s);
+      do {
+        pos = (pos + step) & mask;
+      } while (pos >= high_threshold);
+    }
+  }
+
+  std::vector<uint32_t> next_slot(num_symbols + 1, 0);
+  std::vector<uint32_t> next_state(num_symbols);
+  for (int s = 0; s < num_symbols; ++s) {
+    auto const count  = (dist[s] == -1) ? 1 : std::max<int>(dist[s], 0);
+    next_slot[s + 1]  = next_slot[s] + count;
+    next_state[s]     = count;
+  }
+  for (uint32_t u = 0; u < size; ++u) {
+    auto const s                   = cells[u];
+    enc.state_table[next_slot[s]++] = static_cast<uint16_t>(size + u);
+    auto const state                = next_state[s]++;
+    enc.decoder_num_bits[u] = static_cast<uint8_t>(accuracy_log - highest_set_bit(state));
+  }
+
+  int32_t total = 0;
+  for (int s = 0; s < num_symbols; ++s) {
+    switch (dist[s]) {
+      case 0: enc.delta_num_bits[s] = ((accuracy_log + 1) << 16) - size; break;
+      case -1:
+      case 1:
+        enc.delta_num_bits[s]   = (accuracy_log << 16) - size;
+        enc.delta_find_state[s] = total - 1;
+        ++total;
+        break;
+      default: {
+        auto const max_bits_out   = accuracy_log - highest_set_bit(dist[s] - 1);
+        auto const min_state_plus = static_cast<uint32_t>(dist[s]) << max_bits_out;
+        enc.delta_num_bits[s]     = (max_bits_out << 16) - min_state_plus;
+        enc.delta_find_state[s]   = total - dist[s];
+        total += dist[s];
+      }
+    }
+  }
+}
+
+/**
+ * @brief Encoding state of an FSE-coded stream; symbols are encoded in reverse order
+ */
+struct fse_encode_state {
+  fse_encoder const* table = nullptr;
+  uint32_t value           = 0;
+
+  void init(uint8_t symbol)
+  {
+    auto const num_bits = (table->delta_num_bits[symbol] + (1u << 15)) >> 16;
+    auto const v        = (num_bits << 16) - table->delta_num_bits[symbol];
+    value =
+      table->state_table[static_cast<int32_t>(v >> num_bits) + table->delta_find_state[symbol]];
+  }
+
+  void encode(bit_writer& out, uint8_t symbol)
+  {
+    auto const num_bits = (value + table->delta_num_bits[symbol]) >> 16;
+    out.add(value, num_bits);
+    value =
+      table->state_table[static_cast<int32_t>(value >> num_bits) + table->delta_find_state[symbol]];
+  }
+
+  void flush(bit_writer& out) const { out.add(value, table->accuracy_log); }
+
+  [[nodiscard]] uint32_t decoder_state() const { return value - (1u << table->accuracy_log); }
+};
+
+/**
+ * @brief Returns the accuracy of a distribution of `total` symbols, up to `max_symbol`
+ */
+int fse_accuracy_log(uint32_t total, int max_symbol, int max_accuracy_log)
+{
+  auto const min_bits =
+    std::min(highest_set_bit(total) + 1, highest_set_bit(std::max(max_symbol, 1)) + 2);
+  auto const log = std::min(max_accuracy_log, highest_set_bit(std::max(total, 2u) - 1) - 2);
+  return std::clamp(std::max(log, min_bits), 5, max_accuracy_log);
+}
+
+/**
+ * @brief Scales symbol counts to a distribution whose probabilities sum to `1 << accuracy_log`
+ *
+ * Every present symbol keeps a probability of at least one.
+ */
+std::vector<int16_t> normalize_counts(uint32_t const* counts,
+                                      int num_symbols,
+                                      uint32_t total,
+                                      int accuracy_log)
+{
+  auto const size = int64_t{1} << accuracy_log;
+  std::vector<int16_t> dist(num_symbols, 0);
+  int64_t sum = 0;
+  for (int s = 0; s < num_symbols; ++s) {
+    if (counts[s] == 0) { continue; }
+    auto const p = std::max<int64_t>(1, (counts[s] * size + total / 2) / total);
+    dist[s]      = static_cast<int16_t>(p);
+    sum += p;
+  }
+  // Give the rounding error to the most probable symbols
+  while (sum != size) {
+    auto const largest = std::max_element(dist.begin(), dist.end()) - dist.begin();
+    if (sum < size) {
+      dist[largest] += static_cast<int16_t>(size - sum);
+      sum = size;
+    } else {
+      auto const excess = std::min<int64_t>(dist[largest] - 1, sum - size);
+      dist[largest] -= static_cast<int16_t>(excess);
+      sum -= excess;
+    }
+  }
+  return dist;
+}
+
+/**
+ * @brief Writes the description of an FSE distribution
+ */
+std::vector<uint8_t> write_fse_table(int16_t const* dist, int num_symbols, int accuracy_log)
+{
+  bit_writer out;
+  out.add(accuracy_log - 5, 4);
+  int remaining      = (1 << accuracy_log) + 1;
+  int threshold      = 1 << accuracy_log;
+  int num_bits       = accuracy_log + 1;
+  bool previous_zero = false;
+  int s              = 0;
+  while (s < num_symbols && remaining > 1) {
+    if (previous_zero) {
+      // Runs of zero probabilities are coded as repeat flags
+      auto start = s;
+      while (dist[s] == 0) {
+        ++s;
+      }
+      for (; s >= start + 3; start += 3) {
+        out.add(3, 2);
+      }
+      out.add(s - start, 2);
+    }
+    int count       = dist[s++];
+    int const max   = (2 * threshold - 1) - remaining;
+    remaining      -= std::abs(count);
+    ++count;
+    if (count >= threshold) { count += max; }
+    out.add(count, num_bits - (count < max ? 1 : 0));
+    previous_zero = (count == 1);
+    while (remaining < threshold) {
+      --num_bits;
+      threshold >>= 1;
+    }
+  }
+  return out.finish();
+}
+
+/**
+ * @brief Estimated size, in bits, of the symbols coded with an FSE distribution
+ *
+ * @return The estimate, or a negative value if a present symbol has no probability
+ */
+double fse_cost(uint32_t const* counts, int num_symbols, int16_t const* dist, int accuracy_log)
+{
+  double bits = 0;
+  for (int s = 0; s < num_symbols; ++s) {
+    if (counts[s] == 0) { continue; }
+    if (dist[s] == 0) { return -1; }
+    bits += counts[s] * (accuracy_log - std::log2(std::max<int>(dist[s], 1)));
+  }
+  return bits;
+}
+
+/**
+ * @brief Huffman code lengths of the literals, limited to `huffman_max_bits`
+ *
+ * The counts are halved until the code fits the length limit.
+ */
+std::array<uint8_t, huffman_max_symbols> huffman_code_lengths(
+  std::array<uint32_t, huffman_max_symbols> counts)
+{
+  while (true) {
+    using node = std::pair<uint64_t, int>;
+    std::priority_queue<node, std::vector<node>, std::greater<>> queue;
+    std::vector<int> parent(2 * huffman_max_symbols, -1);
+    for (int s = 0; s < huffman_max_symbols; ++s) {
+      if (counts[s] != 0) { queue.emplace(counts[s], s); }
+    }
+    int next_node = huffman_max_symbols;
+    while (queue.size() > 1) {
+      auto const a = queue.top();
+      queue.pop();
+      auto const b = queue.top();
+      queue.pop();
+      parent[a.second] = next_node;
+      parent[b.second] = next_node;
+      queue.emplace(a.first + b.first, next_node++);
+    }
+
+    std::array<uint8_t, huffman_max_symbols> lengths{};
+    int max_length = 0;
+    for (int s = 0; s < huffman_max_symbols; ++s) {
+      if (counts[s] == 0) { continue; }
+      int length = 0;
+      for (auto n = s; parent[n] != -1; n = parent[n]) {
+        ++length;
+      }
+      lengths[s] = static_cast<uint8_t>(length);
+      max_length = std::max(max_length, length);
+    }
+    if (max_length <= huffman_max_bits) { return lengths; }
+    for (auto& count : counts) {
+      count = (count + 1) / 2;
+    }
+  }
+}
+
+/**
+ * @brief Writes the Huffman weights with two interleaved FSE states
+ *
+ * @return The description, or an empty vector if the weights cannot be coded this way
+ */
+std::vector<uint8_t> write_fse_weights(uint8_t const* weights, int num_weights)
+{
+  std::array<uint32_t, huffman_max_bits + 1> counts{};
+  int max_weight = 0;
+  for (int i = 0; i < num_weights; ++i) {
+    ++counts[weights[i]];
+    max_weight = std::max<int>(max_weight, weights[i]);
+  }
+  auto const distinct = std::count_if(counts.begin(), counts.end(), [](auto c) { return c != 0; });
+  if (num_weights < 2 || distinct < 2) { return {}; }
+
+  auto const accuracy_log =
+    fse_accuracy_log(num_weights, max_weight, static_cast<int>(weights_max_accuracy));
+  auto const dist = normalize_counts(counts.data(), max_weight + 1, num_weights, accuracy_log);
+  auto description = write_fse_table(dist.data(), max_weight + 1, accuracy_log);
+
+  fse_encoder table;
+  build_fse_encoder(table, dist.data(), max_weight + 1, accuracy_log);
+  // Even weights are coded by the first state, odd weights by the second
+  fse_encode_state states[2] = {{&table}, {&table}};
+  auto const last            = num_weights - 1;
+  states[last & 1].init(weights[last]);
+  states[(last - 1) & 1].init(weights[last - 1]);
+  // The decoder stops after the update that follows the next-to-last weight reads past the
+  // beginning of the stream; that update has to read at least one bit
+  if (table.decoder_num_bits[states[(last - 1) & 1].decoder_state()] == 0) { return {}; }
+
+  bit_writer out;
+  for (int i = last - 2; i >= 0; --i) {
+    states[i & 1].encode(out, weights[i]);
+  }
+  states[1].flush(out);
+  states[0].flush(out);
+  auto const stream = out.close();
+
+  description.insert(description.end(), stream.begin(), stream.end());
+  if (description.size() >= 128) { return {}; }
+  description.insert(description.begin(), static_cast<uint8_t>(description.size()));
+  return description;
+}
+
+/**
+ * @brief Writes the Huffman tree description, given the code lengths of the literals
+ */
+std::vector<uint8_t> write_huffman_tree(std::array<uint8_t, huffman_max_symbols> const& lengths)
+{
+  int max_symbol = 0;
+  int max_bits   = 0;
+  for (int s = 0; s < huffman_max_symbols; ++s) {
+    if (lengths[s] == 0) { continue; }
+    max_symbol = s;
+    max_bits   = std::max<int>(max_bits, lengths[s]);
+  }
+  // The weight of the last symbol is implied by the others
+  auto const num_weights = max_symbol;
+  std::array<uint8_t, huffman_max_symbols> weights{};
+  for (int s = 0; s < num_weights; ++s) {
+    weights[s] = lengths[s] > 0 ? static_cast<uint8_t>(max_bits + 1 - lengths[s]) : 0;
+  }
+
+  auto best = write_fse_weights(weights.data(), num_weights);
+  if (num_weights <= 128) {
+    std::vector<uint8_t> direct{static_cast<uint8_t>(127 + num_weights)};
+    for (int i = 0; i < num_weights; i += 2) {
+      direct.push_back(static_cast<uint8_t>((weights[i] << 4) | weights[i + 1]));
+    }
+    if (best.empty() || direct.size() < best.size()) { best = std::move(direct); }
+  }
+  return best;
+}
+
+void write_raw_literals_header(std::vector<uint8_t>& out, int block_type, size_t size)
+{
+  if (size < 32) {
+    out.push_back(static_cast<uint8_t>(block_type | (size << 3)));
+  } else if (size < 4096) {
+    append_le(out, block_type | (1 << 2) | (size << 4), 2);
+  } else {
+    append_le(out, block_type | (3 << 2) | (size << 4), 3);
+  }
+}
+
+/**
+ * @brief Encodes the literals section of a block
+ */
+std::vector<uint8_t> encode_literals(uint8_t const* literals, size_t num_literals)
+{
+  std::vector<uint8_t> raw;
+  write_raw_literals_header(raw, 0, num_literals);
+  raw.insert(raw.end(), literals, literals + num_literals);
+  if (num_literals == 0) { return raw; }
+
+  std::array<uint32_t, huffman_max_symbols> counts{};
+  for (size_t i = 0; i < num_literals; ++i) {
+    ++counts[literals[i]];
+  }
+  auto const distinct = std::count_if(counts.begin(), counts.end(), [](auto c) { return c != 0; });
+  if (distinct == 1) {
+    std::vector<uint8_t> rle;
+    write_raw_literals_header(rle, 1, num_literals);
+    rle.push_back(literals[0]);
+    return rle;
+  }
+
+  auto const lengths = huffman_code_lengths(counts);
+  auto const tree    = write_huffman_tree(lengths);
+  if (tree.empty()) { return raw; }
+
+  // Codes are assigned in order of increasing length, then symbol value
+  int max_bits = 0;
+  std::array<uint32_t, huffman_max_bits + 2> rank_count{};
+  for (auto length : lengths) {
+    ++rank_count[length];
+    max_bits = std::max<int>(max_bits, length);
+  }
+  std::array<uint32_t, huffman_max_bits + 2> next_code{};
+  uint32_t code = 0;
+  for (int length = max_bits; length > 0; --length) {
+    next_code[length] = code;
+    code              = (code + rank_count[length]) >> 1;
+  }
+  std::array<uint32_t, huffman_max_symbols> codes{};
+  for (int s = 0; s < huffman_max_symbols; ++s) {
+    if (lengths[s] != 0) { codes[s] = next_code[lengths[s]]++; }
+  }
+
+  // The decoder reads the streams backward, so the literals are written last to first
+  auto encode_stream = [&](size_t begin, size_t end) {
+    bit_writer out;
+    for (auto i = end; i > begin; --i) {
+      out.add(codes[literals[i - 1]], lengths[literals[i - 1]]);
+    }
+    return out.close();
+  };
+
+  std::vector<uint8_t> payload(tree);
+  bool const single_stream = num_literals < 1024;
+  if (single_stream) {
+    auto const stream = encode_stream(0, num_literals);
+    payload.insert(payload.end(), stream.begin(), stream.end());
+  } else {
+    auto const segment = (num_literals + 3) / 4;
+    std::vector<uint8_t> streams[4];
+    for (size_t i = 0; i < 4; ++i) {
+      streams[i] = encode_stream(std::min(i * segment, num_literals),
+                                 std::min((i + 1) * segment, num_literals));
+    }
+    for (size_t i = 0; i < 3; ++i) {
+      if (streams[i].size() > 0xffff) { return raw; }
+      append_le(payload, streams[i].size(), 2);
+    }
+    for (auto const& stream : streams) {
+      payload.insert(payload.end(), stream.begin(), stream.end());
+    }
+  }
+
+  auto const compressed_size = payload.size();
+  std::vector<uint8_t> section;
+  if (num_literals < 1024 && compressed_size < 1024) {
+    append_le(section, 2 | ((single_stream ? 0 : 1) << 2) | (num_literals << 4) |
+                         (compressed_size << 14),
+              3);
+  } else if (num_literals < 16384 && compressed_size < 16384) {
+    append_le(section, 2 | (2 << 2) | (num_literals << 4) | (compressed_size << 18), 4);
+  } else {
+    append_le(section, 2 | (3 << 2) | (num_literals << 4) | (uint64_t{compressed_size} << 22), 5);
+  }
+  if (single_stream && section.size() != 3) { return raw; }
+  section.insert(section.end(), payload.begin(), payload.end());
+  return section.size() < raw.size() ? section : raw;
+}
+
+/**
+ * @brief A match and the literals that precede it
+ */
+struct sequence {
+  uint32_t literals_length;
+  uint32_t match_length;
+  uint32_t offset_value;  // Offset + 3, or a repeat offset code
+};
+
+template <size_t N>
+uint8_t length_code(std::array<uint32_t, N> const& base, uint32_t length)
+{
+  return static_cast<uint8_t>(std::upper_bound(base.begin(), base.end(), length) - base.begin() -
+                              1);
+}
+
+/**
+ * @brief Coding table selected for one of the sequence code streams
+ */
+struct sequence_table {
+  int mode = symbol_mode_predefined;
+  fse_encoder table;
+};
+
+/**
+ * @brief Selects the cheapest coding of a sequence code stream and writes its description
+ */
+sequence_table select_sequence_table(std::vector<uint8_t> const& codes,
+                                     int16_t const* default_dist,
+                                     int default_num_symbols,
+                                     int default_accuracy_log,
+                                     int max_accuracy_log,
+                                     std::vector<uint8_t>& description)
+{
+  std::array<uint32_t, max_match_length_code + 1> counts{};
+  int max_code = 0;
+  for (auto c : codes) {
+    ++counts[c];
+    max_code = std::max<int>(max_code, c);
+  }
+  auto const num_codes = static_cast<uint32_t>(codes.size());
+
+  sequence_table result;
+  if (counts[max_code] == num_codes) {
+    result.mode = symbol_mode_rle;
+    description.push_back(static_cast<uint8_t>(max_code));
+    return result;
+  }
+
+  auto const default_cost =
+    max_code < default_num_symbols
+      ? fse_cost(counts.data(), max_code + 1, default_dist, default_accuracy_log)
+      : -1.0;
+  auto const accuracy_log = fse_accuracy_log(num_codes, max_code, max_accuracy_log);
+  auto const dist         = normalize_counts(counts.data(), max_code + 1, num_codes, accuracy_log);
+  auto const header       = write_fse_table(dist.data(), max_code + 1, accuracy_log);
+  auto const custom_cost =
+    header.size() * 8 + fse_cost(counts.data(), max_code + 1, dist.data(), accuracy_log);
+
+  if (default_cost >= 0 && default_cost <= custom_cost) {
+    result.mode = symbol_mode_predefined;
+    build_fse_encoder(result.table, default_dist, default_num_symbols, default_accuracy_log);
+  } else {
+    result.mode = symbol_mode_compressed;
+    build_fse_encoder(result.table, dist.data(), max_code + 1, accuracy_log);
+    description.insert(description.end(), header.begin(), header.end());
+  }
+  return result;
+}
+
+/**
+ * @brief Encodes the sequences section of a block
+ */
+std::vector<uint8_t> encode_sequences(std::vector<sequence> const& sequences)
+{
+  std::vector<uint8_t> out;
+  auto const num_sequences = sequences.size();
+  if (num_sequences < 128) {
+    out.push_back(static_cast<uint8_t>(num_sequences));
+  } else if (num_sequences < 0x7f00) {
+    out.push_back(static_cast<uint8_t>((num_sequences >> 8) + 128));
+    out.push_back(static_cast<uint8_t>(num_sequences));
+  } else {
+    out.push_back(0xff);
+    append_le(out, num_sequences - 0x7f00, 2);
+  }
+  if (num_sequences == 0) { return out; }
+
+  std::vector<uint8_t> ll_codes(num_sequences);
+  std::vector<uint8_t> ml_codes(num_sequences);
+  std::vector<uint8_t> of_codes(num_sequences);
+  for (size_t i = 0; i < num_sequences; ++i) {
+    ll_codes[i] = length_code(literals_length_base, sequences[i].literals_length);
+    ml_codes[i] = length_code(match_length_base, sequences[i].match_length);
+    of_codes[i] = static_cast<uint8_t>(highest_set_bit(sequences[i].offset_value));
+  }
+
+  std::vector<uint8_t> tables;
+  auto ll = select_sequence_table(ll_codes,
+                                  default_literals_length_dist.data(),
+                                  default_literals_length_dist.size(),
+                                  default_literals_length_accuracy,
+                                  literals_max_accuracy,
+                                  tables);
+  auto of = select_sequence_table(of_codes,
+                                  default_offset_dist.data(),
+                                  default_offset_dist.size(),
+                                  default_offset_accuracy,
+                                  offsets_max_accuracy,
+                                  tables);
+  auto ml = select_sequence_table(ml_codes,
+                                  default_match_length_dist.data(),
+                                  default_match_length_dist.size(),
+                                  default_match_length_accuracy,
+                                  matches_max_accuracy,
+                                  tables);
+  out.push_back(static_cast<uint8_t>((ll.mode << 6) | (of.mode << 4) | (ml.mode << 2)));
+  out.insert(out.end(), tables.begin(), tables.end());
+
+  // The decoder reads the sequences first to last, so they are written last to first
+  bit_writer bits;
+  fse_encode_state ll_state{&ll.table};
+  fse_encode_state of_state{&of.table};
+  fse_encode_state ml_state{&ml.table};
+  auto add_extra_bits = [&](size_t i) {
+    auto const& seq = sequences[i];
+    bits.add(seq.literals_length - literals_length_base[ll_codes[i]],
+             literals_length_bits[ll_codes[i]]);
+    bits.add(seq.match_length - match_length_base[ml_codes[i]], match_length_bits[ml_codes[i]]);
+    bits.add(seq.offset_value - (1u << of_codes[i]), of_codes[i]);
+  };
+  auto const last = num_sequences - 1;
+  if (ml.mode != symbol_mode_rle) { ml_state.init(ml_codes[last]); }
+  if (of.mode != symbol_mode_rle) { of_state.init(of_codes[last]); }
+  if (ll.mode != symbol_mode_rle) { ll_state.init(ll_codes[last]); }
+  add_extra_bits(last);
+  for (auto i = last; i-- > 0;) {
+    if (of.mode != symbol_mode_rle) { of_state.encode(bits, of_codes[i]); }
+    if (ml.mode != symbol_mode_rle) { ml_state.encode(bits, ml_codes[i]); }
+    if (ll.mode != symbol_mode_rle) { ll_state.encode(bits, ll_codes[i]); }
+    add_extra_bits(i);
+  }
+  if (ml.mode != symbol_mode_rle) { ml_state.flush(bits); }
+  if (of.mode != symbol_mode_rle) { of_state.flush(bits); }
+  if (ll.mode != symbol_mode_rle) { ll_state.flush(bits); }
+  auto const stream = bits.close();
+  out.insert(out.end(), stream.begin(), stream.end());
+  return out;
+}
+
+/**
+ * @brief Match search effort of a compression level
+ */
+struct match_params {
+  int search_depth;  // Candidates examined at each position
+  int lazy_steps;    // Following positions checked for a longer match before taking one
+  uint32_t nice_length;
+};
+
+constexpr std::array<match_params, zstd_max_compression_level> level_params = {{{4, 0, 16},
+                                                                                {8, 0, 24},
+                                                                                {16, 1, 32},
+                                                                                {24, 1, 48},
+                                                                                {32, 1, 64},
+                                                                                {48, 1, 96},
+                                                                                {64, 1, 128},
+                                                                                {96, 1, 160},
+                                                                                {128, 1, 192},
+                                                                                {128, 2, 256},
+                                                                                {192, 2, 256},
+                                                                                {256, 2, 384},
+                                                                                {256, 2, 512},
+                                                                                {384, 2, 512},
+                                                                                {512, 2, 768},
+                                                                                {512, 2, 1024},
+                                                                                {768, 2, 1024},
+                                                                                {1024, 2, 2048},
+                                                                                {1024, 2, 4096},
+                                                                                {2048, 2, 8192},
+                                                                                {4096, 2, 16384},
+                                                                                {8192, 2, 65536}}};
+
+/**
+ * @brief Finds matches in the input with hash chains of the 4-byte prefixes
+ */
+class match_finder {
+ public:
+  match_finder(uint8_t const* src, size_t len, match_params const& params)
+    : _src(src),
+      _len(len),
+      _params(params),
+      _hash_log(std::clamp(highest_set_bit(std::max<size_t>(len, 1)) + 1, 10, 20)),
+      _head(size_t{1} << _hash_log, -1),
+      _chain(len, -1)
+  {
+  }
+
+  /**
+   * @brief Returns the length and offset of the longest match at `pos` that ends before `end`
+   */
+  std::pair<uint32_t, uint32_t> find(size_t pos, size_t end)
+  {
+    insert_until(pos);
+    auto const max_length =
+      static_cast<uint32_t>(std::min<size_t>(end - pos, max_match_length));
+    uint32_t best_length = 0;
+    uint32_t best_offset = 0;
+    if (max_length < min_match_length || pos + min_match_length > _len) { return {0, 0}; }
+
+    auto candidate = _head[hash(pos)];
+    for (int depth = _params.search_depth; candidate >= 0 && depth > 0; --depth) {
+      if (_src[candidate + best_length] == _src[pos + best_length]) {
+        auto const length = match_length(candidate, pos, max_length);
+        if (length > best_length) {
+          best_length = length;
+          best_offset = static_cast<uint32_t>(pos - candidate);
+          if (length >= _params.nice_length || length == max_length) { break; }
+        }
+      }
+      candidate = _chain[candidate];
+    }
+    return {best_length >= min_match_length ? best_length : 0, best_offset};
+  }
+
+  /**
+   * @brief Returns the length of the match between `candidate` and `pos`, up to `max_length`
+   */
+  [[nodiscard]] uint32_t match_length(size_t candidate, size_t pos, uint32_t max_length) const
+  {
+    uint32_t length = 0;
+    while (length + 8 <= max_length) {
+      uint64_t a, b;
+      std::memcpy(&a, _src + candidate + length, sizeof(a));
+      std::memcpy(&b, _src + pos + length, sizeof(b));
+      if (a != b) {
+        auto diff = a ^ b;
+        while ((diff & 0xff) == 0) {
+          ++length;
+          diff >>= 8;
+        }
+        return length;
+      }
+      length += 8;
+    }
+    while (length < max_length && _src[candidate + length] == _src[pos + length]) {
+      ++length;
+    }
+    return length;
+  }
+
+ private:
+  [[nodiscard]] uint32_t hash(size_t pos) const
+  {
+    uint32_t v;
+    std::memcpy(&v, _src + pos, sizeof(v));
+    return (v * 2654435761u) >> (32 - _hash_log);
+  }
+
+  void insert_until(size_t pos)
+  {
+    for (; _next_insert < pos && _next_insert + min_match_length <= _len; ++_next_insert) {
+      auto const h         = hash(_next_insert);
+      _chain[_next_insert] = _head[h];
+      _head[h]             = static_cast<int32_t>(_next_insert);
+    }
+  }
+
+  uint8_t const* _src;
+  size_t _len;
+  match_params _params;
+  int _hash_log;
+  std::vector<int32_t> _head;
+  std::vector<int32_t> _chain;
+  size_t _next_insert = 0;
+};
+
+/**
+ * @brief Encodes the content of a compressed block
+ *
+ * @return The block content, or an empty vector if the block does not compress
+ */
+std::vector<uint8_t> encode_block(uint8_t const* src,
+                                  size_t block_start,
+                                  size_t block_end,
+                                  match_finder& finder,
+                                  match_params const& params,
+                                  std::array<uint32_t, 3>& repeat)
+{
+  std::vector<sequence> sequences;
+  std::vector<uint8_t> literals;
+  auto const saved_repeat = repeat;
+
+  // Matches are scored by their length minus the cost of their offset
+  struct candidate {
+    uint32_t length = 0;
+    uint32_t offset = 0;
+    [[nodiscard]] int score() const
+    {
+      return 4 * static_cast<int>(length) - highest_set_bit(offset + 3);
+    }
+  };
+  size_t anchor = block_start;
+  auto best_at  = [&](size_t pos) {
+    auto const [length, offset] = finder.find(pos, block_end);
+    candidate best{length, offset};
+    // The last offset is cheap to code when literals precede the match
+    if (pos > anchor && pos >= repeat[0]) {
+      auto const max_length =
+        static_cast<uint32_t>(std::min<size_t>(block_end - pos, max_match_length));
+      auto const rep_length = finder.match_length(pos - repeat[0], pos, max_length);
+      if (rep_length >= min_match_length && 4 * static_cast<int>(rep_length) >= best.score()) {
+        best = {rep_length, repeat[0]};
+      }
+    }
+    return best;
+  };
+
+  size_t pos = block_start;
+  while (pos + min_match_length <= block_end) {
+    auto best = best_at(pos);
+    if (best.length == 0) {
+      ++pos;
+      continue;
+    }
+    for (int step = 0; step < params.lazy_steps && pos + 1 + min_match_length <= block_end;
+         ++step) {
+      auto const next = best_at(pos + 1);
+      if (next.length == 0 || next.score() <= best.score() + 4) { break; }
+      ++pos;
+      best = next;
+    }
+
+    auto const literals_length = static_cast<uint32_t>(pos - anchor);
+    if (literals_length > max_literals_length) { return {}; }
+    literals.insert(literals.end(), src + anchor, src + pos);
+    uint32_t offset_value;
+    if (best.offset == repeat[0] && literals_length > 0) {
+      offset_value = 1;
+    } else {
+      offset_value = best.offset + 3;
+      repeat       = {best.offset, repeat[0], repeat[1]};
+    }
+    sequences.push_back({literals_length, best.length, offset_value});
+    pos += best.length;
+    anchor = pos;
+  }
+  literals.insert(literals.end(), src + anchor, src + block_end);
+
+  auto content      = encode_literals(literals.data(), literals.size());
+  auto const seqs   = encode_sequences(sequences);
+  content.insert(content.end(), seqs.begin(), seqs.end());
+  if (content.size() >= block_end - block_start) {
+    repeat = saved_repeat;
+    return {};
+  }
+  return content;
+}
+
+}  // namespace
+
+size_t cpu_zstd_compress_bound(size_t inlen)
+{
+  auto const num_blocks = std::max<size_t>((inlen + max_block_size - 1) / max_block_size, 1);
+  // Magic number, frame header descriptor, content size, and block headers
+  return inlen + 4 + 1 + 8 + 3 * num_blocks;
+}
+
+int32_t cpu_zstd_compress(
+  uint8_t const* input, size_t inlen, uint8_t* dst, size_t* dstlen, int level)
+{
+  auto const& params =
+    level_params[std::clamp(level, zstd_min_compression_level, zstd_max_compression_level) - 1];
+
+  std::vector<uint8_t> out;
+  out.reserve(cpu_zstd_compress_bound(inlen));
+  append_le(out, zstd_magic, 4);
+  // Single-segment frame: the window covers the whole content, whose size is always stored
+  if (inlen < 256) {
+    out.push_back(0x20);
+    append_le(out, inlen, 1);
+  } else if (inlen < 65536 + 256) {
+    out.push_back(0x60);
+    append_le(out, inlen - 256, 2);
+  } else if (inlen <= 0xffff'ffffu) {
+    out.push_back(0xa0);
+    append_le(out, inlen, 4);
+  } else {
+    out.push_back(0xe0);
+    append_le(out, inlen, 8);
+  }
+
+  match_finder finder(input, inlen, params);
+  std::array<uint32_t, 3> repeat = {1, 4, 8};
+  size_t block_start             = 0;
+  do {
+    auto const block_end  = std::min<size_t>(block_start + max_block_size, inlen);
+    auto const block_size = block_end - block_start;
+    auto const last       = (block_end == inlen) ? 1u : 0u;
+    auto const is_rle =
+      block_size > 1 && std::all_of(input + block_start, input + block_end, [&](uint8_t b) {
+        return b == input[block_start];
+      });
+    if (is_rle) {
+      append_le(out, last | (1u << 1) | (block_size << 3), 3);
+      out.push_back(input[block_start]);
+    } else {
+      auto const content = encode_block(input, block_start, block_end, finder, params, repeat);
+      if (content.empty()) {
+        append_le(out, last | (block_size << 3), 3);
+        out.insert(out.end(), input + block_start, input + block_end);
+      } else {
+        append_le(out, last | (2u << 1) | (content.size() << 3), 3);
+        out.insert(out.end(), content.begin(), content.end());
+      }
+    }
+    block_start = block_end;
+  } while (block_start < inlen);
+
+  if (out.size() > *dstlen) { return ZSTD_STATUS_OUTBUFF_FULL; }
+  std::memcpy(dst, out.data(), out.size());
+  *dstlen = out.size();
+  return ZSTD_STATUS_OK;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "host_batch_decompressor.hpp"
+#include "io_uncomp.h"
+
+#include <io/utilities/file_io_utilities.hpp>
+
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <numeric>
+#include <utility>
+
+namespace cudf::io {
+
+namespace {
+
+/**
+ * @brief Returns the statistics of a codec, adding them if not present yet.
+ */
+host_codec_stats& codec_stats(std::vector<host_codec_stats>& stats, int stream_type)
+{
+  auto it = std::lower_bound(stats.begin(), stats.end(), stream_type, [](auto const& s, int type) {
+    return s.stream_type < type;
+  });
+  if (it == stats.end() || it->stream_type != stream_type) {
+    it = stats.insert(it, host_codec_stats{stream_type});
+  }
+  return *it;
+}
+
+/**
+ * @brief Host decompressors of a worker thread, created on first use of each codec
+ */
+class worker_decompressors {
+ public:
+  HostDecompressor& get(int stream_type)
+  {
+    auto it = std::find_if(_decompressors.begin(), _decompressors.end(), [&](auto const& d) {
+      return d.first == stream_type;
+    });
+    if (it == _decompressors.end()) {
+      _decompressors.emplace_back(stream_type, HostDecompressor::Create(stream_type));
+      it = _decompressors.end() - 1;
+    }
+    return *it->second;
+  }
+
+ private:
+  std::vector<std::pair<int, std::unique_ptr<HostDecompressor>>> _decompressors;
+};
+
+}  // namespace
+
+host_batch_decompressor::host_batch_decompressor()
+  : host_batch_decompressor(detail::host_decompression_pool())
+{
+}
+
+host_batch_decompressor::host_batch_decompressor(cudf::detail::thread_pool& pool) : _pool(pool) {}
+
+void host_batch_decompressor::decompress(host_span<host_decompression_task const> tasks,
+                                         host_span<gpu_inflate_status_s> outputs)
+{
+  CUDF_EXPECTS(tasks.size() == outputs.size(), "Mismatched decompression inputs and outputs");
+  if (tasks.empty()) { return; }
+
+  // Create a decompressor of each codec upfront, so that unsupported codecs fail here and not in a
+  // worker thread
+  worker_decompressors caller_decompressors;
+  for (auto const& task : tasks) {
+    caller_decompressors.get(task.stream_type);
+  }
+
+  // Largest blocks first, so that the blocks claimed last are the shortest
+  std::vector<size_t> order(tasks.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](auto a, auto b) {
+    return tasks[a].src.size() > tasks[b].src.size();
+  });
+
+  auto const num_workers =
+    std::min<size_t>(static_cast<size_t>(_pool.get_thread_count()) + 1, tasks.size());
+  std::vector<std::vector<host_codec_stats>> worker_stats(num_workers);
+  std::atomic<size_t> next_task{0};
+  auto work = [&](size_t worker, worker_decompressors& decompressors) {
+    auto& stats = worker_stats[worker];
+    for (auto t = next_task++; t < tasks.size(); t = next_task++) {
+      auto const idx   = order[t];
+      auto const& task = tasks[idx];
+      auto const start = std::chrono::steady_clock::now();
+      auto const written =
+        decompressors.get(task.stream_type)
+          .Decompress(task.dst.data(), task.dst.size(), task.src.data(), task.src.size());
+      std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+
+      auto const is_failed       = (written == 0 && !task.dst.empty());
+      outputs[idx].bytes_written = written;
+      outputs[idx].status        = is_failed ? 1 : 0;
+      outputs[idx].reserved      = 0;
+
+      auto& codec = codec_stats(stats, task.stream_type);
+      codec.num_blocks++;
+      codec.num_failed += is_failed ? 1 : 0;
+      codec.compressed_bytes += task.src.size();
+      codec.decompressed_bytes += written;
+      codec.busy_seconds += elapsed.count();
+    }
+  };
+
+  std::vector<std::future<void>> workers;
+  for (size_t w = 1; w < num_workers; ++w) {
+    workers.push_back(_pool.submit([&work, w]() {
+      worker_decompressors decompressors;
+      work(w, decompressors);
+    }));
+  }
+  work(0, caller_decompressors);
+  // Workers reference the local state; wait for all of them before reporting any error
+  for (auto& worker : workers) {
+    worker.wait();
+  }
+  for (auto& worker : workers) {
+    worker.get();
+  }
+
+  std::lock_guard<std::mutex> lock(_stats_mutex);
+  for (auto const& stats : worker_stats) {
+    for (auto const& s : stats) {
+      auto& codec = codec_stats(_stats, s.stream_type);
+      codec.num_blocks += s.num_blocks;
+      codec.num_failed += s.num_failed;
+      codec.compressed_bytes += s.compressed_bytes;
+      codec.decompressed_bytes += s.decompressed_bytes;
+      codec.busy_seconds += s.busy_seconds;
+    }
+  }
+}
+
+void host_batch_decompressor::decompress(int stream_type,
+                                         host_span<gpu_inflate_input_s const> inputs,
+                                         host_span<gpu_inflate_status_s> outputs,
+                                         rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(inputs.size() == outputs.size(), "Mismatched decompression inputs and outputs");
+  if (inputs.empty()) { return; }
+
+  // Stage all compressed blocks in a single host buffer
+  std::vector<size_t> src_offsets(inputs.size() + 1, 0);
+  std::vector<size_t> dst_offsets(inputs.size() + 1, 0);
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    src_offsets[i + 1] = src_offsets[i] + inputs[i].srcSize;
+    dst_offsets[i + 1] = dst_offsets[i] + inputs[i].dstSize;
+  }
+  std::vector<uint8_t> src(src_offsets.back());
+  std::vector<uint8_t> dst(dst_offsets.back());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    CUDA_TRY(cudaMemcpyAsync(src.data() + src_offsets[i],
+                             inputs[i].srcDevice,
+                             inputs[i].srcSize,
+                             cudaMemcpyDeviceToHost,
+                             stream.value()));
+  }
+  stream.synchronize();
+
+  std::vector<host_decompression_task> tasks;
+  tasks.reserve(inputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    tasks.push_back({{src.data() + src_offsets[i], inputs[i].srcSize},
+                     {dst.data() + dst_offsets[i], inputs[i].dstSize},
+                     stream_type});
+  }
+  decompress(tasks, outputs);
+
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    if (outputs[i].bytes_written != 0) {
+      CUDA_TRY(cudaMemcpyAsync(inputs[i].dstDevice,
+                               dst.data() + dst_offsets[i],
+                               outputs[i].bytes_written,
+                               cudaMemcpyHostToDevice,
+                               stream.value()));
+    }
+  }
+  // The staging buffers must outlive the copies
+  stream.synchronize();
+}
+
+std::vector<host_codec_stats> host_batch_decompressor::statistics() const
+{
+  std::lock_guard<std::mutex> lock(_stats_mutex);
+  return _stats;
+}
+
+host_batch_decompressor& reader_host_decompressor()
+{
+  static host_batch_decompressor decompressor;
+  return decompressor;
+}
+
+}  // namespace cudf::io
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "gpuinflate.h"
+
+#include <io/utilities/thread_pool.hpp>
+
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace cudf::io {
+
+/**
+ * @brief Block of compressed host data to decompress
+ */
+struct host_decompression_task {
+  host_span<uint8_t const> src;  // Compressed data
+  host_span<uint8_t> dst;        // Destination; its size is the maximum decompressed size
+  int stream_type;               // Compression method (IO_UNCOMP_STREAM_TYPE_XXX)
+};
+
+/**
+ * @brief Decompression statistics of a codec
+ */
+struct host_codec_stats {
+  int stream_type;                // Compression method (IO_UNCOMP_STREAM_TYPE_XXX)
+  size_t num_blocks         = 0;  // Number of blocks decompressed
+  size_t num_failed         = 0;  // Number of blocks that could not be decompressed
+  size_t compressed_bytes   = 0;  // Total size of the compressed blocks
+  size_t decompressed_bytes = 0;  // Total size of the decompressed blocks
+  double busy_seconds       = 0;  // Time spent decompressing, summed over all threads
+
+  /**
+   * @brief Returns the decompression throughput of a single thread, in decompressed bytes per
+   * second
+   */
+  [[nodiscard]] double throughput() const
+  {
+    return (busy_seconds > 0) ? decompressed_bytes / busy_seconds : 0.;
+  }
+};
+
+/**
+ * @brief Decompresses batches of independent blocks on the host with multiple threads
+ *
+ * Blocks of a batch may use different codecs. Worker threads claim the blocks one at a time,
+ * largest first, so that threads that finish early take over the remaining blocks instead of a
+ * few large blocks keeping a single thread busy at the end of a batch. The calling thread works on
+ * the batch as well.
+ *
+ * The statistics of each codec are accumulated over all batches. Batches can be decompressed
+ * concurrently from multiple threads, but not from the threads of the pool used for decompression.
+ */
+class host_batch_decompressor {
+ public:
+  /**
+   * @brief Constructs a decompressor that uses the process-wide host decompression pool.
+   */
+  host_batch_decompressor();
+
+  /**
+   * @brief Constructs a decompressor that uses the given thread pool.
+   */
+  explicit host_batch_decompressor(cudf::detail::thread_pool& pool);
+
+  /**
+   * @brief Decompresses a batch of host blocks
+   *
+   * @throw cudf::logic_error if a block uses a codec without a host decompressor
+   *
+   * @param[in] tasks Blocks to decompress
+   * @param[out] outputs Decompressed size and status of each block; `status` is non-zero on failure
+   */
+  void decompress(host_span<host_decompression_task const> tasks,
+                  host_span<gpu_inflate_status_s> outputs);
+
+  /**
+   * @brief Decompresses a batch of device blocks compressed with the same codec
+   *
+   * The compressed blocks are copied to the host, decompressed, and copied to their device
+   * destinations.
+   *
+   * @param[in] stream_type Compression method (IO_UNCOMP_STREAM_TYPE_XXX)
+   * @param[in] inputs Host copies of the descriptors of the blocks to decompress
+   * @param[out] outputs Decompressed size and status of each block; `status` is non-zero on failure
+   * @param[in] stream CUDA stream to use for the copies
+   */
+  void decompress(int stream_type,
+                  host_span<gpu_inflate_input_s const> inputs,
+                  host_span<gpu_inflate_status_s> outputs,
+                  rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns the statistics of each codec decompressed so far, ordered by codec.
+   */
+  [[nodiscard]] std::vector<host_codec_stats> statistics() const;
+
+ private:
+  cudf::detail::thread_pool& _pool;
+  mutable std::mutex _stats_mutex;
+  std::vector<host_codec_stats> _stats;
+};
+
+/**
+ * @brief Returns the host decompressor used by the readers.
+ *
+ * Its statistics cover all host decompression of Parquet pages and ORC blocks in the process, and
+ * are reported by `cudf::io::get_host_decompression_statistics()`.
+ */
+host_batch_decompressor& reader_host_decompressor();
+
+}  // namespace cudf::io
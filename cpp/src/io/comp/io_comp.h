@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "gpuinflate.h"
+#include "io_uncomp.h"
+
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <memory>
+#include <optional>
+
+namespace cudf {
+namespace io {
+
+constexpr int zstd_min_compression_level     = 1;
+constexpr int zstd_max_compression_level     = 22;
+constexpr int zstd_default_compression_level = 3;
+
+/**
+ * @brief Returns the maximum size of the Zstandard frame produced by `cpu_zstd_compress`
+ */
+size_t cpu_zstd_compress_bound(size_t inlen);
+
+/**
+ * @brief Compresses a buffer into a single Zstandard frame (RFC 8878) on the host
+ *
+ * @param[in] input Data to compress
+ * @param[in] inlen Size of the data, in bytes
+ * @param[out] dst Destination buffer
+ * @param[in,out] dstlen Size of the destination buffer on input; compressed size on output
+ * @param[in] level Compression level, clamped to
+ * [`zstd_min_compression_level`, `zstd_max_compression_level`]
+ *
+ * @return `ZSTD_STATUS_OK` on success, or `ZSTD_STATUS_OUTBUFF_FULL` if the frame does not fit
+ */
+int32_t cpu_zstd_compress(
+  uint8_t const* input, size_t inlen, uint8_t* dst, size_t* dstlen, int level);
+
+/**
+ * @brief Returns the maximum size of the LZ4 block produced by `lz4_compress_block`
+ */
+size_t lz4_compress_bound(size_t len);
+
+/**
+ * @brief Compresses a buffer into a raw LZ4 block on the host
+ *
+ * @return The size of the block, or 0 if it does not fit in the destination buffer
+ */
+size_t lz4_compress_block(uint8_t* dst, size_t dst_len, uint8_t const* src, size_t src_len);
+
+class HostCompressor {
+ public:
+  virtual size_t Compress(uint8_t* dstBytes,
+                          size_t dstLen,
+                          uint8_t const* srcBytes,
+                          size_t srcLen) = 0;
+  virtual size_t GetMaxCompressedSize(size_t srcLen) = 0;
+  virtual ~HostCompressor() {}
+
+ public:
+  /**
+   * @brief Creates a host compressor
+   *
+   * @param stream_type Compression method (IO_UNCOMP_STREAM_TYPE_GZIP, _INFLATE, _LZ4 or _ZSTD)
+   * @param level Compression level; the default level of the method if not set. Ignored by LZ4
+   */
+  static std::unique_ptr<HostCompressor> Create(int stream_type,
+                                                std::optional<int> level = std::nullopt);
+};
+
+/**
+ * @brief Compresses blocks of device memory on the host
+ *
+ * Used for the codecs without a device compressor. The blocks are copied to the host, compressed
+ * with the `HostCompressor` of the codec, and copied to their device destinations. Blocks that do
+ * not fit in their destination are reported with a non-zero `status`; the writers store those
+ * uncompressed.
+ *
+ * @param[in] stream_type Compression method (IO_UNCOMP_STREAM_TYPE_XXX)
+ * @param[in] level Compression level; the default level of the method if not set
+ * @param[in] inputs Device descriptors of the blocks to compress
+ * @param[out] outputs Device compressed size and status of each block
+ * @param[in] stream CUDA stream to use for the copies
+ */
+void host_compress(int stream_type,
+                   std::optional<int> level,
+                   device_span<gpu_inflate_input_s const> inputs,
+                   device_span<gpu_inflate_status_s> outputs,
+                   rmm::cuda_stream_view stream);
+
+}  // namespace io
+}  // namespace cudf
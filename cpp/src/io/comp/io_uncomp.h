@@ -16,11 +16,17 @@
 
 #pragma once
 
+#include "gpuinflate.h"
+
+#include <cudf/io/datasource.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <array>
+#include <future>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 using cudf::host_span;
@@ -28,23 +34,169 @@ using cudf::host_span;
 namespace cudf {
 namespace io {
 enum {
-  IO_UNCOMP_STREAM_TYPE_INFER   = 0,
-  IO_UNCOMP_STREAM_TYPE_GZIP    = 1,
-  IO_UNCOMP_STREAM_TYPE_ZIP     = 2,
-  IO_UNCOMP_STREAM_TYPE_BZIP2   = 3,
-  IO_UNCOMP_STREAM_TYPE_XZ      = 4,
-  IO_UNCOMP_STREAM_TYPE_INFLATE = 5,
-  IO_UNCOMP_STREAM_TYPE_SNAPPY  = 6,
-  IO_UNCOMP_STREAM_TYPE_BROTLI  = 7,
-  IO_UNCOMP_STREAM_TYPE_LZ4     = 8,
-  IO_UNCOMP_STREAM_TYPE_LZO     = 9,
-  IO_UNCOMP_STREAM_TYPE_ZSTD    = 10,
+  IO_UNCOMP_STREAM_TYPE_INFER      = 0,
+  IO_UNCOMP_STREAM_TYPE_GZIP       = 1,
+  IO_UNCOMP_STREAM_TYPE_ZIP        = 2,
+  IO_UNCOMP_STREAM_TYPE_BZIP2      = 3,
+  IO_UNCOMP_STREAM_TYPE_XZ         = 4,
+  IO_UNCOMP_STREAM_TYPE_INFLATE    = 5,
+  IO_UNCOMP_STREAM_TYPE_SNAPPY     = 6,
+  IO_UNCOMP_STREAM_TYPE_BROTLI     = 7,
+  IO_UNCOMP_STREAM_TYPE_LZ4        = 8,
+  IO_UNCOMP_STREAM_TYPE_LZO        = 9,
+  IO_UNCOMP_STREAM_TYPE_ZSTD       = 10,
+  // LZ4 blocks with the Hadoop framing of the legacy Parquet LZ4 codec
+  IO_UNCOMP_STREAM_TYPE_LZ4_HADOOP = 11,
 };
 
 std::vector<char> io_uncompress_single_h2d(void const* src, size_t src_size, int stream_type);
 
 std::vector<char> get_uncompressed_data(host_span<char const> data, compression_type compression);
 
+/**
+ * @brief Incrementally decompresses a gzip, zip or bzip2 compressed source into host memory.
+ *
+ * Unlike `get_uncompressed_data`, which decompresses the whole input into a single buffer, the
+ * uncompressed data is produced on demand, so the host memory used to read a compressed source
+ * does not grow with its uncompressed size. The compressed data of gzip sources is also read from
+ * the source incrementally; zip and bzip2 sources are read at once.
+ *
+ * gzip sources may consist of multiple members (e.g. concatenated files or BGZF blocks); the BGZF
+ * blocks that are whole within a window of compressed data are inflated in parallel, and other
+ * members one after the other.
+ */
+class stream_decompressor {
+ public:
+  /**
+   * @brief Constructor from a compressed source.
+   *
+   * @throw cudf::logic_error if the source is empty or its compression type is not supported
+   *
+   * @param source Compressed source; must outlive the decompressor
+   * @param compression Compression type of the source; inferred from the data if not gzip, zip or
+   * bzip2
+   */
+  stream_decompressor(datasource* source, compression_type compression);
+
+  ~stream_decompressor();
+
+  /**
+   * @brief Decompresses the next bytes of the uncompressed data.
+   *
+   * @throw cudf::logic_error if the compressed data is corrupted or truncated
+   *
+   * @param dst Destination buffer
+   * @return Number of bytes written to `dst`; smaller than its size only at the end of the data
+   */
+  size_t decompress(host_span<char> dst);
+
+  /**
+   * @brief Returns whether all uncompressed data has been returned.
+   */
+  [[nodiscard]] bool is_done() const;
+
+  /**
+   * @brief Returns the expected size of the uncompressed data, as recorded in the gzip trailer or
+   * the zip header; 0 if unknown.
+   *
+   * The size is exact for zip sources and for single-member gzip sources under 4GB.
+   */
+  [[nodiscard]] size_t uncompressed_size_hint() const;
+
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+};
+
+/**
+ * @brief Reads the uncompressed data of a compressed source in consecutive fixed-size windows.
+ *
+ * While the caller processes a window, the next window is decompressed on a separate thread, so
+ * that decompression overlaps with the copies and kernels that consume the data. At most two
+ * windows are held in host memory.
+ */
+class decompressed_windows {
+ public:
+  /**
+   * @brief Constructor from a compressed source; starts decompressing the first window.
+   *
+   * @param source Compressed source; must outlive the object
+   * @param compression Compression type of the source
+   * @param window_size Size of the windows, in bytes
+   */
+  decompressed_windows(datasource* source, compression_type compression, size_t window_size);
+
+  ~decompressed_windows();
+
+  /**
+   * @brief Returns the next window of the uncompressed data.
+   *
+   * The window is valid until the next call. All windows but the last one have the window size.
+   *
+   * @throw cudf::logic_error if the compressed data is corrupted or truncated
+   *
+   * @return Next window; empty once all data has been returned
+   */
+  host_span<char const> next();
+
+  /**
+   * @brief Returns whether the last returned window ends the uncompressed data.
+   */
+  [[nodiscard]] bool is_done() const { return _is_done; }
+
+  /**
+   * @brief Returns the expected size of the uncompressed data; 0 if unknown.
+   */
+  [[nodiscard]] size_t uncompressed_size_hint() const
+  {
+    return _decompressor.uncompressed_size_hint();
+  }
+
+ private:
+  void decompress_next_window();
+
+  stream_decompressor _decompressor;
+  std::array<std::vector<char>, 2> _windows;
+  size_t _next_window = 0;
+  // Size of the next window and whether it is the last one
+  std::future<std::pair<size_t, bool>> _next;
+  bool _is_done = false;
+};
+
+/**
+ * @brief Builds a random access index of a single-member gzip source.
+ *
+ * The index stores checkpoints at DEFLATE block boundaries, roughly every `spacing` uncompressed
+ * bytes; each checkpoint holds the compressed bit position, the uncompressed position, and the
+ * last 32KB of uncompressed data before it, so that inflating can resume from the checkpoint.
+ *
+ * @throw cudf::logic_error if the source is not a valid single-member gzip stream
+ *
+ * @param source gzip compressed source
+ * @param spacing Minimum number of uncompressed bytes between checkpoints
+ * @return Serialized index
+ */
+std::vector<char> build_gzip_index(datasource* source, size_t spacing);
+
+/**
+ * @brief Decompresses a range of the uncompressed data of a gzip source, using its index.
+ *
+ * Only the compressed data of the range is read. The range is split at the checkpoints of the
+ * index, and the segments are inflated in parallel.
+ *
+ * @throw cudf::logic_error if the index does not match the source
+ *
+ * @param source gzip compressed source
+ * @param index Serialized index of the source, as returned by `build_gzip_index`
+ * @param offset Offset of the range in the uncompressed data
+ * @param size Size of the range; clamped to the end of the uncompressed data
+ * @return Uncompressed data of the range
+ */
+std::vector<char> decompress_gzip_range(datasource* source,
+                                        host_span<char const> index,
+                                        size_t offset,
+                                        size_t size);
+
 class HostDecompressor {
  public:
   virtual size_t Decompress(uint8_t* dstBytes,
@@ -57,6 +209,23 @@ class HostDecompressor {
   static std::unique_ptr<HostDecompressor> Create(int stream_type);
 };
 
+/**
+ * @brief Decompresses blocks of device memory on the host
+ *
+ * Used for the codecs without a device decompressor. The compressed blocks are copied to the host,
+ * decompressed in parallel with `reader_host_decompressor()`, and copied to their device
+ * destinations.
+ *
+ * @param[in] stream_type Compression method (IO_UNCOMP_STREAM_TYPE_XXX)
+ * @param[in] inputs Host copies of the descriptors of the blocks to decompress
+ * @param[out] outputs Decompressed size and status of each block; `status` is non-zero on failure
+ * @param[in] stream CUDA stream to use for the copies
+ */
+void host_decompress(int stream_type,
+                     host_span<gpu_inflate_input_s const> inputs,
+                     host_span<gpu_inflate_status_s> outputs,
+                     rmm::cuda_stream_view stream);
+
 /**
  * @brief GZIP header flags
  * See https://tools.ietf.org/html/rfc1952
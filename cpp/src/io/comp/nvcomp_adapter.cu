@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nvcomp_adapter.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <nvcomp/lz4.h>
+#include <nvcomp/snappy.h>
+
+#include <thrust/equal.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <string>
+
+namespace cudf::io::nvcomp {
+
+namespace {
+
+std::string compression_type_name(compression_type type)
+{
+  switch (type) {
+    case compression_type::SNAPPY: return "snappy";
+    case compression_type::LZ4: return "LZ4";
+  }
+  return "unknown";
+}
+
+nvcompStatus_t batched_decompress_get_temp_size(compression_type type,
+                                                size_t num_chunks,
+                                                size_t max_uncomp_chunk_size,
+                                                size_t* temp_size)
+{
+  switch (type) {
+    case compression_type::SNAPPY:
+      return nvcompBatchedSnappyDecompressGetTempSize(num_chunks, max_uncomp_chunk_size, temp_size);
+    case compression_type::LZ4:
+      return nvcompBatchedLZ4DecompressGetTempSize(num_chunks, max_uncomp_chunk_size, temp_size);
+  }
+  return nvcompStatus_t::nvcompErrorNotSupported;
+}
+
+nvcompStatus_t batched_decompress_async(compression_type type,
+                                        void const* const* device_compressed_ptrs,
+                                        size_t const* device_compressed_bytes,
+                                        size_t const* device_uncompressed_bytes,
+                                        size_t* device_actual_uncompressed_bytes,
+                                        size_t batch_size,
+                                        void* device_temp_ptr,
+                                        size_t temp_bytes,
+                                        void* const* device_uncompressed_ptrs,
+                                        nvcompStatus_t* device_statuses,
+                                        rmm::cuda_stream_view stream)
+{
+  switch (type) {
+    case compression_type::SNAPPY:
+      return nvcompBatchedSnappyDecompressAsync(device_compressed_ptrs,
+                                                device_compressed_bytes,
+                                                device_uncompressed_bytes,
+                                                device_actual_uncompressed_bytes,
+                                                batch_size,
+                                                device_temp_ptr,
+                                                temp_bytes,
+                                                device_uncompressed_ptrs,
+                                                device_statuses,
+                                                stream.value());
+    case compression_type::LZ4:
+      return nvcompBatchedLZ4DecompressAsync(device_compressed_ptrs,
+                                             device_compressed_bytes,
+                                             device_uncompressed_bytes,
+                                             device_actual_uncompressed_bytes,
+                                             batch_size,
+                                             device_temp_ptr,
+                                             temp_bytes,
+                                             device_uncompressed_ptrs,
+                                             device_statuses,
+                                             stream.value());
+  }
+  return nvcompStatus_t::nvcompErrorNotSupported;
+}
+
+nvcompStatus_t batched_compress_get_temp_size(compression_type type,
+                                              size_t num_chunks,
+                                              size_t max_uncomp_chunk_size,
+                                              size_t* temp_size)
+{
+  switch (type) {
+    case compression_type::SNAPPY:
+      return nvcompBatchedSnappyCompressGetTempSize(
+        num_chunks, max_uncomp_chunk_size, nvcompBatchedSnappyDefaultOpts, temp_size);
+    case compression_type::LZ4:
+      return nvcompBatchedLZ4CompressGetTempSize(
+        num_chunks, max_uncomp_chunk_size, nvcompBatchedLZ4DefaultOpts, temp_size);
+  }
+  return nvcompStatus_t::nvcompErrorNotSupported;
+}
+
+nvcompStatus_t batched_compress_async(compression_type type,
+                                      void const* const* device_uncompressed_ptrs,
+                                      size_t const* device_uncompressed_bytes,
+                                      size_t max_uncomp_chunk_size,
+                                      size_t batch_size,
+                                      void* device_temp_ptr,
+                                      size_t temp_bytes,
+                                      void* const* device_compressed_ptrs,
+                                      size_t* device_compressed_bytes,
+                                      rmm::cuda_stream_view stream)
+{
+  switch (type) {
+    case compression_type::SNAPPY:
+      return nvcompBatchedSnappyCompressAsync(device_uncompressed_ptrs,
+                                              device_uncompressed_bytes,
+                                              max_uncomp_chunk_size,
+                                              batch_size,
+                                              device_temp_ptr,
+                                              temp_bytes,
+                                              device_compressed_ptrs,
+                                              device_compressed_bytes,
+                                              nvcompBatchedSnappyDefaultOpts,
+                                              stream.value());
+    case compression_type::LZ4:
+      return nvcompBatchedLZ4CompressAsync(device_uncompressed_ptrs,
+                                           device_uncompressed_bytes,
+                                           max_uncomp_chunk_size,
+                                           batch_size,
+                                           device_temp_ptr,
+                                           temp_bytes,
+                                           device_compressed_ptrs,
+                                           device_compressed_bytes,
+                                           nvcompBatchedLZ4DefaultOpts,
+                                           stream.value());
+  }
+  return nvcompStatus_t::nvcompErrorNotSupported;
+}
+
+}  // namespace
+
+void batched_decompress(compression_type type,
+                        device_span<gpu_inflate_input_s const> inputs,
+                        device_span<gpu_inflate_status_s> statuses,
+                        size_t max_uncomp_chunk_size,
+                        bool is_exact_size,
+                        rmm::cuda_stream_view stream)
+{
+  auto const num_chunks = inputs.size();
+  auto const name       = compression_type_name(type);
+
+  size_t temp_size;
+  auto nvcomp_status =
+    batched_decompress_get_temp_size(type, num_chunks, max_uncomp_chunk_size, &temp_size);
+  CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
+               "Unable to get scratch size for " + name + " decompression");
+
+  rmm::device_buffer scratch(temp_size, stream);
+  rmm::device_uvector<void const*> compressed_data_ptrs(num_chunks, stream);
+  rmm::device_uvector<size_t> compressed_data_sizes(num_chunks, stream);
+  rmm::device_uvector<void*> uncompressed_data_ptrs(num_chunks, stream);
+  rmm::device_uvector<size_t> uncompressed_data_sizes(num_chunks, stream);
+
+  rmm::device_uvector<size_t> actual_uncompressed_data_sizes(num_chunks, stream);
+  rmm::device_uvector<nvcompStatus_t> nvcomp_statuses(num_chunks, stream);
+
+  // Prepare the vectors
+  auto comp_it = thrust::make_zip_iterator(compressed_data_ptrs.begin(),
+                                           compressed_data_sizes.begin(),
+                                           uncompressed_data_ptrs.begin(),
+                                           uncompressed_data_sizes.data());
+  thrust::transform(rmm::exec_policy(stream),
+                    inputs.begin(),
+                    inputs.end(),
+                    comp_it,
+                    [] __device__(gpu_inflate_input_s in) {
+                      return thrust::make_tuple(in.srcDevice, in.srcSize, in.dstDevice, in.dstSize);
+                    });
+
+  nvcomp_status = batched_decompress_async(type,
+                                           compressed_data_ptrs.data(),
+                                           compressed_data_sizes.data(),
+                                           uncompressed_data_sizes.data(),
+                                           actual_uncompressed_data_sizes.data(),
+                                           num_chunks,
+                                           scratch.data(),
+                                           scratch.size(),
+                                           uncompressed_data_ptrs.data(),
+                                           nvcomp_statuses.data(),
+                                           stream);
+  CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
+               "Unable to perform " + name + " decompression");
+
+  CUDF_EXPECTS(thrust::equal(rmm::exec_policy(stream),
+                             nvcomp_statuses.begin(),
+                             nvcomp_statuses.end(),
+                             thrust::make_constant_iterator(nvcompStatus_t::nvcompSuccess)),
+               "Error during " + name + " decompression");
+  if (is_exact_size) {
+    CUDF_EXPECTS(thrust::equal(rmm::exec_policy(stream),
+                               uncompressed_data_sizes.begin(),
+                               uncompressed_data_sizes.end(),
+                               actual_uncompressed_data_sizes.begin()),
+                 "Mismatch in expected and actual decompressed size during " + name +
+                   " decompression");
+  }
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator(0ul),
+    num_chunks,
+    [statuses, actual_uncomp_sizes = actual_uncompressed_data_sizes.data()] __device__(auto i) {
+      statuses[i].bytes_written = actual_uncomp_sizes[i];
+      statuses[i].status        = 0;
+    });
+}
+
+size_t batched_compress_get_max_output_chunk_size(compression_type type,
+                                                   size_t max_uncomp_chunk_size)
+{
+  size_t max_comp_chunk_size = 0;
+  nvcompStatus_t status      = nvcompStatus_t::nvcompErrorNotSupported;
+  switch (type) {
+    case compression_type::SNAPPY:
+      status = nvcompBatchedSnappyCompressGetMaxOutputChunkSize(
+        max_uncomp_chunk_size, nvcompBatchedSnappyDefaultOpts, &max_comp_chunk_size);
+      break;
+    case compression_type::LZ4:
+      status = nvcompBatchedLZ4CompressGetMaxOutputChunkSize(
+        max_uncomp_chunk_size, nvcompBatchedLZ4DefaultOpts, &max_comp_chunk_size);
+      break;
+  }
+  CUDF_EXPECTS(status == nvcompStatus_t::nvcompSuccess,
+               "Unable to get the maximum " + compression_type_name(type) + " compressed size");
+  return max_comp_chunk_size;
+}
+
+void batched_compress(compression_type type,
+                      device_span<gpu_inflate_input_s const> inputs,
+                      device_span<gpu_inflate_status_s> statuses,
+                      size_t max_uncomp_chunk_size,
+                      rmm::cuda_stream_view stream)
+{
+  auto const num_chunks = inputs.size();
+  auto set_error_statuses = [&]() {
+    thrust::for_each(rmm::exec_policy(stream),
+                     statuses.begin(),
+                     statuses.end(),
+                     [] __device__(gpu_inflate_status_s & stat) { stat.status = 1; });
+  };
+
+  size_t temp_size;
+  auto nvcomp_status =
+    batched_compress_get_temp_size(type, num_chunks, max_uncomp_chunk_size, &temp_size);
+  if (nvcomp_status != nvcompStatus_t::nvcompSuccess) { return set_error_statuses(); }
+
+  rmm::device_buffer scratch(temp_size, stream);
+  rmm::device_uvector<void const*> uncompressed_data_ptrs(num_chunks, stream);
+  rmm::device_uvector<size_t> uncompressed_data_sizes(num_chunks, stream);
+  rmm::device_uvector<void*> compressed_data_ptrs(num_chunks, stream);
+  rmm::device_uvector<size_t> compressed_bytes_written(num_chunks, stream);
+
+  // nvcomp does not use `dstSize`; the destinations are sized for the maximum output size
+  auto comp_it = thrust::make_zip_iterator(uncompressed_data_ptrs.begin(),
+                                           uncompressed_data_sizes.begin(),
+                                           compressed_data_ptrs.begin());
+  thrust::transform(rmm::exec_policy(stream),
+                    inputs.begin(),
+                    inputs.end(),
+                    comp_it,
+                    [] __device__(gpu_inflate_input_s in) {
+                      return thrust::make_tuple(in.srcDevice, in.srcSize, in.dstDevice);
+                    });
+  nvcomp_status = batched_compress_async(type,
+                                         uncompressed_data_ptrs.data(),
+                                         uncompressed_data_sizes.data(),
+                                         max_uncomp_chunk_size,
+                                         num_chunks,
+                                         scratch.data(),
+                                         scratch.size(),
+                                         compressed_data_ptrs.data(),
+                                         compressed_bytes_written.data(),
+                                         stream);
+  if (nvcomp_status != nvcompStatus_t::nvcompSuccess) { return set_error_statuses(); }
+
+  // Given enough output space, nvcomp compression always succeeds
+  thrust::transform(rmm::exec_policy(stream),
+                    compressed_bytes_written.begin(),
+                    compressed_bytes_written.end(),
+                    statuses.begin(),
+                    [] __device__(size_t size) {
+                      gpu_inflate_status_s status{};
+                      status.bytes_written = size;
+                      return status;
+                    });
+}
+
+}  // namespace cudf::io::nvcomp
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "gpuinflate.h"
+
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf::io::nvcomp {
+
+/**
+ * @brief Compression types supported by the nvCOMP batched API
+ */
+enum class compression_type { SNAPPY, LZ4 };
+
+/**
+ * @brief Decompresses a batch of independent blocks with nvCOMP
+ *
+ * Fails if any of the blocks cannot be decompressed, or if `is_exact_size` is set and a block
+ * does not decompress to exactly the size of its destination.
+ *
+ * @param[in] type Compression type of the blocks
+ * @param[in] inputs Device descriptors of the blocks to decompress
+ * @param[out] statuses Device output status of each block
+ * @param[in] max_uncomp_chunk_size Maximum size of a decompressed block
+ * @param[in] is_exact_size Whether the destination sizes are the exact decompressed sizes, rather
+ * than upper bounds
+ * @param[in] stream CUDA stream to use
+ */
+void batched_decompress(compression_type type,
+                        device_span<gpu_inflate_input_s const> inputs,
+                        device_span<gpu_inflate_status_s> statuses,
+                        size_t max_uncomp_chunk_size,
+                        bool is_exact_size,
+                        rmm::cuda_stream_view stream);
+
+/**
+ * @brief Returns the maximum size of a compressed block, for blocks of up to the given size
+ *
+ * @param[in] type Compression type
+ * @param[in] max_uncomp_chunk_size Maximum size of a block to compress
+ */
+size_t batched_compress_get_max_output_chunk_size(compression_type type,
+                                                   size_t max_uncomp_chunk_size);
+
+/**
+ * @brief Compresses a batch of independent blocks with nvCOMP
+ *
+ * The destination of each block must hold `batched_compress_get_max_output_chunk_size` bytes. If
+ * nvCOMP fails, all blocks are reported with a non-zero status, which the writers handle by storing
+ * the blocks uncompressed.
+ *
+ * @param[in] type Compression type
+ * @param[in] inputs Device descriptors of the blocks to compress
+ * @param[out] statuses Device output status of each block
+ * @param[in] max_uncomp_chunk_size Maximum size of a block to compress
+ * @param[in] stream CUDA stream to use
+ */
+void batched_compress(compression_type type,
+                      device_span<gpu_inflate_input_s const> inputs,
+                      device_span<gpu_inflate_status_s> statuses,
+                      size_t max_uncomp_chunk_size,
+                      rmm::cuda_stream_view stream);
+
+}  // namespace cudf::io::nvcomp
@@ -77,6 +77,10 @@ For more information on these sources, see the manual.
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 namespace cudf {
 namespace io {
 // If BZ_OUTBUFF_FULL is returned and block_start is non-NULL, dstlen will be updated to point to
@@ -102,5 +106,72 @@ int32_t cpu_bz2_uncompress(const uint8_t* input,
                            size_t* dstlen,
                            uint64_t* block_start = nullptr);
 
+/**
+ * @brief Decodes the blocks of bzip2 compressed data in parallel.
+ *
+ * bzip2 blocks can be decoded independently once their positions are known. The data is first
+ * scanned for block signatures, at any bit alignment; batches of blocks are then decoded
+ * concurrently, and chained from the start of the stream, so that signatures that appear by chance
+ * within compressed data are discarded. Concatenated bzip2 streams (e.g. written by pbzip2) are
+ * decoded as a single stream.
+ */
+class bz2_block_decoder {
+ public:
+  /**
+   * @brief Constructor; scans the data for block signatures.
+   *
+   * @param input bzip2 compressed data; must outlive the decoder
+   * @param inlen Size of the compressed data
+   */
+  bz2_block_decoder(const uint8_t* input, size_t inlen);
+
+  /**
+   * @brief Decodes the next blocks of the data.
+   *
+   * @param max_blocks Maximum number of blocks to decode
+   * @param[out] blocks Vector to which the uncompressed data of each decoded block is appended
+   *
+   * @return BZ_OK on success, BZ_MEM_ERROR if an allocation failed, otherwise an error code
+   */
+  int32_t decode(size_t max_blocks, std::vector<std::vector<char>>& blocks);
+
+  /**
+   * @brief Decodes all remaining blocks of the data.
+   *
+   * Each block is decoded directly to its offset in the output, so that the uncompressed data is
+   * not held twice in memory.
+   *
+   * @param[out] dst Vector to which the uncompressed data is appended
+   *
+   * @return BZ_OK on success, BZ_MEM_ERROR if an allocation failed, otherwise an error code
+   */
+  int32_t decode(std::vector<char>& dst);
+
+  /**
+   * @brief Returns whether all blocks have been decoded.
+   */
+  [[nodiscard]] bool is_done() const { return _is_done; }
+
+ private:
+  bool start_stream(size_t byte_offset);
+  void end_stream(uint64_t end_bit);
+  /**
+   * @brief Decodes the next blocks in batches; the uncompressed data of each batch is written to
+   * the destinations that `allocate` returns for the sizes of its blocks.
+   */
+  template <typename Allocate>
+  int32_t decode_blocks(size_t max_blocks, Allocate const& allocate);
+
+  const uint8_t* _input;
+  size_t _inlen;
+  // Bit offsets of the block signatures found in the data
+  std::vector<uint64_t> _signatures;
+  size_t _next_signature = 0;
+  // Bit offset of the next block
+  uint64_t _next_block = 0;
+  bool _is_started     = false;
+  bool _is_done        = false;
+};
+
 }  // namespace io
 }  // namespace cudf
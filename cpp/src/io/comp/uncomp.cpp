@@ -14,15 +14,22 @@
  * limitations under the License.
  */
 
+#include "host_batch_decompressor.hpp"
 #include "io_uncomp.h"
-#include "unbz2.h"  // bz2 uncompress
+#include "unbz2.h"   // bz2 uncompress
+#include "unzstd.h"  // zstd uncompress
+
+#include <io/utilities/file_io_utilities.hpp>
 
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <cuda_runtime.h>
 
+#include <algorithm>
+#include <array>
 #include <cstring>  // memset
+#include <limits>
 
 #include <zlib.h>  // uncompress
 
@@ -124,6 +131,13 @@ struct zip_archive_s {
   const zip_cdfh_s* cdfh;    // start of central directory file headers
 };
 
+struct compressed_stream_s {
+  int stream_type;           // IO_UNCOMP_STREAM_TYPE_XXX
+  const uint8_t* comp_data;  // compressed data (nullptr if not found)
+  size_t comp_len;           // Compressed data length
+  size_t uncomp_len;         // Uncompressed data length (0 if unknown)
+};
+
 bool ParseGZArchive(gz_archive_s* dst, const uint8_t* raw, size_t len)
 {
   const gz_file_header_s* fhdr;
@@ -281,27 +295,160 @@ int cpu_inflate_vector(std::vector<char>& dst, const uint8_t* comp_data, size_t
 }
 
 /**
- * @brief Uncompresses a gzip/zip/bzip2/xz file stored in system memory.
+ * @brief Returns whether the data starts with a gzip member header.
  *
- * The result is allocated and stored in a vector.
- * If the function call fails, the output vector is empty.
+ * Checks the signature, the DEFLATE compression method and that no reserved flag is set.
+ */
+bool is_gzip_member_start(const uint8_t* raw, size_t len)
+{
+  return len >= sizeof(gz_file_header_s) && raw[0] == 0x1f && raw[1] == 0x8b && raw[2] == 8 &&
+         (raw[3] & 0xe0) == 0;
+}
+
+/**
+ * @brief Returns the compressed size of the BGZF block at the start of the data.
  *
- * @param[in] src Pointer to the compressed data in system memory
- * @param[in] src_size The size of the compressed data, in bytes
- * @param[in] stream_type Type of compression of the input data
+ * BGZF blocks (e.g. written by bgzip) are gzip members that store their total size in a "BC"
+ * subfield of the extra header field.
  *
- * @return Vector containing the uncompressed output
+ * @return Size of the block, 0 if the data does not start with a BGZF block header
  */
-std::vector<char> io_uncompress_single_h2d(const void* src, size_t src_size, int stream_type)
+size_t bgzf_block_size(const uint8_t* raw, size_t len)
+{
+  constexpr size_t fhdr_size = sizeof(gz_file_header_s);
+  if (!is_gzip_member_start(raw, len) || !(raw[3] & GZIPHeaderFlag::fextra) ||
+      len < fhdr_size + 2) {
+    return 0;
+  }
+  size_t const xlen = raw[fhdr_size] | (raw[fhdr_size + 1] << 8);
+  if (len < fhdr_size + 2 + xlen) return 0;
+  const uint8_t* sub       = raw + fhdr_size + 2;
+  const uint8_t* const end = sub + xlen;
+  while (end - sub >= 4) {
+    size_t const sub_len = sub[2] | (sub[3] << 8);
+    if (sub[0] == 'B' && sub[1] == 'C' && sub_len == 2 && end - sub >= 6) {
+      return (sub[4] | (sub[5] << 8)) + 1;
+    }
+    sub += 4 + sub_len;
+  }
+  return 0;
+}
+
+/**
+ * @brief Inflates the gzip member at the start of the data.
+ *
+ * zlib decodes the header and the trailer of the member, and verifies the CRC32 and the size of
+ * the uncompressed data.
+ *
+ * @param[out] dst Uncompressed data of the member
+ * @param[in] src Compressed data, starting with a gzip member
+ *
+ * @return Compressed size of the member, 0 if the data does not start with a valid, whole member
+ */
+size_t cpu_inflate_gzip_member(std::vector<char>& dst, host_span<uint8_t const> src)
+{
+  z_stream strm{};
+  // +16 to decode the gzip header and trailer
+  if (inflateInit2(&strm, 15 + 16) != Z_OK) { return 0; }
+  constexpr size_t max_chunk = std::numeric_limits<uInt>::max();
+  size_t in_pos              = 0;
+  // The data may extend past the member; start small and grow geometrically
+  dst.resize(std::min<size_t>(src.size() * 4 + 4096, 1 << 20));
+  int zerr = Z_OK;
+  do {
+    if (strm.avail_in == 0) {
+      if (in_pos == src.size()) { break; }  // Truncated member
+      strm.next_in  = const_cast<Bytef*>(src.data() + in_pos);
+      strm.avail_in = std::min(src.size() - in_pos, max_chunk);
+      in_pos += strm.avail_in;
+    }
+    if (strm.total_out == dst.size()) { dst.resize(dst.size() * 2); }
+    strm.next_out  = reinterpret_cast<Bytef*>(dst.data()) + strm.total_out;
+    strm.avail_out = std::min(dst.size() - strm.total_out, max_chunk);
+    zerr           = inflate(&strm, Z_NO_FLUSH);
+  } while (zerr == Z_OK || zerr == Z_BUF_ERROR);
+  size_t const consumed = (zerr == Z_STREAM_END) ? strm.total_in : 0;
+  dst.resize(consumed != 0 ? strm.total_out : 0);
+  inflateEnd(&strm);
+  return consumed;
+}
+
+/**
+ * @brief Inflates the consecutive BGZF blocks at the start of the data in parallel.
+ *
+ * BGZF blocks are gzip members whose sizes are read from their headers, so they can be inflated
+ * independently. Other gzip members only end where inflating them ends, and are inflated one after
+ * the other by the callers.
+ *
+ * @param[in] src Compressed data, starting with a gzip member
+ * @param[out] consumed Compressed size of the returned members
+ *
+ * @return Uncompressed data of the whole BGZF blocks at the start of `src`; empty if `src` does not
+ * start with multiple blocks, which are then better inflated as a stream
+ */
+std::vector<std::vector<char>> cpu_inflate_gzip_members(host_span<uint8_t const> src,
+                                                        size_t* consumed)
+{
+  *consumed = 0;
+  std::vector<size_t> starts;
+  size_t pos = 0;
+  while (pos < src.size()) {
+    auto const block_size = bgzf_block_size(src.data() + pos, src.size() - pos);
+    if (block_size == 0 || block_size > src.size() - pos) { break; }
+    starts.push_back(pos);
+    pos += block_size;
+  }
+  if (starts.size() < 2) { return {}; }
+  starts.push_back(pos);
+
+  auto const num_blocks = starts.size() - 1;
+  std::vector<std::vector<char>> outputs(num_blocks);
+  std::vector<size_t> block_sizes(num_blocks);
+  detail::parallel_for(detail::host_decompression_pool(), 0, num_blocks, [&](size_t i) {
+    block_sizes[i] =
+      cpu_inflate_gzip_member(outputs[i], src.subspan(starts[i], starts[i + 1] - starts[i]));
+  });
+
+  // Return the blocks up to the first one that is not valid
+  size_t num_valid = 0;
+  while (num_valid < num_blocks &&
+         block_sizes[num_valid] == starts[num_valid + 1] - starts[num_valid]) {
+    ++num_valid;
+  }
+  outputs.resize(num_valid);
+  *consumed = starts[num_valid];
+  return outputs;
+}
+
+/**
+ * @brief Returns the IO_UNCOMP_STREAM_TYPE_XXX of a compression type.
+ */
+int to_stream_type(compression_type compression)
+{
+  switch (compression) {
+    case compression_type::GZIP: return IO_UNCOMP_STREAM_TYPE_GZIP;
+    case compression_type::ZIP: return IO_UNCOMP_STREAM_TYPE_ZIP;
+    case compression_type::BZIP2: return IO_UNCOMP_STREAM_TYPE_BZIP2;
+    case compression_type::XZ: return IO_UNCOMP_STREAM_TYPE_XZ;
+    default: return IO_UNCOMP_STREAM_TYPE_INFER;
+  }
+}
+
+/**
+ * @brief Locates the compressed data of a gzip/zip/bzip2 file stored in system memory.
+ *
+ * @param[in] raw Pointer to the file data in system memory
+ * @param[in] src_size The size of the file, in bytes
+ * @param[in] stream_type Type of compression of the file; inferred if IO_UNCOMP_STREAM_TYPE_INFER
+ *
+ * @return Compressed data of the file, `comp_data` is nullptr if the format is not recognized
+ */
+compressed_stream_s FindCompressedStream(const uint8_t* raw, size_t src_size, int stream_type)
 {
-  const uint8_t* raw       = static_cast<const uint8_t*>(src);
   const uint8_t* comp_data = nullptr;
   size_t comp_len          = 0;
   size_t uncomp_len        = 0;
 
-  CUDF_EXPECTS(src != nullptr, "Decompression: Source cannot be nullptr");
-  CUDF_EXPECTS(src_size != 0, "Decompression: Source size cannot be 0");
-
   switch (stream_type) {
     case IO_UNCOMP_STREAM_TYPE_INFER:
     case IO_UNCOMP_STREAM_TYPE_GZIP: {
@@ -369,6 +516,64 @@ std::vector<char> io_uncompress_single_h2d(const void* src, size_t src_size, int
       break;
   }
 
+  return {stream_type, comp_data, comp_len, uncomp_len};
+}
+
+/**
+ * @brief Concatenates blocks of uncompressed data, copying them in parallel.
+ */
+std::vector<char> concatenate_blocks(std::vector<std::vector<char>> const& blocks)
+{
+  std::vector<size_t> offsets(blocks.size() + 1, 0);
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    offsets[i + 1] = offsets[i] + blocks[i].size();
+  }
+  std::vector<char> dst(offsets.back());
+  detail::parallel_for(detail::host_decompression_pool(), 0, blocks.size(), [&](size_t i) {
+    memcpy(dst.data() + offsets[i], blocks[i].data(), blocks[i].size());
+  });
+  return dst;
+}
+
+/**
+ * @brief Uncompresses a gzip/zip/bzip2/xz file stored in system memory.
+ *
+ * The result is allocated and stored in a vector.
+ * If the function call fails, the output vector is empty.
+ *
+ * @param[in] src Pointer to the compressed data in system memory
+ * @param[in] src_size The size of the compressed data, in bytes
+ * @param[in] stream_type Type of compression of the input data
+ *
+ * @return Vector containing the uncompressed output
+ */
+std::vector<char> io_uncompress_single_h2d(const void* src, size_t src_size, int stream_type)
+{
+  CUDF_EXPECTS(src != nullptr, "Decompression: Source cannot be nullptr");
+  CUDF_EXPECTS(src_size != 0, "Decompression: Source size cannot be 0");
+
+  auto const raw = static_cast<const uint8_t*>(src);
+  if ((stream_type == IO_UNCOMP_STREAM_TYPE_GZIP || stream_type == IO_UNCOMP_STREAM_TYPE_INFER) &&
+      is_gzip_member_start(raw, src_size)) {
+    // BGZF blocks are inflated in parallel
+    size_t pos   = 0;
+    auto members = cpu_inflate_gzip_members({raw, src_size}, &pos);
+    // Other members are inflated one after the other, each from the end of the previous one
+    while (is_gzip_member_start(raw + pos, src_size - pos)) {
+      members.emplace_back();
+      auto const member_size = cpu_inflate_gzip_member(members.back(), {raw + pos, src_size - pos});
+      CUDF_EXPECTS(member_size != 0, "Decompression: error in stream");
+      pos += member_size;
+    }
+    return (members.size() == 1) ? std::move(members.front()) : concatenate_blocks(members);
+  }
+
+  auto const comp          = FindCompressedStream(raw, src_size, stream_type);
+  stream_type              = comp.stream_type;
+  const uint8_t* comp_data = comp.comp_data;
+  size_t comp_len          = comp.comp_len;
+  size_t uncomp_len        = comp.uncomp_len;
+
   CUDF_EXPECTS(comp_data != nullptr, "Unsupported compressed stream type");
   CUDF_EXPECTS(comp_len > 0, "Unsupported compressed stream type");
 
@@ -385,27 +590,11 @@ std::vector<char> io_uncompress_single_h2d(const void* src, size_t src_size, int
     return dst;
   }
   if (stream_type == IO_UNCOMP_STREAM_TYPE_BZIP2) {
-    size_t src_ofs = 0;
-    size_t dst_ofs = 0;
-    int bz_err     = 0;
-    std::vector<char> dst(uncomp_len);
-    do {
-      size_t dst_len = uncomp_len - dst_ofs;
-      bz_err         = cpu_bz2_uncompress(
-        comp_data, comp_len, reinterpret_cast<uint8_t*>(dst.data()) + dst_ofs, &dst_len, &src_ofs);
-      if (bz_err == BZ_OUTBUFF_FULL) {
-        // TBD: We could infer the compression ratio based on produced/consumed byte counts
-        // in order to minimize realloc events and over-allocation
-        dst_ofs = dst_len;
-        dst_len = uncomp_len + (uncomp_len / 2);
-        dst.resize(dst_len);
-        uncomp_len = dst_len;
-      } else if (bz_err == 0) {
-        uncomp_len = dst_len;
-        dst.resize(uncomp_len);
-      }
-    } while (bz_err == BZ_OUTBUFF_FULL);
-    CUDF_EXPECTS(bz_err == 0, "Decompression: error in stream");
+    // Decode all blocks in parallel, directly into the output
+    bz2_block_decoder decoder(comp_data, comp_len);
+    std::vector<char> dst;
+    dst.reserve(uncomp_len);
+    CUDF_EXPECTS(decoder.decode(dst) == BZ_OK, "Decompression: error in stream");
     return dst;
   }
 
@@ -424,17 +613,556 @@ std::vector<char> io_uncompress_single_h2d(const void* src, size_t src_size, int
 std::vector<char> get_uncompressed_data(host_span<char const> const data,
                                         compression_type compression)
 {
-  auto const comp_type = [compression]() {
-    switch (compression) {
-      case compression_type::GZIP: return IO_UNCOMP_STREAM_TYPE_GZIP;
-      case compression_type::ZIP: return IO_UNCOMP_STREAM_TYPE_ZIP;
-      case compression_type::BZIP2: return IO_UNCOMP_STREAM_TYPE_BZIP2;
-      case compression_type::XZ: return IO_UNCOMP_STREAM_TYPE_XZ;
-      default: return IO_UNCOMP_STREAM_TYPE_INFER;
+  return io_uncompress_single_h2d(data.data(), data.size(), to_stream_type(compression));
+}
+
+class stream_decompressor::impl {
+ public:
+  impl(datasource* source, compression_type compression);
+
+  ~impl()
+  {
+    if (_inflate_initialized) { inflateEnd(&_strm); }
+  }
+
+  size_t decompress(host_span<char> dst);
+
+  [[nodiscard]] bool is_done() const { return _done and _decoded_idx == _decoded.size(); }
+
+  [[nodiscard]] size_t uncompressed_size_hint() const { return _uncomp_size_hint; }
+
+ private:
+  bool next_input();
+  void start_gzip_member();
+  size_t inflate_next(host_span<char> dst);
+  void decode_bz2_blocks();
+
+  // Size of the windows of gzip compressed data read from the source
+  static constexpr size_t input_window_size = 16 * 1024 * 1024;
+
+  datasource* _source;
+  int _stream_type = IO_UNCOMP_STREAM_TYPE_INFER;
+  // Current window of gzip compressed data
+  std::vector<uint8_t> _window;
+  // Whole compressed file, for zip and bzip2 sources
+  std::unique_ptr<datasource::buffer> _input;
+  // Compressed data in `_input`
+  const uint8_t* _comp_data = nullptr;
+  size_t _comp_len          = 0;
+  // Position of the compressed data not yet passed to zlib, in the source or in `_comp_data`
+  size_t _input_pos = 0;
+  size_t _input_end = 0;
+  bool _done        = false;
+  // Expected size of the uncompressed data, from the gzip trailer or the zip header; 0 if unknown
+  size_t _uncomp_size_hint = 0;
+
+  z_stream _strm{};
+  bool _inflate_initialized = false;
+  // Whether the next gzip compressed data starts a member
+  bool _at_member_start = false;
+
+  std::unique_ptr<bz2_block_decoder> _bz2_decoder;
+
+  // gzip members or bzip2 blocks decoded in parallel, not yet returned
+  std::vector<std::vector<char>> _decoded;
+  size_t _decoded_idx = 0;
+  size_t _decoded_pos = 0;
+};
+
+stream_decompressor::impl::impl(datasource* source, compression_type compression)
+  : _source(source)
+{
+  auto const src_size    = source->size();
+  auto const stream_type = to_stream_type(compression);
+  CUDF_EXPECTS(src_size != 0, "Decompression: Source size cannot be 0");
+
+  if (stream_type == IO_UNCOMP_STREAM_TYPE_GZIP || stream_type == IO_UNCOMP_STREAM_TYPE_INFER) {
+    // zlib decodes the gzip headers; the compressed data is read on demand
+    auto const header = source->host_read(0, std::min(src_size, sizeof(gz_file_header_s)));
+    if (is_gzip_member_start(header->data(), header->size())) {
+      _stream_type     = IO_UNCOMP_STREAM_TYPE_GZIP;
+      _input_end       = src_size;
+      _at_member_start = true;
+      _window.reserve(input_window_size);
+      // ISIZE of the last member; only the size of the whole data for single-member sources
+      if (src_size >= sizeof(gz_file_header_s) + 8) {
+        uint32_t isize     = 0;
+        auto const trailer = source->host_read(src_size - sizeof(isize), sizeof(isize));
+        memcpy(&isize, trailer->data(), sizeof(isize));
+        _uncomp_size_hint = isize;
+      }
     }
-  }();
+  }
+  if (_stream_type == IO_UNCOMP_STREAM_TYPE_INFER) {
+    _input          = source->host_read(0, src_size);
+    auto const comp = FindCompressedStream(_input->data(), _input->size(), stream_type);
+    CUDF_EXPECTS(comp.comp_data != nullptr && comp.comp_len > 0,
+                 "Unsupported compressed stream type");
+    _stream_type = comp.stream_type;
+    _comp_data   = comp.comp_data;
+    _comp_len    = comp.comp_len;
+    _input_end   = comp.comp_len;
+    if (_stream_type != IO_UNCOMP_STREAM_TYPE_BZIP2) { _uncomp_size_hint = comp.uncomp_len; }
+  }
+
+  if (_stream_type == IO_UNCOMP_STREAM_TYPE_GZIP || _stream_type == IO_UNCOMP_STREAM_TYPE_ZIP) {
+    // +16 to decode gzip headers and trailers, -15 for raw data without GZIP headers
+    auto const window_bits = (_stream_type == IO_UNCOMP_STREAM_TYPE_GZIP) ? 15 + 16 : -15;
+    CUDF_EXPECTS(inflateInit2(&_strm, window_bits) == Z_OK,
+                 "Decompression: failed to initialize zlib");
+    _inflate_initialized = true;
+  } else {
+    CUDF_EXPECTS(_stream_type == IO_UNCOMP_STREAM_TYPE_BZIP2, "Unsupported compressed stream type");
+    _bz2_decoder = std::make_unique<bz2_block_decoder>(_comp_data, _comp_len);
+  }
+}
 
-  return io_uncompress_single_h2d(data.data(), data.size(), comp_type);
+/**
+ * @brief Passes more compressed data to zlib.
+ *
+ * gzip compressed data is read from the source in windows; the data not yet consumed by zlib is
+ * moved to the start of the new window.
+ *
+ * @return false if all compressed data has been passed
+ */
+bool stream_decompressor::impl::next_input()
+{
+  if (_input_pos >= _input_end) { return false; }
+  if (_comp_data != nullptr) {
+    auto const size = std::min<size_t>(_input_end - _input_pos,
+                                       std::numeric_limits<uInt>::max() - _strm.avail_in);
+    if (_strm.avail_in == 0) { _strm.next_in = const_cast<Bytef*>(_comp_data + _input_pos); }
+    _strm.avail_in += size;
+    _input_pos += size;
+    return true;
+  }
+  auto const leftover = _strm.avail_in;
+  auto const size     = std::min(input_window_size - leftover, _input_end - _input_pos);
+  // The window is allocated upfront, so resizing it does not move the data
+  if (leftover != 0) { memmove(_window.data(), _strm.next_in, leftover); }
+  _window.resize(leftover + size);
+  CUDF_EXPECTS(_source->host_read(_input_pos, size, _window.data() + leftover) == size,
+               "Decompression: truncated stream");
+  _strm.next_in  = _window.data();
+  _strm.avail_in = leftover + size;
+  _input_pos += size;
+  return true;
+}
+
+/**
+ * @brief Starts decoding the next gzip member.
+ *
+ * The whole BGZF blocks in the current window of compressed data are inflated in parallel;
+ * otherwise, the next member is inflated as a stream, which may span multiple windows.
+ */
+void stream_decompressor::impl::start_gzip_member()
+{
+  // Top up the window, so that it holds as many whole members as possible
+  if (_strm.avail_in < input_window_size / 2) { next_input(); }
+  if (!is_gzip_member_start(_strm.next_in, _strm.avail_in)) {
+    // End of the data; like gzip, ignore trailing bytes that do not start a member
+    _done = true;
+    return;
+  }
+  size_t consumed = 0;
+  _decoded        = cpu_inflate_gzip_members({_strm.next_in, _strm.avail_in}, &consumed);
+  _decoded_idx    = 0;
+  _decoded_pos    = 0;
+  if (_decoded.empty()) {
+    CUDF_EXPECTS(inflateReset(&_strm) == Z_OK, "Decompression: error in stream");
+    _at_member_start = false;
+  } else {
+    _strm.next_in += consumed;
+    _strm.avail_in -= consumed;
+  }
+}
+
+/**
+ * @brief Inflates the next data of a gzip member or of a zip stream.
+ *
+ * @return Number of bytes written to `dst`
+ */
+size_t stream_decompressor::impl::inflate_next(host_span<char> dst)
+{
+  if (_strm.avail_in == 0) {
+    CUDF_EXPECTS(next_input(), "Decompression: truncated stream");
+  }
+  auto const out_size = std::min<size_t>(dst.size(), std::numeric_limits<uInt>::max());
+  _strm.next_out      = reinterpret_cast<Bytef*>(dst.data());
+  _strm.avail_out     = out_size;
+  auto const zerr     = inflate(&_strm, Z_NO_FLUSH);
+  CUDF_EXPECTS(zerr == Z_OK || zerr == Z_STREAM_END || zerr == Z_BUF_ERROR,
+               "Decompression: error in stream");
+  if (zerr == Z_STREAM_END) {
+    // gzip data may continue with another member
+    _at_member_start = (_stream_type == IO_UNCOMP_STREAM_TYPE_GZIP);
+    _done            = !_at_member_start;
+  }
+  return out_size - _strm.avail_out;
+}
+
+/**
+ * @brief Decodes the next bzip2 blocks, enough to keep all decompression threads busy.
+ */
+void stream_decompressor::impl::decode_bz2_blocks()
+{
+  auto const num_blocks =
+    2 * static_cast<size_t>(detail::host_decompression_pool().get_thread_count());
+  _decoded.clear();
+  _decoded_idx = 0;
+  _decoded_pos = 0;
+  CUDF_EXPECTS(_bz2_decoder->decode(num_blocks, _decoded) == BZ_OK,
+               "Decompression: error in stream");
+  _done = _bz2_decoder->is_done();
+}
+
+size_t stream_decompressor::impl::decompress(host_span<char> dst)
+{
+  size_t written = 0;
+  while (written < dst.size()) {
+    if (_decoded_idx < _decoded.size()) {
+      auto const& block = _decoded[_decoded_idx];
+      auto const size   = std::min(dst.size() - written, block.size() - _decoded_pos);
+      memcpy(dst.data() + written, block.data() + _decoded_pos, size);
+      written += size;
+      _decoded_pos += size;
+      if (_decoded_pos == block.size()) {
+        _decoded[_decoded_idx++] = {};
+        _decoded_pos             = 0;
+      }
+      continue;
+    }
+    if (_done) break;
+    if (_stream_type == IO_UNCOMP_STREAM_TYPE_BZIP2) {
+      decode_bz2_blocks();
+    } else if (_at_member_start) {
+      start_gzip_member();
+    } else {
+      written += inflate_next(dst.subspan(written, dst.size() - written));
+    }
+  }
+  return written;
+}
+
+stream_decompressor::stream_decompressor(datasource* source, compression_type compression)
+  : _impl(std::make_unique<impl>(source, compression))
+{
+}
+
+stream_decompressor::~stream_decompressor() = default;
+
+size_t stream_decompressor::decompress(host_span<char> dst) { return _impl->decompress(dst); }
+
+bool stream_decompressor::is_done() const { return _impl->is_done(); }
+
+size_t stream_decompressor::uncompressed_size_hint() const
+{
+  return _impl->uncompressed_size_hint();
+}
+
+decompressed_windows::decompressed_windows(datasource* source,
+                                           compression_type compression,
+                                           size_t window_size)
+  : _decompressor(source, compression),
+    _windows{std::vector<char>(window_size), std::vector<char>(window_size)}
+{
+  decompress_next_window();
+}
+
+decompressed_windows::~decompressed_windows()
+{
+  // The pending task writes to the windows
+  if (_next.valid()) { _next.wait(); }
+}
+
+void decompressed_windows::decompress_next_window()
+{
+  _next = std::async(std::launch::async, [this, &window = _windows[_next_window]]() {
+    auto const size = _decompressor.decompress(window);
+    return std::pair{size, _decompressor.is_done()};
+  });
+}
+
+host_span<char const> decompressed_windows::next()
+{
+  if (_is_done) { return {}; }
+  auto const [size, is_last] = _next.get();
+  auto const& window         = _windows[_next_window];
+  _is_done                   = is_last;
+  // The window returned by the previous call is no longer in use
+  _next_window = 1 - _next_window;
+  if (not _is_done) { decompress_next_window(); }
+  return {window.data(), size};
+}
+
+namespace {
+
+// DEFLATE back-references reach up to 32KB of preceding uncompressed data
+constexpr size_t deflate_window_size = 32 * 1024;
+
+constexpr std::array<char, 8> gzip_index_magic{'G', 'Z', 'I', 'D', 'X', 'v', '0', '1'};
+
+/**
+ * @brief Position from which a gzip stream can be inflated
+ */
+struct gzip_checkpoint_s {
+  uint64_t comp_offset;         // Offset of the compressed byte that follows the checkpoint
+  uint64_t uncomp_offset;       // Offset of the uncompressed data that follows the checkpoint
+  uint8_t bits;                 // Number of bits of the previous compressed byte to inflate first
+  std::vector<uint8_t> window;  // Uncompressed data preceding the checkpoint, up to 32KB
+};
+
+struct gzip_index_s {
+  uint64_t comp_size;    // Size of the gzip source
+  uint64_t uncomp_size;  // Size of the uncompressed data
+  std::vector<gzip_checkpoint_s> checkpoints;
+};
+
+template <typename T>
+void append_value(std::vector<char>& dst, T const& value)
+{
+  auto const bytes = reinterpret_cast<char const*>(&value);
+  dst.insert(dst.end(), bytes, bytes + sizeof(T));
+}
+
+std::vector<char> serialize_gzip_index(gzip_index_s const& index)
+{
+  std::vector<char> dst(gzip_index_magic.cbegin(), gzip_index_magic.cend());
+  append_value(dst, index.comp_size);
+  append_value(dst, index.uncomp_size);
+  append_value(dst, static_cast<uint64_t>(index.checkpoints.size()));
+  for (auto const& cp : index.checkpoints) {
+    append_value(dst, cp.comp_offset);
+    append_value(dst, cp.uncomp_offset);
+    append_value(dst, cp.bits);
+    append_value(dst, static_cast<uint32_t>(cp.window.size()));
+    dst.insert(dst.end(), cp.window.cbegin(), cp.window.cend());
+  }
+  return dst;
+}
+
+gzip_index_s deserialize_gzip_index(host_span<char const> src)
+{
+  size_t pos      = 0;
+  auto read_bytes = [&](void* dst, size_t size) {
+    CUDF_EXPECTS(src.size() - pos >= size, "Invalid gzip index");
+    memcpy(dst, src.data() + pos, size);
+    pos += size;
+  };
+  auto read_value = [&](auto& value) { read_bytes(&value, sizeof(value)); };
+
+  std::array<char, gzip_index_magic.size()> magic;
+  read_bytes(magic.data(), magic.size());
+  CUDF_EXPECTS(magic == gzip_index_magic, "Invalid gzip index");
+  gzip_index_s index;
+  uint64_t num_checkpoints;
+  read_value(index.comp_size);
+  read_value(index.uncomp_size);
+  read_value(num_checkpoints);
+  CUDF_EXPECTS(num_checkpoints != 0, "Invalid gzip index");
+  for (uint64_t i = 0; i < num_checkpoints; ++i) {
+    gzip_checkpoint_s cp;
+    uint32_t window_size;
+    read_value(cp.comp_offset);
+    read_value(cp.uncomp_offset);
+    read_value(cp.bits);
+    read_value(window_size);
+    CUDF_EXPECTS(window_size <= deflate_window_size && cp.bits < 8, "Invalid gzip index");
+    cp.window.resize(window_size);
+    read_bytes(cp.window.data(), window_size);
+    if (index.checkpoints.empty()) {
+      CUDF_EXPECTS(cp.uncomp_offset == 0, "Invalid gzip index");
+    } else {
+      auto const& prev = index.checkpoints.back();
+      CUDF_EXPECTS(cp.uncomp_offset > prev.uncomp_offset && cp.comp_offset > prev.comp_offset,
+                   "Invalid gzip index");
+    }
+    CUDF_EXPECTS(cp.comp_offset <= index.comp_size && cp.uncomp_offset <= index.uncomp_size,
+                 "Invalid gzip index");
+    index.checkpoints.push_back(std::move(cp));
+  }
+  return index;
+}
+
+/**
+ * @brief Inflates a range of uncompressed data that follows a checkpoint.
+ *
+ * @param cp Checkpoint from which to inflate
+ * @param comp Compressed data, starting with the byte that holds the first bits to inflate
+ * @param skip Number of uncompressed bytes between the checkpoint and the range
+ * @param dst Destination of the range
+ *
+ * @return Whether the whole range was inflated
+ */
+bool inflate_from_checkpoint(gzip_checkpoint_s const& cp,
+                             host_span<uint8_t const> comp,
+                             size_t skip,
+                             host_span<char> dst)
+{
+  z_stream strm{};
+  // -15 for raw data without GZIP headers
+  if (inflateInit2(&strm, -15) != Z_OK) { return false; }
+  size_t in_pos = 0;
+  bool is_valid = true;
+  if (cp.bits != 0) {
+    is_valid = comp.size() != 0 && inflatePrime(&strm, cp.bits, comp[0] >> (8 - cp.bits)) == Z_OK;
+    in_pos   = 1;
+  }
+  if (is_valid && !cp.window.empty()) {
+    is_valid = inflateSetDictionary(&strm, cp.window.data(), cp.window.size()) == Z_OK;
+  }
+
+  constexpr size_t max_chunk = std::numeric_limits<uInt>::max();
+  std::vector<Bytef> skipped(std::min<size_t>(skip, 64 * 1024));
+  auto const total_size = skip + dst.size();
+  size_t out_pos        = 0;
+  while (is_valid && out_pos < total_size) {
+    if (strm.avail_in == 0) {
+      if (in_pos >= comp.size()) {
+        is_valid = false;
+        break;
+      }
+      strm.next_in  = const_cast<Bytef*>(comp.data() + in_pos);
+      strm.avail_in = std::min(comp.size() - in_pos, max_chunk);
+      in_pos += strm.avail_in;
+    }
+    if (out_pos < skip) {
+      strm.next_out  = skipped.data();
+      strm.avail_out = std::min(skipped.size(), skip - out_pos);
+    } else {
+      strm.next_out  = reinterpret_cast<Bytef*>(dst.data() + out_pos - skip);
+      strm.avail_out = std::min(total_size - out_pos, max_chunk);
+    }
+    auto const avail_out = strm.avail_out;
+    auto const zerr      = inflate(&strm, Z_NO_FLUSH);
+    out_pos += avail_out - strm.avail_out;
+    if (zerr == Z_STREAM_END) { break; }
+    is_valid = (zerr == Z_OK || zerr == Z_BUF_ERROR);
+  }
+  inflateEnd(&strm);
+  return is_valid && out_pos == total_size;
+}
+
+}  // namespace
+
+std::vector<char> build_gzip_index(datasource* source, size_t spacing)
+{
+  auto const comp_size = source->size();
+  CUDF_EXPECTS(comp_size != 0, "Decompression: Source size cannot be 0");
+
+  spacing = std::max<size_t>(spacing, 1);
+
+  gzip_index_s index{comp_size, 0, {}};
+  z_stream strm{};
+  // +16 to decode the gzip header and trailer
+  CUDF_EXPECTS(inflateInit2(&strm, 15 + 16) == Z_OK, "Decompression: failed to initialize zlib");
+  std::vector<uint8_t> input(std::min<size_t>(comp_size, 16 * 1024 * 1024));
+  // The output is only kept to fill the checkpoint windows; it is written circularly
+  std::vector<uint8_t> window(deflate_window_size);
+  size_t input_pos     = 0;
+  uint64_t last_offset = 0;
+  int zerr             = Z_OK;
+  do {
+    if (strm.avail_in == 0) {
+      CUDF_EXPECTS(input_pos < comp_size, "Decompression: truncated stream");
+      auto const size = std::min(input.size(), comp_size - input_pos);
+      source->host_read(input_pos, size, input.data());
+      strm.next_in  = input.data();
+      strm.avail_in = size;
+      input_pos += size;
+    }
+    if (strm.avail_out == 0) {
+      strm.next_out  = window.data();
+      strm.avail_out = window.size();
+    }
+    // Stop at the end of the header and of each DEFLATE block
+    zerr = inflate(&strm, Z_BLOCK);
+    CUDF_EXPECTS(zerr == Z_OK || zerr == Z_STREAM_END || zerr == Z_BUF_ERROR,
+                 "Decompression: error in stream");
+    bool const is_block_boundary = (strm.data_type & 128) && !(strm.data_type & 64);
+    if (zerr != Z_STREAM_END && is_block_boundary &&
+        (index.checkpoints.empty() || strm.total_out - last_offset >= spacing)) {
+      gzip_checkpoint_s cp{strm.total_in, strm.total_out, static_cast<uint8_t>(strm.data_type & 7)};
+      // Copy the last 32KB of output, which ends at the current window position
+      size_t const window_size = std::min<uint64_t>(strm.total_out, deflate_window_size);
+      size_t const window_end  = window.size() - strm.avail_out;
+      cp.window.resize(window_size);
+      if (window_size <= window_end) {
+        memcpy(cp.window.data(), window.data() + window_end - window_size, window_size);
+      } else {
+        auto const wrapped = window_size - window_end;
+        memcpy(cp.window.data(), window.data() + window.size() - wrapped, wrapped);
+        memcpy(cp.window.data() + wrapped, window.data(), window_end);
+      }
+      index.checkpoints.push_back(std::move(cp));
+      last_offset = strm.total_out;
+    }
+  } while (zerr != Z_STREAM_END);
+  index.uncomp_size    = strm.total_out;
+  auto const remaining = comp_size - strm.total_in;
+  auto const next      = strm.total_in;
+  inflateEnd(&strm);
+
+  if (remaining >= sizeof(gz_file_header_s)) {
+    auto const header = source->host_read(next, sizeof(gz_file_header_s));
+    CUDF_EXPECTS(!is_gzip_member_start(header->data(), header->size()),
+                 "Only single-member gzip sources can be indexed");
+  }
+  return serialize_gzip_index(index);
+}
+
+std::vector<char> decompress_gzip_range(datasource* source,
+                                        host_span<char const> index_data,
+                                        size_t offset,
+                                        size_t size)
+{
+  auto const index = deserialize_gzip_index(index_data);
+  CUDF_EXPECTS(index.comp_size == source->size(), "The gzip index does not match the source");
+  if (offset >= index.uncomp_size) { return {}; }
+  size            = std::min<size_t>(size, index.uncomp_size - offset);
+  auto const& cps = index.checkpoints;
+
+  // Segments of the range start at the last checkpoint at or before the range, and at each
+  // checkpoint within the range
+  auto const first = std::upper_bound(cps.cbegin(),
+                                      cps.cend(),
+                                      offset,
+                                      [](size_t pos, auto const& cp) {
+                                        return pos < cp.uncomp_offset;
+                                      }) -
+                     cps.cbegin() - 1;
+  auto const last = std::lower_bound(cps.cbegin(),
+                                     cps.cend(),
+                                     offset + size,
+                                     [](auto const& cp, size_t pos) {
+                                       return cp.uncomp_offset < pos;
+                                     }) -
+                    cps.cbegin();
+
+  // Read the compressed data of all segments at once
+  auto comp_start = [&](auto i) { return cps[i].comp_offset - (cps[i].bits != 0 ? 1 : 0); };
+  auto const comp_begin = comp_start(first);
+  auto const comp_end   = (static_cast<size_t>(last) < cps.size())
+                            ? std::min(cps[last].comp_offset + 1, index.comp_size)
+                            : index.comp_size;
+  auto const comp       = source->host_read(comp_begin, comp_end - comp_begin);
+
+  std::vector<char> dst(size);
+  std::vector<uint8_t> is_valid(last - first);
+  detail::parallel_for(detail::host_decompression_pool(), first, last, [&](size_t i) {
+    auto const seg_begin = cps[i].uncomp_offset;
+    auto const seg_end   = (i + 1 < cps.size()) ? cps[i + 1].uncomp_offset : index.uncomp_size;
+    auto const out_begin = std::max<size_t>(seg_begin, offset);
+    auto const out_end   = std::min<size_t>(seg_end, offset + size);
+    is_valid[i - first] =
+      inflate_from_checkpoint(cps[i],
+                              {comp->data() + comp_start(i) - comp_begin, comp_end - comp_start(i)},
+                              out_begin - seg_begin,
+                              {dst.data() + out_begin - offset, out_end - out_begin});
+  });
+  CUDF_EXPECTS(std::all_of(is_valid.cbegin(), is_valid.cend(), [](auto v) { return v != 0; }),
+               "Decompression: error in stream");
+  return dst;
 }
 
 /**
@@ -559,6 +1287,131 @@ class HostDecompressor_SNAPPY : public HostDecompressor {
   }
 };
 
+/**
+ * @brief Decodes a raw LZ4 block
+ *
+ * @param[out] dst Destination buffer
+ * @param[in] dst_len Size of the destination buffer
+ * @param[in] src Compressed block
+ * @param[in] src_len Size of the compressed block
+ * @param[out] written Number of bytes written to `dst`
+ *
+ * @returns true if the block was decoded successfully
+ */
+bool lz4_decompress_block(
+  uint8_t* dst, size_t dst_len, const uint8_t* src, size_t src_len, size_t* written)
+{
+  size_t src_pos = 0;
+  size_t dst_pos = 0;
+  // Reads the extra bytes of a literal or match length
+  auto extend_length = [&](size_t length) {
+    uint8_t b;
+    do {
+      if (src_pos >= src_len) return std::numeric_limits<size_t>::max();
+      b = src[src_pos++];
+      length += b;
+    } while (b == 255);
+    return length;
+  };
+
+  while (src_pos < src_len) {
+    uint32_t const token = src[src_pos++];
+    size_t literals      = token >> 4;
+    if (literals == 15) { literals = extend_length(literals); }
+    if (literals > src_len - src_pos || literals > dst_len - dst_pos) return false;
+    memcpy(dst + dst_pos, src + src_pos, literals);
+    src_pos += literals;
+    dst_pos += literals;
+    // The last sequence only has literals
+    if (src_pos == src_len) break;
+
+    if (src_pos + 2 > src_len) return false;
+    size_t const offset = src[src_pos] | (src[src_pos + 1] << 8);
+    src_pos += 2;
+    if (offset == 0 || offset > dst_pos) return false;
+    size_t match = token & 0xf;
+    if (match == 15) { match = extend_length(match); }
+    if (match > dst_len - dst_pos || match + 4 > dst_len - dst_pos) return false;
+    match += 4;
+    // Overlapping copy repeats the last `offset` bytes
+    for (size_t i = 0; i < match; ++i, ++dst_pos) {
+      dst[dst_pos] = dst[dst_pos - offset];
+    }
+  }
+  *written = dst_pos;
+  return true;
+}
+
+/**
+ * @brief LZ4 host decompressor class
+ *
+ * Decodes raw LZ4 blocks, or the blocks of the Hadoop framing used by the legacy LZ4 codec of
+ * Parquet, where each block is preceded by its big-endian decompressed and compressed sizes.
+ * Data that does not parse as Hadoop frames is decoded as a single raw block.
+ */
+class HostDecompressor_LZ4 : public HostDecompressor {
+ public:
+  HostDecompressor_LZ4(bool hadoop_framing_) : hadoop_framing(hadoop_framing_) {}
+  size_t Decompress(uint8_t* dstBytes,
+                    size_t dstLen,
+                    const uint8_t* srcBytes,
+                    size_t srcLen) override
+  {
+    if (!dstBytes) { return 0; }
+    size_t written = 0;
+    if (hadoop_framing && DecompressHadoop(dstBytes, dstLen, srcBytes, srcLen, &written)) {
+      return written;
+    }
+    return lz4_decompress_block(dstBytes, dstLen, srcBytes, srcLen, &written) ? written : 0;
+  }
+
+ protected:
+  static bool DecompressHadoop(
+    uint8_t* dstBytes, size_t dstLen, const uint8_t* srcBytes, size_t srcLen, size_t* written)
+  {
+    auto read_be32 = [](const uint8_t* p) {
+      return (static_cast<uint32_t>(p[0]) << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+    };
+    size_t src_pos = 0;
+    size_t dst_pos = 0;
+    while (srcLen - src_pos >= 8) {
+      size_t const block_dst_len = read_be32(srcBytes + src_pos);
+      size_t const block_src_len = read_be32(srcBytes + src_pos + 4);
+      src_pos += 8;
+      if (block_src_len > srcLen - src_pos || block_dst_len > dstLen - dst_pos) return false;
+      size_t block_written = 0;
+      if (!lz4_decompress_block(
+            dstBytes + dst_pos, block_dst_len, srcBytes + src_pos, block_src_len, &block_written) ||
+          block_written != block_dst_len) {
+        return false;
+      }
+      src_pos += block_src_len;
+      dst_pos += block_written;
+    }
+    *written = dst_pos;
+    return src_pos == srcLen;
+  }
+
+  const bool hadoop_framing;
+};
+
+/**
+ * @brief ZSTD host decompressor class
+ */
+class HostDecompressor_ZSTD : public HostDecompressor {
+ public:
+  HostDecompressor_ZSTD() {}
+  size_t Decompress(uint8_t* dstBytes,
+                    size_t dstLen,
+                    const uint8_t* srcBytes,
+                    size_t srcLen) override
+  {
+    if (!dstBytes) { return 0; }
+    return (cpu_zstd_uncompress(srcBytes, srcLen, dstBytes, &dstLen) == ZSTD_STATUS_OK) ? dstLen
+                                                                                        : 0;
+  }
+};
+
 /**
  * @brief CPU decompression class
  *
@@ -572,9 +1425,20 @@ std::unique_ptr<HostDecompressor> HostDecompressor::Create(int stream_type)
     case IO_UNCOMP_STREAM_TYPE_GZIP: return std::make_unique<HostDecompressor_ZLIB>(true);
     case IO_UNCOMP_STREAM_TYPE_INFLATE: return std::make_unique<HostDecompressor_ZLIB>(false);
     case IO_UNCOMP_STREAM_TYPE_SNAPPY: return std::make_unique<HostDecompressor_SNAPPY>();
+    case IO_UNCOMP_STREAM_TYPE_LZ4: return std::make_unique<HostDecompressor_LZ4>(false);
+    case IO_UNCOMP_STREAM_TYPE_LZ4_HADOOP: return std::make_unique<HostDecompressor_LZ4>(true);
+    case IO_UNCOMP_STREAM_TYPE_ZSTD: return std::make_unique<HostDecompressor_ZSTD>();
   }
   CUDF_FAIL("Unsupported compression type");
 }
 
+void host_decompress(int stream_type,
+                     host_span<gpu_inflate_input_s const> inputs,
+                     host_span<gpu_inflate_status_s> outputs,
+                     rmm::cuda_stream_view stream)
+{
+  reader_host_decompressor().decompress(stream_type, inputs, outputs, stream);
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief Status codes returned by `cpu_zstd_uncompress`
+ */
+enum zstd_status : int32_t {
+  ZSTD_STATUS_OK           = 0,
+  ZSTD_STATUS_DATA_ERROR   = -1,  // Malformed or truncated input
+  ZSTD_STATUS_UNSUPPORTED  = -2,  // Frames that require an external dictionary
+  ZSTD_STATUS_OUTBUFF_FULL = -3,  // Output does not fit in the destination buffer
+  ZSTD_STATUS_CHECKSUM     = -4,  // Content checksum of a frame does not match its content
+};
+
+/**
+ * @brief Decompresses a sequence of Zstandard frames (RFC 8878) on the host
+ *
+ * Skippable frames are ignored. The content checksum of the frames, if present, is verified.
+ *
+ * @param[in] input Compressed data
+ * @param[in] inlen Size of the compressed data, in bytes
+ * @param[out] dst Destination buffer
+ * @param[in,out] dstlen Size of the destination buffer on input; decompressed size on output
+ *
+ * @return `ZSTD_STATUS_OK` on success, or one of the `zstd_status` error codes
+ */
+int32_t cpu_zstd_uncompress(const uint8_t* input, size_t inlen, uint8_t* dst, size_t* dstlen);
+
+/**
+ * @brief Returns the total decompressed size stored in the frame headers of Zstandard data
+ *
+ * @param[in] input Compressed data
+ * @param[in] inlen Size of the compressed data, in bytes
+ *
+ * @return The decompressed size, or 0 if any of the frames does not store its content size
+ */
+size_t cpu_zstd_decompressed_size(const uint8_t* input, size_t inlen);
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file zstd_common.h
+ * @brief Zstandard format constants and tables (RFC 8878), shared by the host encoder and decoder
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace cudf {
+namespace io {
+namespace zstd {
+
+constexpr uint32_t zstd_magic           = 0xFD2FB528u;
+constexpr uint32_t skippable_magic      = 0x184D2A50u;
+constexpr uint32_t skippable_magic_mask = 0xFFFFFFF0u;
+constexpr uint32_t max_block_size       = 128 * 1024;
+
+constexpr int huffman_max_bits         = 11;
+constexpr int huffman_max_symbols      = 256;
+constexpr int weights_max_accuracy     = 6;
+constexpr int literals_max_accuracy    = 9;
+constexpr int matches_max_accuracy     = 9;
+constexpr int offsets_max_accuracy     = 8;
+constexpr int max_literals_length_code = 35;
+constexpr int max_match_length_code    = 52;
+constexpr int max_offset_code          = 31;
+
+// Default distributions of the sequence codes (RFC 8878, section 3.1.1.3.2.2)
+constexpr std::array<int16_t, 36> default_literals_length_dist = {
+  4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 3, 2, 1, 1, 1, 1, 1, -1, -1, -1, -1};
+constexpr int default_literals_length_accuracy = 6;
+
+constexpr std::array<int16_t, 53> default_match_length_dist = {
+  1, 4, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, -1, -1};
+constexpr int default_match_length_accuracy = 6;
+
+constexpr std::array<int16_t, 29> default_offset_dist = {
+  1, 1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1};
+constexpr int default_offset_accuracy = 5;
+
+constexpr std::array<uint32_t, 36> literals_length_base = {
+  0,  1,  2,  3,  4,  5,  6,  7,  8,  9,   10,  11,  12,  13,   14,   15,   16,    18,
+  20, 22, 24, 28, 32, 40, 48, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, 32768, 65536};
+constexpr std::array<uint8_t, 36> literals_length_bits = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  0,  0,  0,  0,  0,  1,  1,
+  1, 1, 2, 2, 3, 3, 4, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+
+constexpr std::array<uint32_t, 53> match_length_base = {
+  3,  4,  5,  6,  7,  8,  9,  10, 11, 12,  13,  14,  15,  16,   17,   18,   19,   20,
+  21, 22, 23, 24, 25, 26, 27, 28, 29, 30,  31,  32,  33,  34,   35,   37,   39,   41,
+  43, 47, 51, 59, 67, 83, 99, 131, 259, 515, 1027, 2051, 4099, 8195, 16387, 32771, 65539};
+constexpr std::array<uint8_t, 53> match_length_bits = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  0,  0,  0,  0,  0,  0,
+  0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 3, 4, 4, 5, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+
+inline int highest_set_bit(uint64_t v)
+{
+  int bit = -1;
+  while (v != 0) {
+    ++bit;
+    v >>= 1;
+  }
+  return bit;
+}
+
+}  // namespace zstd
+}  // namespace io
+}  // namespace cudf
@@ -155,6 +155,174 @@ __device__ __inline__ bool is_floatingpoint(long len,
   return true;
 }
 
+/**
+ * @brief Type of a single field, as counted by `column_type_histogram`
+ */
+enum class field_type : uint8_t {
+  NULL_VALUE,
+  BOOL,
+  FLOAT,
+  DATETIME,
+  STRING,
+  NEGATIVE_SMALL_INT,
+  POSITIVE_SMALL_INT,
+  BIG_INT
+};
+
+/*
+ * @brief Returns the type of a field, for type inference.
+ *
+ * @param opts A set of parsing options
+ * @param field_start Start of the field
+ * @param field_end End of the field, i.e. position of the delimiter
+ * @param flags Parsing behavior flags of the column
+ *
+ * @return The type of the field
+ */
+__device__ field_type classify_field(parse_options_view const& opts,
+                                     char const* field_start,
+                                     char const* field_end,
+                                     column_parse::flags flags)
+{
+  auto const field_len = static_cast<size_t>(field_end - field_start);
+  if (serialized_trie_contains(opts.trie_na, {field_start, field_len})) {
+    return field_type::NULL_VALUE;
+  }
+  if (serialized_trie_contains(opts.trie_true, {field_start, field_len}) ||
+      serialized_trie_contains(opts.trie_false, {field_start, field_len})) {
+    return field_type::BOOL;
+  }
+  if (cudf::io::is_infinity(field_start, field_end)) { return field_type::FLOAT; }
+
+  long count_number    = 0;
+  long count_decimal   = 0;
+  long count_thousands = 0;
+  long count_slash     = 0;
+  long count_dash      = 0;
+  long count_plus      = 0;
+  long count_colon     = 0;
+  long count_string    = 0;
+  long count_exponent  = 0;
+
+  // Modify field_start & end to ignore whitespace and quotechars
+  // This could possibly result in additional empty fields
+  auto const trimmed_field_range = trim_whitespaces_quotes(field_start, field_end);
+  auto const trimmed_field_len   = trimmed_field_range.second - trimmed_field_range.first;
+
+  for (auto cur = trimmed_field_range.first; cur < trimmed_field_range.second; ++cur) {
+    if (is_digit(*cur)) {
+      count_number++;
+      continue;
+    }
+    if (*cur == opts.decimal) {
+      count_decimal++;
+      continue;
+    }
+    if (*cur == opts.thousands) {
+      count_thousands++;
+      continue;
+    }
+    // Looking for unique characters that will help identify column types.
+    switch (*cur) {
+      case '-': count_dash++; break;
+      case '+': count_plus++; break;
+      case '/': count_slash++; break;
+      case ':': count_colon++; break;
+      case 'e':
+      case 'E':
+        if (cur > trimmed_field_range.first && cur < trimmed_field_range.second - 1)
+          count_exponent++;
+        break;
+      default: count_string++; break;
+    }
+  }
+
+  // Integers have to have the length of the string
+  // Off by one if they start with a minus sign
+  auto const int_req_number_cnt =
+    trimmed_field_len - count_thousands -
+    ((*trimmed_field_range.first == '-' || *trimmed_field_range.first == '+') &&
+     trimmed_field_len > 1);
+
+  if (flags & column_parse::as_datetime) {
+    // PANDAS uses `object` dtype if the date is unparseable
+    return is_datetime(count_string, count_decimal, count_colon, count_dash, count_slash)
+             ? field_type::DATETIME
+             : field_type::STRING;
+  }
+  if (count_number == int_req_number_cnt) {
+    auto const is_negative = (*trimmed_field_range.first == '-');
+    auto const data_begin =
+      trimmed_field_range.first + (is_negative || (*trimmed_field_range.first == '+'));
+    column_type_histogram counters{};
+    auto const counter = cudf::io::gpu::infer_integral_field_counter(
+      data_begin, data_begin + count_number, is_negative, counters);
+    if (counter == &counters.negative_small_int_count) { return field_type::NEGATIVE_SMALL_INT; }
+    if (counter == &counters.positive_small_int_count) { return field_type::POSITIVE_SMALL_INT; }
+    if (counter == &counters.big_int_count) { return field_type::BIG_INT; }
+    return field_type::STRING;
+  }
+  if (is_floatingpoint(trimmed_field_len,
+                       count_number,
+                       count_decimal,
+                       count_thousands,
+                       count_dash + count_plus,
+                       count_exponent)) {
+    return field_type::FLOAT;
+  }
+  return field_type::STRING;
+}
+
+/*
+ * @brief Returns the histogram counter of a field type.
+ */
+__device__ __inline__ cudf::size_type* type_counter(column_type_histogram& stats, field_type type)
+{
+  switch (type) {
+    case field_type::NULL_VALUE: return &stats.null_count;
+    case field_type::BOOL: return &stats.bool_count;
+    case field_type::FLOAT: return &stats.float_count;
+    case field_type::DATETIME: return &stats.datetime_count;
+    case field_type::NEGATIVE_SMALL_INT: return &stats.negative_small_int_count;
+    case field_type::POSITIVE_SMALL_INT: return &stats.positive_small_int_count;
+    case field_type::BIG_INT: return &stats.big_int_count;
+    default: return &stats.string_count;
+  }
+}
+
+/*
+ * @brief Returns whether type inference still selects the given type once a field of the given
+ * type is counted, i.e. whether the field fits a type inferred from other fields.
+ *
+ * Mirrors the type selection of the reader: an all-null column is `INT8`, and integer columns
+ * with nulls are `FLOAT64`.
+ *
+ * @param inferred Type inferred from other fields of the column
+ * @param type Type of the field
+ */
+__device__ __inline__ bool is_inferred_type_kept(cudf::data_type inferred, field_type type)
+{
+  switch (inferred.id()) {
+    case cudf::type_id::STRING: return true;
+    case cudf::type_id::TIMESTAMP_DAYS:
+    case cudf::type_id::TIMESTAMP_SECONDS:
+    case cudf::type_id::TIMESTAMP_MILLISECONDS:
+    case cudf::type_id::TIMESTAMP_MICROSECONDS:
+    case cudf::type_id::TIMESTAMP_NANOSECONDS: return type != field_type::STRING;
+    case cudf::type_id::BOOL8:
+      return type != field_type::STRING && type != field_type::DATETIME;
+    case cudf::type_id::FLOAT64:
+      return type != field_type::STRING && type != field_type::DATETIME &&
+             type != field_type::BOOL;
+    case cudf::type_id::INT64:
+      return type == field_type::NEGATIVE_SMALL_INT || type == field_type::POSITIVE_SMALL_INT;
+    case cudf::type_id::UINT64:
+      return type == field_type::POSITIVE_SMALL_INT || type == field_type::BIG_INT;
+    case cudf::type_id::INT8: return type == field_type::NULL_VALUE;
+    default: return true;
+  }
+}
+
 /*
  * @brief CUDA kernel that parses and converts CSV data into cuDF column data.
  *
@@ -198,91 +366,8 @@ __global__ void __launch_bounds__(csvparse_block_dim)
 
     // Checking if this is a column that the user wants --- user can filter columns
     if (column_flags[col] & column_parse::enabled) {
-      // points to last character in the field
-      auto const field_len = static_cast<size_t>(next_delimiter - field_start);
-      if (serialized_trie_contains(opts.trie_na, {field_start, field_len})) {
-        atomicAdd(&d_column_data[actual_col].null_count, 1);
-      } else if (serialized_trie_contains(opts.trie_true, {field_start, field_len}) ||
-                 serialized_trie_contains(opts.trie_false, {field_start, field_len})) {
-        atomicAdd(&d_column_data[actual_col].bool_count, 1);
-      } else if (cudf::io::is_infinity(field_start, next_delimiter)) {
-        atomicAdd(&d_column_data[actual_col].float_count, 1);
-      } else {
-        long count_number    = 0;
-        long count_decimal   = 0;
-        long count_thousands = 0;
-        long count_slash     = 0;
-        long count_dash      = 0;
-        long count_plus      = 0;
-        long count_colon     = 0;
-        long count_string    = 0;
-        long count_exponent  = 0;
-
-        // Modify field_start & end to ignore whitespace and quotechars
-        // This could possibly result in additional empty fields
-        auto const trimmed_field_range = trim_whitespaces_quotes(field_start, next_delimiter);
-        auto const trimmed_field_len   = trimmed_field_range.second - trimmed_field_range.first;
-
-        for (auto cur = trimmed_field_range.first; cur < trimmed_field_range.second; ++cur) {
-          if (is_digit(*cur)) {
-            count_number++;
-            continue;
-          }
-          if (*cur == opts.decimal) {
-            count_decimal++;
-            continue;
-          }
-          if (*cur == opts.thousands) {
-            count_thousands++;
-            continue;
-          }
-          // Looking for unique characters that will help identify column types.
-          switch (*cur) {
-            case '-': count_dash++; break;
-            case '+': count_plus++; break;
-            case '/': count_slash++; break;
-            case ':': count_colon++; break;
-            case 'e':
-            case 'E':
-              if (cur > trimmed_field_range.first && cur < trimmed_field_range.second - 1)
-                count_exponent++;
-              break;
-            default: count_string++; break;
-          }
-        }
-
-        // Integers have to have the length of the string
-        // Off by one if they start with a minus sign
-        auto const int_req_number_cnt =
-          trimmed_field_len - count_thousands -
-          ((*trimmed_field_range.first == '-' || *trimmed_field_range.first == '+') &&
-           trimmed_field_len > 1);
-
-        if (column_flags[col] & column_parse::as_datetime) {
-          // PANDAS uses `object` dtype if the date is unparseable
-          if (is_datetime(count_string, count_decimal, count_colon, count_dash, count_slash)) {
-            atomicAdd(&d_column_data[actual_col].datetime_count, 1);
-          } else {
-            atomicAdd(&d_column_data[actual_col].string_count, 1);
-          }
-        } else if (count_number == int_req_number_cnt) {
-          auto const is_negative = (*trimmed_field_range.first == '-');
-          auto const data_begin =
-            trimmed_field_range.first + (is_negative || (*trimmed_field_range.first == '+'));
-          cudf::size_type* ptr = cudf::io::gpu::infer_integral_field_counter(
-            data_begin, data_begin + count_number, is_negative, d_column_data[actual_col]);
-          atomicAdd(ptr, 1);
-        } else if (is_floatingpoint(trimmed_field_len,
-                                    count_number,
-                                    count_decimal,
-                                    count_thousands,
-                                    count_dash + count_plus,
-                                    count_exponent)) {
-          atomicAdd(&d_column_data[actual_col].float_count, 1);
-        } else {
-          atomicAdd(&d_column_data[actual_col].string_count, 1);
-        }
-      }
+      auto const type = classify_field(opts, field_start, next_delimiter, column_flags[col]);
+      atomicAdd(type_counter(d_column_data[actual_col], type), 1);
       actual_col++;
     }
     next_field  = next_delimiter + 1;
@@ -494,6 +579,8 @@ struct decode_op {
  * @param[in] dtypes The data type of the column
  * @param[out] columns The output column data
  * @param[out] valids The bitmaps indicating whether column fields are valid
+ * @param[out] type_mismatches Whether each column has fields that don't fit its inferred type; not
+ * checked if empty
  */
 __global__ void __launch_bounds__(csvparse_block_dim)
   convert_csv_to_cudf(cudf::io::parse_options_view options,
@@ -502,7 +589,8 @@ __global__ void __launch_bounds__(csvparse_block_dim)
                       device_span<uint64_t const> row_offsets,
                       device_span<cudf::data_type const> dtypes,
                       device_span<void* const> columns,
-                      device_span<cudf::bitmask_type* const> valids)
+                      device_span<cudf::bitmask_type* const> valids,
+                      device_span<uint8_t> type_mismatches)
 {
   auto const raw_csv = data.data();
   // thread IDs range per block, so also need the block id.
@@ -525,6 +613,12 @@ __global__ void __launch_bounds__(csvparse_block_dim)
     auto next_delimiter = cudf::io::gpu::seek_field_end(next_field, row_end, options);
 
     if (column_flags[col] & column_parse::enabled) {
+      if (!type_mismatches.empty() && !type_mismatches[actual_col] &&
+          !is_inferred_type_kept(
+            dtypes[actual_col],
+            classify_field(options, field_start, next_delimiter, column_flags[col]))) {
+        type_mismatches[actual_col] = 1;
+      }
       // check if the entire field is a NaN string - consistent with pandas
       auto const is_valid = !serialized_trie_contains(
         options.trie_na, {field_start, static_cast<size_t>(next_delimiter - field_start)});
@@ -1002,6 +1096,7 @@ void __host__ decode_row_column_data(cudf::io::parse_options_view const& options
                                      device_span<cudf::data_type const> dtypes,
                                      device_span<void* const> columns,
                                      device_span<cudf::bitmask_type* const> valids,
+                                     device_span<uint8_t> type_mismatches,
                                      rmm::cuda_stream_view stream)
 {
   // Calculate actual block count to use based on records count
@@ -1010,7 +1105,7 @@ void __host__ decode_row_column_data(cudf::io::parse_options_view const& options
   auto const grid_size  = (num_rows + block_size - 1) / block_size;
 
   convert_csv_to_cudf<<<grid_size, block_size, 0, stream.value()>>>(
-    options, data, column_flags, row_offsets, dtypes, columns, valids);
+    options, data, column_flags, row_offsets, dtypes, columns, valids, type_mismatches);
 }
 
 uint32_t __host__ gather_row_offsets(const parse_options_view& options,
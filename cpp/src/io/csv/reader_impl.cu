@@ -41,9 +41,14 @@
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/transform.h>
 
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -195,6 +200,104 @@ void erase_except_last(C& container, rmm::cuda_stream_view stream)
   container.resize(1, stream);
 }
 
+// Size of the input chunks that are copied to the device and parsed at a time
+constexpr size_t max_chunk_bytes = 64 * 1024 * 1024;  // 64MB
+
+/**
+ * @brief Sequential reader of the uncompressed input data.
+ *
+ * Uncompressed input is read from host memory. Compressed input is decompressed in windows of
+ * `max_chunk_bytes`, while the previous window is parsed, so that the whole uncompressed data is
+ * never held in host memory.
+ */
+class input_reader {
+  host_span<char const> _data;
+  std::unique_ptr<decompressed_windows> _windows;
+  size_t _pos = 0;
+
+ public:
+  explicit input_reader(host_span<char const> data) : _data{data} {}
+  explicit input_reader(std::unique_ptr<decompressed_windows>&& windows)
+    : _windows{std::move(windows)}
+  {
+  }
+
+  /**
+   * @brief Returns whether the total size of the data is known, i.e. the input is not compressed
+   * or has been entirely decompressed.
+   */
+  [[nodiscard]] bool is_size_known() const { return not _windows or _windows->is_done(); }
+
+  /**
+   * @brief Returns the total size of the data; the maximum `size_t` value if not known yet.
+   */
+  [[nodiscard]] size_t size() const
+  {
+    if (not is_size_known()) { return std::numeric_limits<size_t>::max(); }
+    return _windows ? _pos : _data.size();
+  }
+
+  /**
+   * @brief Returns the expected total size of the data; 0 if unknown.
+   *
+   * For compressed input, this is the uncompressed size recorded in the gzip or zip headers.
+   */
+  [[nodiscard]] size_t size_hint() const
+  {
+    if (is_size_known()) { return size(); }
+    return _windows->uncompressed_size_hint();
+  }
+
+  /**
+   * @brief Returns whether all data has been read.
+   */
+  [[nodiscard]] bool is_done() const
+  {
+    return _windows ? _windows->is_done() : _pos == _data.size();
+  }
+
+  /**
+   * @brief Returns the data of uncompressed input.
+   */
+  [[nodiscard]] host_span<char const> in_memory_data() const
+  {
+    CUDF_EXPECTS(not _windows, "Compressed input is not held in memory");
+    return _data;
+  }
+
+  /**
+   * @brief Skips the first bytes of the data; only supported for uncompressed input.
+   */
+  void skip(size_t size)
+  {
+    if (size == 0) { return; }
+    CUDF_EXPECTS(not _windows, "Cannot skip the start of compressed input");
+    _pos = std::min(_pos + size, _data.size());
+  }
+
+  /**
+   * @brief Reads the next bytes of the data.
+   *
+   * The returned data is valid until the next call.
+   *
+   * @param max_size Maximum number of bytes to read; at least `max_chunk_bytes` for compressed
+   * input
+   * @return The data read; smaller than `max_size` only at the end of the data
+   */
+  host_span<char const> read(size_t max_size)
+  {
+    if (_windows) {
+      CUDF_EXPECTS(max_size >= max_chunk_bytes, "Reads of compressed input are too small");
+      auto const window = _windows->next();
+      _pos += window.size();
+      return window;
+    }
+    auto const size = std::min(max_size, _data.size() - _pos);
+    _pos += size;
+    return _data.subspan(_pos - size, size);
+  }
+};
+
 size_t find_first_row_start(char row_terminator, host_span<char const> data)
 {
   // For now, look for the first terminator (assume the first terminator isn't within a quote)
@@ -206,13 +309,30 @@ size_t find_first_row_start(char row_terminator, host_span<char const> data)
   return std::min(pos + 1, data.size());
 }
 
+/**
+ * @brief Reads the whole content of the random access index of a compressed source.
+ */
+std::vector<char> read_compression_index(source_info const& info)
+{
+  auto const source = [&]() {
+    switch (info.type()) {
+      case io_type::FILEPATH: return datasource::create(info.filepaths().at(0));
+      case io_type::HOST_BUFFER: return datasource::create(info.buffers().at(0));
+      case io_type::USER_IMPLEMENTED: return datasource::create(info.user_sources().at(0));
+      default: CUDF_FAIL("Unsupported compression index source type");
+    }
+  }();
+  auto const buffer = source->host_read(0, source->size());
+  return {buffer->data(), buffer->data() + buffer->size()};
+}
+
 /**
  * @brief Finds row positions in the specified input data, and loads the selected data onto GPU.
  *
  * This function scans the input data to record the row offsets (relative to the start of the
  * input data). A row is actually the data/offset between two termination symbols.
  *
- * @param data Uncompressed input data in host memory
+ * @param input Reader of the uncompressed input data
  * @param range_begin Only include rows starting after this position
  * @param range_end Only include rows starting before this position
  * @param skip_rows Number of rows to skip from the start
@@ -225,7 +345,7 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
   csv_reader_options const& reader_opts,
   parse_options const& parse_opts,
   std::vector<char>& header,
-  host_span<char const> data,
+  input_reader& input,
   size_t range_begin,
   size_t range_end,
   size_t skip_rows,
@@ -233,34 +353,49 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
   bool load_whole_file,
   rmm::cuda_stream_view stream)
 {
-  constexpr size_t max_chunk_bytes = 64 * 1024 * 1024;  // 64MB
-  size_t buffer_size               = std::min(max_chunk_bytes, data.size());
+  size_t const data_size = input.size();
+  size_t buffer_size     = std::min(max_chunk_bytes, data_size);
   size_t max_blocks =
     std::max<size_t>((buffer_size / cudf::io::csv::gpu::rowofs_block_bytes) + 1, 2);
   hostdevice_vector<uint64_t> row_ctx(max_blocks, stream);
-  size_t buffer_pos  = std::min(range_begin - std::min(range_begin, sizeof(char)), data.size());
-  size_t pos         = std::min(range_begin, data.size());
+  size_t buffer_pos  = std::min(range_begin - std::min(range_begin, sizeof(char)), data_size);
+  size_t pos         = std::min(range_begin, data_size);
   size_t header_rows = (reader_opts.get_header() >= 0) ? reader_opts.get_header() + 1 : 0;
   uint64_t ctx       = 0;
 
   // For compatibility with the previous parser, a row is considered in-range if the
   // previous row terminator is within the given range
-  range_end += (range_end < data.size());
-
-  // Reserve memory by allocating and then resetting the size
-  rmm::device_uvector<char> d_data{
-    (load_whole_file) ? data.size() : std::min(buffer_size * 2, data.size()), stream};
+  range_end += (range_end < data_size);
+
+  // Reserve memory by allocating and then resetting the size. The size of compressed input is only
+  // known in advance if recorded in its headers; otherwise, the buffer grows as the input is
+  // decompressed.
+  auto const size_hint        = input.size_hint();
+  auto const initial_capacity = (size_hint == 0)    ? buffer_size * 2
+                                : (load_whole_file) ? size_hint
+                                                    : std::min(buffer_size * 2, size_hint);
+  rmm::device_uvector<char> d_data{initial_capacity, stream};
   d_data.resize(0, stream);
   rmm::device_uvector<uint64_t> all_row_offsets{0, stream};
+  input.skip(buffer_pos);
   do {
-    size_t target_pos = std::min(pos + max_chunk_bytes, data.size());
-    size_t chunk_size = target_pos - pos;
-
+    // Read the input up to `max_chunk_bytes` past the parsing position
     auto const previous_data_size = d_data.size();
+    auto const h_chunk = input.read(pos + max_chunk_bytes - (buffer_pos + previous_data_size));
+    size_t target_pos  = buffer_pos + previous_data_size + h_chunk.size();
+    size_t chunk_size  = target_pos - pos;
+    // The end of the data is only known once all of it has been read
+    auto const end_pos = input.is_done() ? target_pos : target_pos + 1;
+
+    if (target_pos - buffer_pos > d_data.capacity()) {
+      // Grow by a smaller factor than doubling, to limit the unused device memory
+      d_data.reserve(std::max(target_pos - buffer_pos, d_data.capacity() + d_data.capacity() / 2),
+                     stream);
+    }
     d_data.resize(target_pos - buffer_pos, stream);
     CUDA_TRY(cudaMemcpyAsync(d_data.begin() + previous_data_size,
-                             data.begin() + buffer_pos + previous_data_size,
-                             target_pos - buffer_pos - previous_data_size,
+                             h_chunk.data(),
+                             h_chunk.size(),
                              cudaMemcpyDefault,
                              stream.value()));
 
@@ -273,7 +408,7 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
                                                                  chunk_size,
                                                                  pos,
                                                                  buffer_pos,
-                                                                 data.size(),
+                                                                 end_pos,
                                                                  range_begin,
                                                                  range_end,
                                                                  skip_rows,
@@ -312,13 +447,13 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
                                              chunk_size,
                                              pos,
                                              buffer_pos,
-                                             data.size(),
+                                             end_pos,
                                              range_begin,
                                              range_end,
                                              skip_rows,
                                              stream);
       // With byte range, we want to keep only one row out of the specified range
-      if (range_end < data.size()) {
+      if (range_end < data_size) {
         CUDA_TRY(cudaMemcpyAsync(row_ctx.host_ptr(),
                                  row_ctx.device_ptr(),
                                  num_blocks * sizeof(uint64_t),
@@ -359,7 +494,10 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
       }
     }
     pos = target_pos;
-  } while (pos < data.size());
+  } while (not input.is_done());
+
+  // Release the capacity reserved past the end of the data
+  d_data.shrink_to_fit(stream);
 
   auto const non_blank_row_offsets =
     io::csv::gpu::remove_blank_rows(parse_opts.view(), d_data, all_row_offsets, stream);
@@ -375,11 +513,18 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
                              stream.value()));
     stream.synchronize();
 
-    const auto header_start = buffer_pos + row_ctx[0];
-    const auto header_end   = buffer_pos + row_ctx[1];
-    CUDF_EXPECTS(header_start <= header_end && header_end <= data.size(),
+    // Compressed input is not kept in host memory; copy the header from the device data
+    const auto header_start = row_ctx[0];
+    const auto header_end   = row_ctx[1];
+    CUDF_EXPECTS(header_start <= header_end && header_end <= d_data.size(),
                  "Invalid csv header location");
-    header.assign(data.begin() + header_start, data.begin() + header_end);
+    header.resize(header_end - header_start);
+    CUDA_TRY(cudaMemcpyAsync(header.data(),
+                             d_data.data() + header_start,
+                             header.size(),
+                             cudaMemcpyDeviceToHost,
+                             stream.value()));
+    stream.synchronize();
     if (header_rows > 0) { row_offsets.erase_first_n(header_rows); }
   }
   // Apply num_rows limit
@@ -403,33 +548,48 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> select_data_and_row_
   auto skip_end_rows     = reader_opts.get_skipfooter();
   auto num_rows          = reader_opts.get_nrows();
 
-  if (range_offset > 0 || range_size > 0) {
-    CUDF_EXPECTS(reader_opts.get_compression() == compression_type::NONE,
-                 "Reading compressed data using `byte range` is unsupported");
+  bool const is_byte_range = range_offset > 0 || range_size > 0;
+  if (is_byte_range && reader_opts.get_compression() != compression_type::NONE) {
+    CUDF_EXPECTS(reader_opts.get_compression_index().has_value(),
+                 "Reading compressed data using `byte range` requires a compression index");
+    CUDF_EXPECTS(reader_opts.get_compression() == compression_type::GZIP,
+                 "Compression indices are only supported for gzip compressed data");
   }
 
   // Transfer source data to GPU
   if (!source->is_empty()) {
-    auto data_size = (range_size_padded != 0) ? range_size_padded : source->size();
-    auto buffer    = source->host_read(range_offset, data_size);
-
-    auto h_data = host_span<char const>(  //
-      reinterpret_cast<const char*>(buffer->data()),
-      buffer->size());
-
-    std::vector<char> h_uncomp_data_owner;
-
-    if (reader_opts.get_compression() != compression_type::NONE) {
-      h_uncomp_data_owner = get_uncompressed_data(h_data, reader_opts.get_compression());
-      h_data              = h_uncomp_data_owner;
-    }
+    std::unique_ptr<datasource::buffer> buffer;
+    std::vector<char> decompressed;
+    auto input = [&]() {
+      if (is_byte_range && reader_opts.get_compression() != compression_type::NONE) {
+        // Only decompress the byte range, from the nearest checkpoints of the index
+        auto const index = read_compression_index(*reader_opts.get_compression_index());
+        decompressed     = decompress_gzip_range(
+          source,
+          index,
+          range_offset,
+          (range_size_padded != 0) ? range_size_padded : std::numeric_limits<size_t>::max());
+        return input_reader{host_span<char const>(decompressed)};
+      }
+      if (reader_opts.get_compression() != compression_type::NONE) {
+        // Decompress the input in windows while it is parsed, instead of all of it upfront
+        return input_reader{std::make_unique<decompressed_windows>(
+          source, reader_opts.get_compression(), max_chunk_bytes)};
+      }
+      auto data_size = (range_size_padded != 0) ? range_size_padded : source->size();
+      buffer         = source->host_read(range_offset, data_size);
+      return input_reader{host_span<char const>(  //
+        reinterpret_cast<const char*>(buffer->data()),
+        buffer->size())};
+    }();
     // None of the parameters for row selection is used, we are parsing the entire file
     const bool load_whole_file = range_offset == 0 && range_size == 0 && skip_rows <= 0 &&
                                  skip_end_rows <= 0 && num_rows == -1;
 
     // With byte range, find the start of the first data row
     size_t const data_start_offset =
-      (range_offset != 0) ? find_first_row_start(parse_opts.terminator, h_data) : 0;
+      (range_offset != 0) ? find_first_row_start(parse_opts.terminator, input.in_memory_data())
+                          : 0;
 
     // TODO: Allow parsing the header outside the mapped range
     CUDF_EXPECTS((range_offset == 0 || reader_opts.get_header() < 0),
@@ -440,9 +600,9 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> select_data_and_row_
       load_data_and_gather_row_offsets(reader_opts,
                                        parse_opts,
                                        header,
-                                       h_data,
+                                       input,
                                        data_start_offset,
-                                       (range_size) ? range_size : h_data.size(),
+                                       (range_size) ? range_size : input.size(),
                                        (skip_rows > 0) ? skip_rows : 0,
                                        num_rows,
                                        load_whole_file,
@@ -499,35 +659,114 @@ std::vector<data_type> get_data_types_from_column_names(
   return selected_dtypes;
 }
 
+/**
+ * @brief Selects the rows to infer column types from, based on the type inference options.
+ *
+ * The sample is split evenly between ranges of rows that start at evenly spaced rows. Each range
+ * includes at least one row.
+ *
+ * @return Row offsets of each range, including the end offset of its last row
+ */
+std::vector<device_span<uint64_t const>> select_type_inference_sample(
+  csv_reader_options const& reader_opts,
+  device_span<uint64_t const> row_offsets,
+  rmm::cuda_stream_view stream)
+{
+  auto const num_records = std::max(row_offsets.size(), 1ul) - 1;
+  auto const max_rows    = static_cast<size_t>(reader_opts.get_type_inference_rows());
+  auto const max_bytes   = reader_opts.get_type_inference_bytes();
+  if (num_records == 0 || (max_rows == 0 && max_bytes == 0)) { return {row_offsets}; }
+
+  auto const num_ranges =
+    std::min(static_cast<size_t>(reader_opts.get_type_inference_ranges()), num_records);
+  std::vector<size_t> range_begins(num_ranges);
+  std::vector<size_t> range_ends(num_ranges);
+  for (size_t i = 0; i < num_ranges; ++i) {
+    range_begins[i] = i * num_records / num_ranges;
+    range_ends[i]   = (i + 1) * num_records / num_ranges;
+    if (max_rows != 0) {
+      range_ends[i] =
+        std::min(range_ends[i], range_begins[i] + std::max(max_rows / num_ranges, 1ul));
+    }
+  }
+  if (max_bytes != 0) {
+    // Find the first row of each range that ends after the share of bytes of the range
+    auto const range_bytes = std::max(max_bytes / num_ranges, 1ul);
+    auto const d_begins    = make_device_uvector_async(range_begins, stream);
+    rmm::device_uvector<uint64_t> d_limits(num_ranges, stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      d_begins.begin(),
+                      d_begins.end(),
+                      d_limits.begin(),
+                      [row_offsets, range_bytes] __device__(size_t row) {
+                        return row_offsets[row] + range_bytes;
+                      });
+    rmm::device_uvector<size_t> d_ends(num_ranges, stream);
+    thrust::upper_bound(rmm::exec_policy(stream),
+                        row_offsets.begin(),
+                        row_offsets.end(),
+                        d_limits.begin(),
+                        d_limits.end(),
+                        d_ends.begin());
+    auto const ends = cudf::detail::make_std_vector_sync(d_ends, stream);
+    for (size_t i = 0; i < num_ranges; ++i) {
+      range_ends[i] = std::min(range_ends[i], std::max(ends[i] - 1, range_begins[i] + 1));
+    }
+  }
+
+  std::vector<device_span<uint64_t const>> sample;
+  for (size_t i = 0; i < num_ranges; ++i) {
+    sample.push_back(row_offsets.subspan(range_begins[i], range_ends[i] - range_begins[i] + 1));
+  }
+  return sample;
+}
+
+/**
+ * @brief Infers the type of each active column from the given ranges of rows.
+ *
+ * @param row_ranges Row offsets of each range, including the end offset of its last row
+ */
 std::vector<data_type> infer_column_types(parse_options const& parse_opts,
                                           std::vector<column_parse::flags> const& column_flags,
                                           device_span<char const> data,
-                                          device_span<uint64_t const> row_offsets,
-                                          int32_t num_records,
+                                          host_span<device_span<uint64_t const> const> row_ranges,
                                           int32_t num_active_columns,
                                           data_type timestamp_type,
                                           rmm::cuda_stream_view stream)
 {
+  size_t num_records = 0;
+  for (auto const& range : row_ranges) {
+    num_records += std::max(range.size(), 1ul) - 1;
+  }
+
   std::vector<data_type> dtypes;
   if (num_records == 0) {
     dtypes.resize(num_active_columns, data_type{type_id::EMPTY});
   } else {
-    auto column_stats =
-      cudf::io::csv::gpu::detect_column_types(parse_opts.view(),
-                                              data,
-                                              make_device_uvector_async(column_flags, stream),
-                                              row_offsets,
-                                              num_active_columns,
-                                              stream);
-
-    stream.synchronize();
+    auto const d_column_flags = make_device_uvector_async(column_flags, stream);
+    std::vector<column_type_histogram> column_stats(num_active_columns, column_type_histogram{});
+    for (auto const& range : row_ranges) {
+      if (range.size() < 2) { continue; }
+      auto const range_stats = cudf::io::csv::gpu::detect_column_types(
+        parse_opts.view(), data, d_column_flags, range, num_active_columns, stream);
+      for (int col = 0; col < num_active_columns; col++) {
+        column_stats[col].null_count += range_stats[col].null_count;
+        column_stats[col].float_count += range_stats[col].float_count;
+        column_stats[col].datetime_count += range_stats[col].datetime_count;
+        column_stats[col].string_count += range_stats[col].string_count;
+        column_stats[col].negative_small_int_count += range_stats[col].negative_small_int_count;
+        column_stats[col].positive_small_int_count += range_stats[col].positive_small_int_count;
+        column_stats[col].big_int_count += range_stats[col].big_int_count;
+        column_stats[col].bool_count += range_stats[col].bool_count;
+      }
+    }
 
     for (int col = 0; col < num_active_columns; col++) {
       unsigned long long int_count_total = column_stats[col].big_int_count +
                                            column_stats[col].negative_small_int_count +
                                            column_stats[col].positive_small_int_count;
 
-      if (column_stats[col].null_count == num_records) {
+      if (static_cast<size_t>(column_stats[col].null_count) == num_records) {
         // Entire column is NULL; allocate the smallest amount of memory
         dtypes.emplace_back(cudf::type_id::INT8);
       } else if (column_stats[col].string_count > 0L) {
@@ -578,6 +817,7 @@ std::vector<column_buffer> decode_data(parse_options const& parse_opts,
                                        int32_t num_records,
                                        int32_t num_actual_columns,
                                        int32_t num_active_columns,
+                                       device_span<uint8_t> type_mismatches,
                                        rmm::cuda_stream_view stream,
                                        rmm::mr::device_memory_resource* mr)
 {
@@ -617,6 +857,7 @@ std::vector<column_buffer> decode_data(parse_options const& parse_opts,
                                              make_device_uvector_async(column_types, stream),
                                              make_device_uvector_async(h_data, stream),
                                              make_device_uvector_async(h_valid, stream),
+                                             type_mismatches,
                                              stream);
 
   return out_buffers;
@@ -751,13 +992,16 @@ table_with_metadata read_csv(cudf::io::datasource* source,
     std::visit([](const auto& dtypes) { return dtypes.empty(); }, reader_opts.get_dtypes());
 
   std::vector<data_type> column_types;
+  // Whether column types are inferred from a sample of the rows
+  bool is_sampled_inference = false;
   if (has_to_infer_column_types) {
+    auto const sample = select_type_inference_sample(reader_opts, row_offsets, stream);
+    is_sampled_inference = sample.size() != 1 || sample.front().size() != row_offsets.size();
     column_types = infer_column_types(  //
       parse_opts,
       column_flags,
       data,
-      row_offsets,
-      num_records,
+      sample,
       num_active_columns,
       reader_opts.get_timestamp_type(),
       stream);
@@ -781,7 +1025,18 @@ table_with_metadata read_csv(cudf::io::datasource* source,
   out_columns.reserve(column_types.size());
 
   if (num_records != 0) {
-    auto out_buffers = decode_data(  //
+    // Columns inferred from a sample are checked against the other rows while they are converted.
+    // Columns that are null in the whole sample are always inferred again, as rows without the
+    // column's field cannot be checked
+    std::vector<uint8_t> h_type_mismatches;
+    if (is_sampled_inference) {
+      std::transform(column_types.cbegin(),
+                     column_types.cend(),
+                     std::back_inserter(h_type_mismatches),
+                     [](auto const& type) { return type.id() == type_id::INT8; });
+    }
+    auto type_mismatches = make_device_uvector_async(h_type_mismatches, stream);
+    auto out_buffers     = decode_data(  //
       parse_opts,
       column_flags,
       column_names,
@@ -791,8 +1046,54 @@ table_with_metadata read_csv(cudf::io::datasource* source,
       num_records,
       num_actual_columns,
       num_active_columns,
+      type_mismatches,
       stream,
       mr);
+    if (is_sampled_inference) {
+      h_type_mismatches = cudf::detail::make_std_vector_sync(type_mismatches, stream);
+      // Infer the columns with values that don't fit their type from all rows, and convert them
+      // again
+      auto promoted_flags =
+        std::vector<column_parse::flags>(column_flags.size(), column_parse::disabled);
+      std::vector<size_t> promoted_columns;
+      for (int col = 0, active_col = 0; col < num_actual_columns; ++col) {
+        if (column_flags[col] & column_parse::enabled) {
+          if (h_type_mismatches[active_col]) {
+            promoted_flags[col] = column_flags[col];
+            promoted_columns.push_back(active_col);
+          }
+          ++active_col;
+        }
+      }
+      if (!promoted_columns.empty()) {
+        auto const num_promoted_columns = static_cast<int32_t>(promoted_columns.size());
+        std::vector<device_span<uint64_t const>> const all_rows{row_offsets};
+        auto const promoted_types = infer_column_types(parse_opts,
+                                                       promoted_flags,
+                                                       data,
+                                                       all_rows,
+                                                       num_promoted_columns,
+                                                       reader_opts.get_timestamp_type(),
+                                                       stream);
+        auto promoted_buffers     = decode_data(  //
+          parse_opts,
+          promoted_flags,
+          column_names,
+          data,
+          row_offsets,
+          promoted_types,
+          num_records,
+          num_actual_columns,
+          num_promoted_columns,
+          {},
+          stream,
+          mr);
+        for (size_t i = 0; i < promoted_columns.size(); ++i) {
+          column_types[promoted_columns[i]] = promoted_types[i];
+          out_buffers[promoted_columns[i]]  = std::move(promoted_buffers[i]);
+        }
+      }
+    }
     for (size_t i = 0; i < column_types.size(); ++i) {
       metadata.column_names.emplace_back(out_buffers[i].name);
       if (column_types[i].id() == type_id::STRING && parse_opts.quotechar != '\0' &&
@@ -29,9 +29,13 @@
 #include <cudf/io/orc.hpp>
 #include <cudf/io/orc_metadata.hpp>
 #include <cudf/io/parquet.hpp>
+#include <cudf/io/parquet_metadata.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
+#include <io/comp/host_batch_decompressor.hpp>
+#include <io/comp/io_uncomp.h>
 #include <io/orc/orc.h>
+#include <io/parquet/footer_cache.hpp>
 
 namespace cudf {
 namespace io {
@@ -206,9 +210,12 @@ table_with_metadata read_csv(csv_reader_options options, rmm::mr::device_memory_
 
   options.set_compression(infer_compression_type(options.get_compression(), options.get_source()));
 
-  auto datasources = make_datasources(options.get_source(),
-                                      options.get_byte_range_offset(),
-                                      options.get_byte_range_size_with_padding());
+  // Byte ranges of compressed sources refer to the uncompressed data
+  auto const is_compressed = options.get_compression() != compression_type::NONE;
+  auto datasources =
+    make_datasources(options.get_source(),
+                     is_compressed ? 0 : options.get_byte_range_offset(),
+                     is_compressed ? 0 : options.get_byte_range_size_with_padding());
 
   CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
 
@@ -219,6 +226,22 @@ table_with_metadata read_csv(csv_reader_options options, rmm::mr::device_memory_
     mr);
 }
 
+void write_gzip_index(source_info const& source,
+                      sink_info const& index,
+                      std::size_t checkpoint_spacing)
+{
+  CUDF_FUNC_RANGE();
+
+  auto datasources = make_datasources(source);
+  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
+  auto sinks = make_datasinks(index);
+  CUDF_EXPECTS(sinks.size() == 1, "Multiple sinks not supported for index writing");
+
+  auto const data = build_gzip_index(datasources[0].get(), checkpoint_spacing);
+  sinks[0]->host_write(data.data(), data.size());
+  sinks[0]->flush();
+}
+
 // Freeform API wraps the detail writer class API
 void write_csv(csv_writer_options const& options, rmm::mr::device_memory_resource* mr)
 {
@@ -256,7 +279,7 @@ raw_orc_statistics read_raw_orc_statistics(source_info const& src_info)
     CUDF_FAIL("Unsupported source type");
   }
 
-  orc::metadata metadata(source.get());
+  orc::metadata metadata(source.get(), default_orc_tail_read_size);
 
   // Initialize statistics to return
   raw_orc_statistics result;
@@ -272,7 +295,7 @@ raw_orc_statistics read_raw_orc_statistics(source_info const& src_info)
   }
 
   // Get stripe-level statistics
-  for (auto const& stripes_stats : metadata.md.stripeStats) {
+  for (auto const& stripes_stats : metadata.get_metadata().stripeStats) {
     result.stripes_stats.emplace_back();
     for (auto const& stats : stripes_stats.colStats) {
       result.stripes_stats.back().push_back(std::string(stats.cbegin(), stats.cend()));
@@ -349,6 +372,41 @@ table_with_metadata read_orc(orc_reader_options const& options, rmm::mr::device_
   return reader->read(options);
 }
 
+/**
+ * @copydoc cudf::io::chunked_orc_reader::chunked_orc_reader
+ */
+chunked_orc_reader::chunked_orc_reader(std::size_t chunk_read_limit,
+                                       orc_reader_options const& options,
+                                       rmm::mr::device_memory_resource* mr)
+  : reader{std::make_unique<detail_orc::chunked_reader>(
+      chunk_read_limit, make_datasources(options.get_source()), options, mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::~chunked_orc_reader
+ */
+chunked_orc_reader::~chunked_orc_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::has_next
+ */
+bool chunked_orc_reader::has_next() const
+{
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::read_chunk
+ */
+table_with_metadata chunked_orc_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 /**
  * @copydoc cudf::io::write_orc
  */
@@ -418,6 +476,41 @@ table_with_metadata read_parquet(parquet_reader_options const& options,
   return reader->read(options);
 }
 
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::chunked_parquet_reader
+ */
+chunked_parquet_reader::chunked_parquet_reader(std::size_t chunk_read_limit,
+                                               parquet_reader_options const& options,
+                                               rmm::mr::device_memory_resource* mr)
+  : reader{std::make_unique<detail_parquet::chunked_reader>(
+      chunk_read_limit, make_datasources(options.get_source()), options, mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::~chunked_parquet_reader
+ */
+chunked_parquet_reader::~chunked_parquet_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::has_next
+ */
+bool chunked_parquet_reader::has_next() const
+{
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::read_chunk
+ */
+table_with_metadata chunked_parquet_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 /**
  * @copydoc cudf::io::merge_row_group_metadata
  */
@@ -428,6 +521,91 @@ std::unique_ptr<std::vector<uint8_t>> merge_row_group_metadata(
   return detail_parquet::writer::merge_row_group_metadata(metadata_list);
 }
 
+/**
+ * @copydoc cudf::io::read_parquet_metadata
+ */
+parquet_metadata read_parquet_metadata(source_info const& src_info)
+{
+  CUDF_FUNC_RANGE();
+
+  auto const datasources = make_datasources(src_info);
+  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
+  return detail_parquet::read_parquet_metadata(datasources[0].get());
+}
+
+/**
+ * @copydoc cudf::io::set_parquet_footer_cache_capacity
+ */
+void set_parquet_footer_cache_capacity(size_t capacity_bytes)
+{
+  detail_parquet::footer_cache::instance().set_capacity(capacity_bytes);
+}
+
+/**
+ * @copydoc cudf::io::get_parquet_footer_cache_statistics
+ */
+parquet_footer_cache_statistics get_parquet_footer_cache_statistics()
+{
+  return detail_parquet::footer_cache::instance().statistics();
+}
+
+/**
+ * @copydoc cudf::io::clear_parquet_footer_cache
+ */
+void clear_parquet_footer_cache() { detail_parquet::footer_cache::instance().clear(); }
+
+namespace {
+
+/**
+ * @brief Returns the public compression type of a host decompression method
+ */
+compression_type to_compression_type(int stream_type)
+{
+  switch (stream_type) {
+    case IO_UNCOMP_STREAM_TYPE_GZIP: return compression_type::GZIP;
+    case IO_UNCOMP_STREAM_TYPE_ZIP: return compression_type::ZIP;
+    case IO_UNCOMP_STREAM_TYPE_BZIP2: return compression_type::BZIP2;
+    case IO_UNCOMP_STREAM_TYPE_XZ: return compression_type::XZ;
+    case IO_UNCOMP_STREAM_TYPE_INFLATE: return compression_type::ZLIB;
+    case IO_UNCOMP_STREAM_TYPE_SNAPPY: return compression_type::SNAPPY;
+    case IO_UNCOMP_STREAM_TYPE_BROTLI: return compression_type::BROTLI;
+    case IO_UNCOMP_STREAM_TYPE_LZ4:
+    case IO_UNCOMP_STREAM_TYPE_LZ4_HADOOP: return compression_type::LZ4;
+    case IO_UNCOMP_STREAM_TYPE_ZSTD: return compression_type::ZSTD;
+    default: CUDF_FAIL("Unsupported compression type");
+  }
+}
+
+}  // namespace
+
+/**
+ * @copydoc cudf::io::get_host_decompression_statistics
+ */
+std::vector<host_decompression_statistics> get_host_decompression_statistics()
+{
+  std::vector<host_decompression_statistics> result;
+  for (auto const& codec : reader_host_decompressor().statistics()) {
+    auto const compression = to_compression_type(codec.stream_type);
+    // Methods that share a codec (e.g. raw and Hadoop-framed LZ4) are reported together
+    auto it = std::find_if(result.begin(), result.end(), [&](auto const& s) {
+      return s.compression == compression;
+    });
+    if (it == result.end()) {
+      result.push_back({compression, 0, 0, 0, 0, 0.});
+      it = result.end() - 1;
+    }
+    it->num_blocks += codec.num_blocks;
+    it->num_failed += codec.num_failed;
+    it->compressed_bytes += codec.compressed_bytes;
+    it->decompressed_bytes += codec.decompressed_bytes;
+    it->busy_seconds += codec.busy_seconds;
+  }
+  std::sort(result.begin(), result.end(), [](auto const& lhs, auto const& rhs) {
+    return lhs.compression < rhs.compression;
+  });
+  return result;
+}
+
 table_input_metadata::table_input_metadata(table_view const& table)
 {
   // Create a metadata hierarchy using `table`
@@ -447,6 +625,18 @@ table_input_metadata::table_input_metadata(table_view const& table)
  */
 std::unique_ptr<std::vector<uint8_t>> write_parquet(parquet_writer_options const& options,
                                                     rmm::mr::device_memory_resource* mr)
+{
+  std::vector<parquet_column_chunk_encoding> column_chunk_encodings;
+  return write_parquet(options, column_chunk_encodings, mr);
+}
+
+/**
+ * @copydoc cudf::io::write_parquet
+ */
+std::unique_ptr<std::vector<uint8_t>> write_parquet(
+  parquet_writer_options const& options,
+  std::vector<parquet_column_chunk_encoding>& column_chunk_encodings,
+  rmm::mr::device_memory_resource* mr)
 {
   namespace io_detail = cudf::io::detail;
 
@@ -458,7 +648,9 @@ std::unique_ptr<std::vector<uint8_t>> write_parquet(parquet_writer_options const
 
   writer->write(options.get_table(), options.get_partitions());
 
-  return writer->close(options.get_column_chunks_file_paths());
+  auto metadata          = writer->close(options.get_column_chunks_file_paths());
+  column_chunk_encodings = writer->column_chunk_encodings();
+  return metadata;
 }
 
 /**
@@ -498,5 +690,14 @@ std::unique_ptr<std::vector<uint8_t>> parquet_chunked_writer::close(
   return writer->close(column_chunks_file_path);
 }
 
+/**
+ * @copydoc cudf::io::parquet_chunked_writer::column_chunk_encodings
+ */
+std::vector<parquet_column_chunk_encoding> const& parquet_chunked_writer::column_chunk_encodings()
+  const
+{
+  return writer->column_chunk_encodings();
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -44,6 +44,9 @@
 
 #include <thrust/optional.h>
 
+#include <algorithm>
+#include <numeric>
+
 using cudf::host_span;
 
 namespace cudf {
@@ -149,7 +152,7 @@ std::unique_ptr<table> create_json_keys_info_table(parse_options_view const& par
 /**
  * @brief Extract the keys from the JSON file the name offsets/lengths.
  */
-std::vector<std::string> create_key_strings(char const* h_data,
+std::vector<std::string> create_key_strings(device_span<char const> d_data,
                                             table_view sorted_info,
                                             rmm::cuda_stream_view stream)
 {
@@ -168,12 +171,29 @@ std::vector<std::string> create_key_strings(char const* h_data,
                   cudaMemcpyDefault,
                   stream.value());
 
+  stream.synchronize();
+
+  // Copy the keys from the device data; compressed input is not kept in host memory
+  std::vector<size_t> h_key_offsets(num_cols + 1, 0);
+  std::transform_inclusive_scan(h_lens.cbegin(),
+                                h_lens.cend(),
+                                h_key_offsets.begin() + 1,
+                                std::plus<size_t>{},
+                                [](auto len) { return static_cast<size_t>(len); });
+  std::vector<char> h_keys(h_key_offsets.back());
+  for (cudf::size_type i = 0; i < num_cols; ++i) {
+    CUDA_TRY(cudaMemcpyAsync(h_keys.data() + h_key_offsets[i],
+                             d_data.data() + h_offsets[i],
+                             h_lens[i],
+                             cudaMemcpyDeviceToHost,
+                             stream.value()));
+  }
+  stream.synchronize();
+
   std::vector<std::string> names(num_cols);
-  std::transform(h_offsets.cbegin(),
-                 h_offsets.cend(),
-                 h_lens.cbegin(),
-                 names.begin(),
-                 [&](auto offset, auto len) { return std::string(h_data + offset, len); });
+  for (cudf::size_type i = 0; i < num_cols; ++i) {
+    names[i].assign(h_keys.data() + h_key_offsets[i], h_lens[i]);
+  }
   return names;
 }
 
@@ -192,7 +212,6 @@ auto sort_keys_info_by_offset(std::unique_ptr<table> info)
  */
 std::pair<std::vector<std::string>, col_map_ptr_type> get_json_object_keys_hashes(
   parse_options_view const& parse_opts,
-  host_span<char const> h_data,
   device_span<uint64_t const> rec_starts,
   device_span<char const> d_data,
   rmm::cuda_stream_view stream)
@@ -202,7 +221,7 @@ std::pair<std::vector<std::string>, col_map_ptr_type> get_json_object_keys_hashe
   auto aggregated_info = aggregate_keys_info(std::move(info));
   auto sorted_info     = sort_keys_info_by_offset(std::move(aggregated_info));
 
-  return {create_key_strings(h_data.data(), sorted_info->view(), stream),
+  return {create_key_strings(d_data, sorted_info->view(), stream),
           create_col_names_hash_map(sorted_info->get_column(2).view(), stream)};
 }
 
@@ -237,6 +256,50 @@ std::vector<char> ingest_raw_input(std::vector<std::unique_ptr<datasource>> cons
   }
 }
 
+/**
+ * @brief Decompresses the sources and uploads the uncompressed data to the device.
+ *
+ * Each source is decompressed in windows; the next window is decompressed on a separate thread
+ * while the current one is copied to the device, and the uncompressed data is never held in host
+ * memory as a whole.
+ */
+rmm::device_uvector<char> decompress_to_device(
+  std::vector<std::unique_ptr<datasource>> const& sources,
+  compression_type compression,
+  rmm::cuda_stream_view stream)
+{
+  constexpr size_t window_size = 64 * 1024 * 1024;  // 64MB
+
+  rmm::device_uvector<char> d_data(0, stream);
+  for (auto const& source : sources) {
+    if (source->is_empty()) { continue; }
+    decompressed_windows windows(source.get(), compression, window_size);
+    // Size the buffer from the uncompressed size recorded in the headers, when available
+    auto const size_hint = windows.uncompressed_size_hint();
+    if (d_data.size() + size_hint > d_data.capacity()) {
+      d_data.reserve(d_data.size() + size_hint, stream);
+    }
+    do {
+      auto const window = windows.next();
+      auto const offset = d_data.size();
+      if (offset + window.size() > d_data.capacity()) {
+        // Grow by a smaller factor than doubling, to limit the unused device memory
+        d_data.reserve(std::max(offset + window.size(), d_data.capacity() + d_data.capacity() / 2),
+                       stream);
+      }
+      d_data.resize(offset + window.size(), stream);
+      CUDA_TRY(cudaMemcpyAsync(d_data.data() + offset,
+                               window.data(),
+                               window.size(),
+                               cudaMemcpyHostToDevice,
+                               stream.value()));
+    } while (not windows.is_done());
+  }
+  // Release the capacity reserved past the end of the data
+  d_data.shrink_to_fit(stream);
+  return d_data;
+}
+
 bool should_load_whole_source(json_reader_options const& reader_opts)
 {
   return reader_opts.get_byte_range_offset() == 0 and  //
@@ -285,7 +348,11 @@ rmm::device_uvector<uint64_t> find_record_starts(json_reader_options const& read
   auto filtered_count = prefilter_count;
 
   // Exclude the ending newline as it does not precede a record start
-  if (h_data.back() == '\n') { filtered_count--; }
+  auto const last_char =
+    should_load_whole_source(reader_opts)
+      ? cudf::detail::make_std_vector_sync(d_data.subspan(d_data.size() - 1, 1), stream).front()
+      : h_data.back();
+  if (last_char == '\n') { filtered_count--; }
   rec_starts.resize(filtered_count, stream);
 
   return rec_starts;
@@ -339,7 +406,6 @@ rmm::device_uvector<char> upload_data_to_device(json_reader_options const& reade
 
 std::pair<std::vector<std::string>, col_map_ptr_type> get_column_names_and_map(
   parse_options_view const& parse_opts,
-  host_span<char const> h_data,
   device_span<uint64_t const> rec_starts,
   device_span<char const> d_data,
   rmm::cuda_stream_view stream)
@@ -373,7 +439,7 @@ std::pair<std::vector<std::string>, col_map_ptr_type> get_column_names_and_map(
   // If the first opening bracket is '{', assume object format
   if (first_curly_bracket < first_square_bracket) {
     // use keys as column names if input rows are objects
-    return get_json_object_keys_hashes(parse_opts, h_data, rec_starts, d_data, stream);
+    return get_json_object_keys_hashes(parse_opts, rec_starts, d_data, stream);
   } else {
     int cols_found    = 0;
     bool quotation    = false;
@@ -579,15 +645,23 @@ table_with_metadata read_json(std::vector<std::unique_ptr<datasource>>& sources,
   auto range_size        = reader_opts.get_byte_range_size();
   auto range_size_padded = reader_opts.get_byte_range_size_with_padding();
 
-  auto h_data = ingest_raw_input(
-    sources, reader_opts.get_compression(), range_offset, range_size, range_size_padded);
+  std::vector<char> h_data;
+  auto d_data = rmm::device_uvector<char>(0, stream);
 
-  CUDF_EXPECTS(h_data.size() != 0, "Ingest failed: uncompressed input data has zero size.\n");
+  if (reader_opts.get_compression() != compression_type::NONE and
+      should_load_whole_source(reader_opts)) {
+    // Decompress in windows, directly to the device
+    d_data = decompress_to_device(sources, reader_opts.get_compression(), stream);
+    CUDF_EXPECTS(d_data.size() != 0, "Ingest failed: uncompressed input data has zero size.\n");
+  } else {
+    h_data = ingest_raw_input(
+      sources, reader_opts.get_compression(), range_offset, range_size, range_size_padded);
 
-  auto d_data = rmm::device_uvector<char>(0, stream);
+    CUDF_EXPECTS(h_data.size() != 0, "Ingest failed: uncompressed input data has zero size.\n");
 
-  if (should_load_whole_source(reader_opts)) {
-    d_data = cudf::detail::make_device_uvector_async(h_data, stream);
+    if (should_load_whole_source(reader_opts)) {
+      d_data = cudf::detail::make_device_uvector_async(h_data, stream);
+    }
   }
 
   auto rec_starts = find_record_starts(reader_opts, h_data, d_data, stream);
@@ -601,7 +675,7 @@ table_with_metadata read_json(std::vector<std::unique_ptr<datasource>>& sources,
   CUDF_EXPECTS(d_data.size() != 0, "Error uploading input data to the GPU.\n");
 
   auto column_names_and_map =
-    get_column_names_and_map(parse_opts.view(), h_data, rec_starts, d_data, stream);
+    get_column_names_and_map(parse_opts.view(), rec_starts, d_data, stream);
 
   auto column_names = std::get<0>(column_names_and_map);
   auto column_map   = std::move(std::get<1>(column_names_and_map));
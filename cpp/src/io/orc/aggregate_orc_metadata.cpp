@@ -15,9 +15,15 @@
  */
 
 #include "aggregate_orc_metadata.hpp"
+#include "statistics_filter.hpp"
+
+#include <io/utilities/file_io_utilities.hpp>
 
 #include <algorithm>
+#include <map>
 #include <numeric>
+#include <optional>
+#include <type_traits>
 
 namespace cudf::io::orc::detail {
 
@@ -92,14 +98,11 @@ void add_column_to_mapping(std::map<size_type, std::vector<size_type>>& selected
 /**
  * @brief Create a metadata object from each element in the source vector
  */
-auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const& sources)
+auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const& sources,
+                            size_t tail_read_size)
 {
-  std::vector<metadata> metadatas;
-  std::transform(
-    sources.cbegin(), sources.cend(), std::back_inserter(metadatas), [](auto const& source) {
-      return metadata(source.get());
-    });
-  return metadatas;
+  return cudf::io::detail::parse_footers(
+    sources, [tail_read_size](datasource* source) { return metadata(source, tail_read_size); });
 }
 
 }  // namespace
@@ -121,8 +124,8 @@ size_type aggregate_orc_metadata::calc_num_stripes() const
 }
 
 aggregate_orc_metadata::aggregate_orc_metadata(
-  std::vector<std::unique_ptr<datasource>> const& sources)
-  : per_file_metadata(metadatas_from_sources(sources)),
+  std::vector<std::unique_ptr<datasource>> const& sources, size_t tail_read_size)
+  : per_file_metadata(metadatas_from_sources(sources, tail_read_size)),
     num_rows(calc_num_rows()),
     num_stripes(calc_num_stripes())
 {
@@ -225,19 +228,9 @@ std::vector<metadata::stripe_source_mapping> aggregate_orc_metadata::select_stri
       per_file_metadata[mapping.source_idx].stripefooters.resize(mapping.stripe_info.size());
 
       for (size_t i = 0; i < mapping.stripe_info.size(); i++) {
-        const auto stripe         = mapping.stripe_info[i].first;
-        const auto sf_comp_offset = stripe->offset + stripe->indexLength + stripe->dataLength;
-        const auto sf_comp_length = stripe->footerLength;
-        CUDF_EXPECTS(
-          sf_comp_offset + sf_comp_length < per_file_metadata[mapping.source_idx].source->size(),
-          "Invalid stripe information");
-        const auto buffer =
-          per_file_metadata[mapping.source_idx].source->host_read(sf_comp_offset, sf_comp_length);
-        size_t sf_length = 0;
-        auto sf_data     = per_file_metadata[mapping.source_idx].decompressor->Decompress(
-          buffer->data(), sf_comp_length, &sf_length);
-        ProtobufReader(sf_data, sf_length)
-          .read(per_file_metadata[mapping.source_idx].stripefooters[i]);
+        const auto stripe = mapping.stripe_info[i].first;
+        per_file_metadata[mapping.source_idx].stripefooters[i] =
+          read_stripe_footer(mapping.source_idx, *stripe);
         mapping.stripe_info[i].second = &per_file_metadata[mapping.source_idx].stripefooters[i];
         if (stripe->indexLength == 0) { row_grp_idx_present = false; }
       }
@@ -247,6 +240,155 @@ std::vector<metadata::stripe_source_mapping> aggregate_orc_metadata::select_stri
   return selected_stripes_mapping;
 }
 
+StripeFooter aggregate_orc_metadata::read_stripe_footer(int source_idx,
+                                                        StripeInformation const& stripe) const
+{
+  auto const& pfm           = per_file_metadata[source_idx];
+  const auto sf_comp_offset = stripe.offset + stripe.indexLength + stripe.dataLength;
+  const auto sf_comp_length = stripe.footerLength;
+  CUDF_EXPECTS(sf_comp_offset + sf_comp_length < pfm.source->size(),
+               "Invalid stripe information");
+  const auto buffer = pfm.source->host_read(sf_comp_offset, sf_comp_length);
+  size_t sf_length  = 0;
+  auto sf_data      = pfm.decompressor->Decompress(buffer->data(), sf_comp_length, &sf_length);
+  StripeFooter footer;
+  ProtobufReader(sf_data, sf_length).read(footer);
+  return footer;
+}
+
+std::vector<uint32_t> aggregate_orc_metadata::filter_column_ids(
+  std::vector<column_predicate> const& filters) const
+{
+  // Resolve the filtered columns among the top-level columns
+  auto const& root = get_schema(0);
+  std::vector<uint32_t> col_ids;
+  for (auto const& filter : filters) {
+    auto const it =
+      std::find(root.fieldNames.cbegin(), root.fieldNames.cend(), filter.column_name);
+    CUDF_EXPECTS(it != root.fieldNames.cend(),
+                 "Filter column " + filter.column_name + " not found in the file schema");
+    col_ids.push_back(root.subtypes[std::distance(root.fieldNames.cbegin(), it)]);
+  }
+  return col_ids;
+}
+
+std::pair<std::vector<std::vector<size_type>>, size_type> aggregate_orc_metadata::filter_stripes(
+  std::vector<std::vector<size_type>> const& stripes,
+  std::vector<column_predicate> const& filters) const
+{
+  CUDF_EXPECTS(stripes.empty() || stripes.size() == per_file_metadata.size(),
+               "Must specify stripes for each source");
+
+  auto const filter_col_ids = filter_column_ids(filters);
+
+  std::vector<std::vector<size_type>> selection(per_file_metadata.size());
+  size_type num_pruned = 0;
+  for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
+    auto const& pfm        = per_file_metadata[src_idx];
+    auto const num_stripes = pfm.get_num_stripes();
+    std::vector<size_type> candidates;
+    if (stripes.empty()) {
+      candidates.resize(num_stripes);
+      std::iota(candidates.begin(), candidates.end(), 0);
+    } else {
+      candidates = stripes[src_idx];
+    }
+
+    for (auto const stripe_idx : candidates) {
+      CUDF_EXPECTS(stripe_idx >= 0 && stripe_idx < num_stripes, "Invalid stripe index");
+      bool is_excluded = false;
+      // Files written without statistics have an empty metadata section
+      auto const& stripe_stats = pfm.get_metadata().stripeStats;
+      if (static_cast<size_t>(stripe_idx) < stripe_stats.size()) {
+        auto const& col_stats = stripe_stats[stripe_idx].colStats;
+        auto const num_rows   = pfm.ff.stripes[stripe_idx].numberOfRows;
+        for (size_t f = 0; f < filters.size() && !is_excluded; ++f) {
+          auto const col_id = filter_col_ids[f];
+          if (col_id >= col_stats.size()) { continue; }
+          is_excluded =
+            is_block_excluded(col_stats[col_id], get_schema(col_id), num_rows, filters[f]);
+        }
+      }
+      if (is_excluded) {
+        ++num_pruned;
+      } else {
+        selection[src_idx].push_back(stripe_idx);
+      }
+    }
+  }
+  return {std::move(selection), num_pruned};
+}
+
+std::vector<bool> aggregate_orc_metadata::find_excluded_row_groups(
+  size_type source_idx,
+  StripeInformation const& stripe,
+  StripeFooter const& footer,
+  std::vector<column_predicate> const& filters) const
+{
+  auto const& pfm           = per_file_metadata[source_idx];
+  auto const stride         = static_cast<uint64_t>(get_row_index_stride());
+  auto const num_row_groups = (stripe.numberOfRows + stride - 1) / stride;
+  std::vector<bool> excluded(num_row_groups, false);
+
+  // The index section of the stripe is read once for all the filters
+  auto const index_buffer = pfm.source->host_read(stripe.offset, stripe.indexLength);
+
+  // Returns the parsed index stream of the given kind and column; empty if not present. Each
+  // stream is only parsed once, even when several filters use the same column.
+  std::map<uint32_t, std::optional<RowIndex>> row_indexes;
+  std::map<uint32_t, std::optional<BloomFilterIndex>> bloom_indexes;
+  auto const parse_index_stream =
+    [&](auto& cache, StreamKind kind, uint32_t column_id) -> auto const& {
+    auto it = cache.find(column_id);
+    if (it != cache.end()) { return it->second; }
+
+    typename std::decay_t<decltype(cache)>::mapped_type index;
+    // The index streams are stored first, in the order of the stripe footer
+    size_t offset = 0;
+    for (auto const& stream : footer.streams) {
+      if (offset + stream.length > index_buffer->size()) { break; }
+      if (stream.kind == kind && stream.column_id == column_id) {
+        size_t index_length   = 0;
+        auto const index_data = pfm.decompressor->Decompress(
+          index_buffer->data() + offset, stream.length, &index_length);
+        ProtobufReader(index_data, index_length).read(index.emplace());
+        break;
+      }
+      offset += stream.length;
+    }
+    return cache.emplace(column_id, std::move(index)).first->second;
+  };
+
+  auto const filter_col_ids = filter_column_ids(filters);
+  for (size_t f = 0; f < filters.size(); ++f) {
+    auto const& type = get_schema(filter_col_ids[f]);
+
+    auto const& index = parse_index_stream(row_indexes, ROW_INDEX, filter_col_ids[f]);
+    // Ignore indexes that don't match the stride, e.g. when written by another writer
+    if (index.has_value() && index->entry.size() == num_row_groups) {
+      for (size_t rg = 0; rg < num_row_groups; ++rg) {
+        auto const& stats = index->entry[rg].statistics;
+        if (excluded[rg] || !stats.has_value()) { continue; }
+        auto const rg_num_rows = std::min(stride, stripe.numberOfRows - rg * stride);
+        excluded[rg] = is_block_excluded(stats.value(), type, rg_num_rows, filters[f]);
+      }
+    }
+
+    // Bloom filters can only refute equality
+    if (filters[f].op != predicate_op::EQUAL && filters[f].op != predicate_op::IN) { continue; }
+    auto const& bloom_index =
+      parse_index_stream(bloom_indexes, BLOOM_FILTER_UTF8, filter_col_ids[f]);
+    if (!bloom_index.has_value() || bloom_index->bloomFilter.size() != num_row_groups) {
+      continue;
+    }
+    for (size_t rg = 0; rg < num_row_groups; ++rg) {
+      if (excluded[rg]) { continue; }
+      excluded[rg] = is_bloom_filter_excluded(bloom_index->bloomFilter[rg], type, filters[f]);
+    }
+  }
+  return excluded;
+}
+
 column_hierarchy aggregate_orc_metadata::select_columns(
   std::vector<std::string> const& column_paths)
 {
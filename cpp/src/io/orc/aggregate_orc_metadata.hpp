@@ -17,6 +17,7 @@
 #include "orc.h"
 
 #include <map>
+#include <utility>
 #include <vector>
 
 namespace cudf::io::orc::detail {
@@ -59,13 +60,26 @@ class aggregate_orc_metadata {
    */
   [[nodiscard]] size_type calc_num_stripes() const;
 
+  /**
+   * @brief Returns the IDs of the top-level columns the filters apply to, in filter order.
+   */
+  [[nodiscard]] std::vector<uint32_t> filter_column_ids(
+    std::vector<column_predicate> const& filters) const;
+
  public:
   std::vector<metadata> per_file_metadata;
   size_type const num_rows;
   size_type const num_stripes;
   bool row_grp_idx_present{true};
 
-  aggregate_orc_metadata(std::vector<std::unique_ptr<datasource>> const& sources);
+  /**
+   * @brief Reads the metadata of each source.
+   *
+   * @param sources Sources of the ORC files
+   * @param tail_read_size Number of bytes read from the end of each source in the first request
+   */
+  aggregate_orc_metadata(std::vector<std::unique_ptr<datasource>> const& sources,
+                         size_t tail_read_size);
 
   [[nodiscard]] auto const& get_schema(int schema_idx) const
   {
@@ -118,6 +132,52 @@ class aggregate_orc_metadata {
     size_type& row_start,
     size_type& row_count);
 
+  /**
+   * @brief Reads and parses the footer of a stripe.
+   *
+   * @param source_idx Index of the source that contains the stripe
+   * @param stripe Information of the stripe
+   *
+   * @return The stripe footer
+   */
+  [[nodiscard]] StripeFooter read_stripe_footer(int source_idx,
+                                                StripeInformation const& stripe) const;
+
+  /**
+   * @brief Removes the stripes in which the column statistics prove that no row satisfies all the
+   * filters.
+   *
+   * Only the statistics in the file metadata section are used; no stripe data is read.
+   *
+   * @param stripes Lists of stripe indices to consider, per source; all if empty
+   * @param filters Conjunction of predicates on top-level columns
+   *
+   * @return Lists of the remaining stripe indices per source, and the number of stripes removed
+   */
+  [[nodiscard]] std::pair<std::vector<std::vector<size_type>>, size_type> filter_stripes(
+    std::vector<std::vector<size_type>> const& stripes,
+    std::vector<column_predicate> const& filters) const;
+
+  /**
+   * @brief Finds the row groups of a stripe in which the row index statistics prove that no row
+   * satisfies all the filters.
+   *
+   * Reads and parses the row index streams of the filtered columns on the host. The Bloom filter
+   * streams (`BLOOM_FILTER_UTF8`) are also used for `EQUAL` and `IN` predicates, when present.
+   *
+   * @param source_idx Index of the source that contains the stripe
+   * @param stripe Information of the stripe
+   * @param footer Footer of the stripe
+   * @param filters Conjunction of predicates on top-level columns
+   *
+   * @return One flag per row group of the stripe, `true` for the row groups that can be skipped
+   */
+  [[nodiscard]] std::vector<bool> find_excluded_row_groups(
+    size_type source_idx,
+    StripeInformation const& stripe,
+    StripeFooter const& footer,
+    std::vector<column_predicate> const& filters) const;
+
   /**
    * @brief Filters ORC file to a selection of columns, based on their paths in the file.
    *
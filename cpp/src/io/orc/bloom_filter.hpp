@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file bloom_filter.hpp
+ * @brief ORC Bloom filter primitives, shared by the writer kernels and the reader
+ *
+ * The hashing and bit selection match the Java implementation of ORC (`BloomFilterUtf8` streams),
+ * so that filters written by cuDF are usable by other readers, and vice versa.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace cudf {
+namespace io {
+namespace orc {
+
+constexpr uint64_t murmur3_c1   = 0x87c37b91114253d5ull;
+constexpr uint64_t murmur3_c2   = 0x4cf5ad432745937full;
+constexpr uint64_t murmur3_n1   = 0x52dce729ull;
+constexpr uint64_t murmur3_seed = 104729;
+
+CUDF_HOST_DEVICE inline uint64_t murmur3_rotl64(uint64_t x, int r)
+{
+  return (x << r) | (x >> (64 - r));
+}
+
+CUDF_HOST_DEVICE inline uint64_t murmur3_fmix64(uint64_t h)
+{
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdull;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ull;
+  h ^= h >> 33;
+  return h;
+}
+
+/**
+ * @brief Computes the 64-bit Murmur3 hash of a byte sequence, as ORC hashes string and binary
+ * values
+ */
+CUDF_HOST_DEVICE inline uint64_t murmur3_hash64(uint8_t const* data, size_t len)
+{
+  uint64_t h            = murmur3_seed;
+  auto const num_blocks = len / 8;
+  for (size_t i = 0; i < num_blocks; ++i) {
+    uint64_t k = 0;
+    for (int b = 7; b >= 0; --b) {
+      k = (k << 8) | data[i * 8 + b];
+    }
+    k *= murmur3_c1;
+    k = murmur3_rotl64(k, 31);
+    k *= murmur3_c2;
+    h ^= k;
+    h = murmur3_rotl64(h, 27) * 5 + murmur3_n1;
+  }
+  uint64_t k           = 0;
+  auto const tail      = data + num_blocks * 8;
+  auto const tail_size = len - num_blocks * 8;
+  for (auto b = static_cast<int>(tail_size) - 1; b >= 0; --b) {
+    k = (k << 8) | tail[b];
+  }
+  if (tail_size != 0) {
+    k *= murmur3_c1;
+    k = murmur3_rotl64(k, 31);
+    k *= murmur3_c2;
+    h ^= k;
+  }
+  h ^= len;
+  return murmur3_fmix64(h);
+}
+
+/**
+ * @brief Computes the hash of an integer value (Thomas Wang's 64-bit integer hash), as ORC hashes
+ * integral, date and timestamp values
+ */
+CUDF_HOST_DEVICE inline uint64_t bloom_filter_long_hash(int64_t value)
+{
+  // Arithmetic right shifts; left shifts are done on unsigned values to avoid overflows
+  auto key = static_cast<uint64_t>(value);
+  key      = ~key + (key << 21);
+  key      = key ^ static_cast<uint64_t>(static_cast<int64_t>(key) >> 24);
+  key      = key + (key << 3) + (key << 8);
+  key      = key ^ static_cast<uint64_t>(static_cast<int64_t>(key) >> 14);
+  key      = key + (key << 2) + (key << 4);
+  key      = key ^ static_cast<uint64_t>(static_cast<int64_t>(key) >> 28);
+  key      = key + (key << 31);
+  return key;
+}
+
+/**
+ * @brief Computes the hash of a floating-point value, as ORC hashes float and double values
+ */
+CUDF_HOST_DEVICE inline uint64_t bloom_filter_double_hash(double value)
+{
+  // NaN values have a single (canonical) representation
+  int64_t bits = 0x7ff8000000000000ll;
+  if (value == value) { memcpy(&bits, &value, sizeof(bits)); }
+  return bloom_filter_long_hash(bits);
+}
+
+/**
+ * @brief Returns the bit set in a filter of `num_bits` bits by the hash function `i` (1-based)
+ */
+CUDF_HOST_DEVICE inline uint32_t bloom_filter_bit(uint64_t hash, uint32_t i, uint32_t num_bits)
+{
+  auto const hash1 = static_cast<uint32_t>(hash);
+  auto const hash2 = static_cast<uint32_t>(hash >> 32);
+  auto combined    = static_cast<int32_t>(hash1 + i * hash2);
+  // Flip all the bits of negative hashes
+  if (combined < 0) { combined = ~combined; }
+  return static_cast<uint32_t>(combined) % num_bits;
+}
+
+/**
+ * @brief Returns the number of 64-bit words of a filter for `num_values` values and the given
+ * false positive probability
+ */
+inline uint32_t bloom_filter_num_words(int64_t num_values, double fpp)
+{
+  auto const n        = static_cast<double>(std::max<int64_t>(num_values, 1));
+  auto const num_bits = static_cast<int64_t>(-n * std::log(fpp) / (std::log(2.0) * std::log(2.0)));
+  // Always rounded up to the next multiple of 64 bits
+  return static_cast<uint32_t>(num_bits / 64 + 1);
+}
+
+/**
+ * @brief Returns the number of hash functions of a filter for `num_values` values
+ */
+inline uint32_t bloom_filter_num_hash_functions(int64_t num_values, uint32_t num_words)
+{
+  auto const n = static_cast<double>(std::max<int64_t>(num_values, 1));
+  return std::max<uint32_t>(1, std::llround(num_words * 64.0 / n * std::log(2.0)));
+}
+
+/**
+ * @brief Returns whether a filter bitset may contain a value with the given hash
+ *
+ * @param bitset Filter bitset, as little-endian 64-bit words
+ * @param size Size of the bitset, in bytes
+ * @param num_hash_functions Number of hash functions of the filter
+ * @param hash Hash of the value
+ *
+ * @return `false` if the value is definitely not in the set
+ */
+inline bool bloom_filter_may_contain(uint8_t const* bitset,
+                                     size_t size,
+                                     uint32_t num_hash_functions,
+                                     uint64_t hash)
+{
+  auto const num_bits = static_cast<uint32_t>(std::min<size_t>(size / 8, 1u << 25) * 64);
+  if (num_bits == 0) { return true; }
+  for (uint32_t i = 1; i <= num_hash_functions; ++i) {
+    auto const bit = bloom_filter_bit(hash, i, num_bits);
+    if ((bitset[bit / 8] & (1u << (bit % 8))) == 0) { return false; }
+  }
+  return true;
+}
+
+}  // namespace orc
+}  // namespace io
+}  // namespace cudf
@@ -18,6 +18,8 @@
 #include "orc_field_reader.hpp"
 #include "orc_field_writer.hpp"
 
+#include <io/comp/host_batch_decompressor.hpp>
+
 #include <cudf/lists/lists_column_view.hpp>
 
 #include <thrust/tabulate.h>
@@ -200,6 +202,33 @@ void ProtobufReader::read(Metadata& s, size_t maxlen)
   function_builder(s, maxlen, op);
 }
 
+void ProtobufReader::read(RowIndexEntry& s, size_t maxlen)
+{
+  auto op =
+    std::make_tuple(make_packed_field_reader(1, s.positions), make_field_reader(2, s.statistics));
+  function_builder(s, maxlen, op);
+}
+
+void ProtobufReader::read(RowIndex& s, size_t maxlen)
+{
+  auto op = std::make_tuple(make_field_reader(1, s.entry));
+  function_builder(s, maxlen, op);
+}
+
+void ProtobufReader::read(BloomFilter& s, size_t maxlen)
+{
+  // Field 2 (`bitset`) is only used by the original BLOOM_FILTER streams, which are not supported
+  auto op =
+    std::make_tuple(make_field_reader(1, s.numHashFunctions), make_field_reader(3, s.utf8bitset));
+  function_builder(s, maxlen, op);
+}
+
+void ProtobufReader::read(BloomFilterIndex& s, size_t maxlen)
+{
+  auto op = std::make_tuple(make_field_reader(1, s.bloomFilter));
+  function_builder(s, maxlen, op);
+}
+
 /**
  * @brief Add a single rowIndexEntry, negative input values treated as not present
  */
@@ -259,6 +288,29 @@ void ProtobufWriter::put_row_index_entry(int32_t present_blk,
   m_buf->data()[lpos] = (uint8_t)(sz + 2);
 }
 
+/**
+ * @brief Add a single BloomFilter entry of a BloomFilterIndex, with the bitset in `utf8bitset`
+ */
+void ProtobufWriter::put_bloom_filter(uint32_t num_hash_functions,
+                                      host_span<uint64_t const> bitset)
+{
+  std::vector<uint8_t> filter;
+  ProtobufWriter pbw(&filter);
+  pbw.put_uint(encode_field_number(1, ProtofType::VARINT));  // 1:numHashFunctions
+  pbw.put_uint(num_hash_functions);
+  pbw.put_uint(encode_field_number(3, ProtofType::FIXEDLEN));  // 3:utf8bitset
+  pbw.put_uint(bitset.size() * sizeof(uint64_t));
+  for (auto const word : bitset) {
+    for (int b = 0; b < 8; ++b) {
+      pbw.put_byte(static_cast<uint8_t>(word >> (8 * b)));
+    }
+  }
+
+  put_uint(encode_field_number(1, ProtofType::FIXEDLEN));  // 1:BloomFilterIndex.bloomFilter
+  put_uint(filter.size());
+  put_bytes<uint8_t>(filter);
+}
+
 size_t ProtobufWriter::write(const PostScript& s)
 {
   ProtobufFieldWriter w(this);
@@ -375,6 +427,7 @@ OrcDecompressor::OrcDecompressor(CompressionKind kind, uint32_t blockSize)
       case LZ4: stream_type = IO_UNCOMP_STREAM_TYPE_LZ4; break;
       case ZSTD: stream_type = IO_UNCOMP_STREAM_TYPE_ZSTD; break;
     }
+    m_stream_type  = stream_type;
     m_decompressor = HostDecompressor::Create(stream_type);
   } else {
     m_log2MaxRatio = 0;
@@ -423,8 +476,12 @@ const uint8_t* OrcDecompressor::Decompress(const uint8_t* srcBytes, size_t srcLe
     return srcBytes + 3;
   }
   m_buf.resize(max_dst_length);
-  auto dst          = m_buf.data();
-  size_t dst_length = 0;
+  auto dst = m_buf.data();
+  // Each block is first written at its worst-case position
+  std::vector<std::pair<size_t, size_t>> blocks;  // Position and size of each decompressed block
+  std::vector<host_decompression_task> tasks;
+  std::vector<size_t> task_blocks;
+  size_t dst_pos = 0;
   for (size_t i = 0; i + 3 < srcLen;) {
     uint32_t block_len       = srcBytes[i] | (srcBytes[i + 1] << 8) | (srcBytes[i + 2] << 16);
     uint32_t is_uncompressed = block_len & 1;
@@ -432,53 +489,98 @@ const uint8_t* OrcDecompressor::Decompress(const uint8_t* srcBytes, size_t srcLe
     block_len >>= 1;
     if (is_uncompressed) {
       // Uncompressed block
-      memcpy(dst + dst_length, srcBytes + i, block_len);
-      dst_length += block_len;
+      memcpy(dst + dst_pos, srcBytes + i, block_len);
+      blocks.emplace_back(dst_pos, block_len);
+      dst_pos += block_len;
     } else {
       // Compressed block
-      dst_length +=
-        m_decompressor->Decompress(dst + dst_length, m_blockSize, srcBytes + i, block_len);
+      task_blocks.push_back(blocks.size());
+      tasks.push_back({{srcBytes + i, block_len}, {dst + dst_pos, m_blockSize}, m_stream_type});
+      blocks.emplace_back(dst_pos, 0);
+      dst_pos += m_blockSize;
     }
     i += block_len;
   }
+  if (tasks.size() == 1) {
+    blocks[task_blocks[0]].second = m_decompressor->Decompress(
+      tasks[0].dst.data(), tasks[0].dst.size(), tasks[0].src.data(), tasks[0].src.size());
+  } else if (!tasks.empty()) {
+    // Decompress multiple blocks in parallel
+    std::vector<gpu_inflate_status_s> statuses(tasks.size());
+    reader_host_decompressor().decompress(tasks, statuses);
+    for (size_t t = 0; t < tasks.size(); ++t) {
+      blocks[task_blocks[t]].second = statuses[t].bytes_written;
+    }
+  }
+  // Move the blocks next to each other
+  size_t dst_length = 0;
+  for (auto const& [pos, size] : blocks) {
+    if (pos != dst_length) { memmove(dst + dst_length, dst + pos, size); }
+    dst_length += size;
+  }
   *dstLen = dst_length;
   return m_buf.data();
 }
 
-metadata::metadata(datasource* const src) : source(src)
+metadata::metadata(datasource* const src, size_t tail_read_size) : source(src)
 {
-  const auto len         = source->size();
-  const auto max_ps_size = std::min(len, static_cast<size_t>(256));
+  const auto len = source->size();
+  // Speculatively read the end of the file in a single request; it usually contains the
+  // postscript (max 255 bytes + 1 byte for length), the file footer and the metadata section
+  const auto tail_length = std::min(len, std::max(tail_read_size, static_cast<size_t>(256)));
+  const auto tail_offset = len - tail_length;
+  auto const tail        = source->host_read(tail_offset, tail_length);
 
-  // Read uncompressed postscript section (max 255 bytes + 1 byte for length)
-  auto buffer            = source->host_read(len - max_ps_size, max_ps_size);
-  const size_t ps_length = buffer->data()[max_ps_size - 1];
-  const uint8_t* ps_data = &buffer->data()[max_ps_size - ps_length - 1];
+  // Read uncompressed postscript section
+  const size_t ps_length = tail->data()[tail_length - 1];
+  CUDF_EXPECTS(ps_length < tail_length, "Invalid postscript length");
+  const uint8_t* ps_data = &tail->data()[tail_length - ps_length - 1];
   ProtobufReader(ps_data, ps_length).read(ps);
   CUDF_EXPECTS(ps.footerLength + ps_length < len, "Invalid footer length");
+  CUDF_EXPECTS(ps.metadataLength + ps.footerLength + ps_length < len, "Invalid metadata length");
 
   // If compression is used, the rest of the metadata is compressed
   // If no compressed is used, the decompressor is simply a pass-through
   decompressor = std::make_unique<OrcDecompressor>(ps.compression, ps.compressionBlockSize);
 
-  // Read compressed filefooter section
-  buffer           = source->host_read(len - ps_length - 1 - ps.footerLength, ps.footerLength);
-  size_t ff_length = 0;
-  auto ff_data     = decompressor->Decompress(buffer->data(), ps.footerLength, &ff_length);
+  // Read compressed filefooter section; only read again if it doesn't fit in the tail
+  auto const ff_offset = len - ps_length - 1 - ps.footerLength;
+  std::unique_ptr<datasource::buffer> ff_buffer;
+  if (ff_offset < tail_offset) { ff_buffer = source->host_read(ff_offset, ps.footerLength); }
+  auto const ff_raw = ff_buffer ? ff_buffer->data() : tail->data() + (ff_offset - tail_offset);
+  size_t ff_length  = 0;
+  auto ff_data      = decompressor->Decompress(ff_raw, ps.footerLength, &ff_length);
   ProtobufReader(ff_data, ff_length).read(ff);
   CUDF_EXPECTS(get_num_columns() > 0, "No columns found");
 
-  // Read compressed metadata section
-  buffer =
-    source->host_read(len - ps_length - 1 - ps.footerLength - ps.metadataLength, ps.metadataLength);
-  size_t md_length = 0;
-  auto md_data     = decompressor->Decompress(buffer->data(), ps.metadataLength, &md_length);
-  orc::ProtobufReader(md_data, md_length).read(md);
+  // The metadata section (stripe statistics) is only decoded when used; keep the compressed
+  // section if it's already in memory
+  md_offset = ff_offset - ps.metadataLength;
+  if (md_offset >= tail_offset) {
+    auto const md_raw = tail->data() + (md_offset - tail_offset);
+    md_buffer.assign(md_raw, md_raw + ps.metadataLength);
+  }
 
   init_parent_descriptors();
   init_column_names();
 }
 
+Metadata const& metadata::get_metadata() const
+{
+  if (not md.has_value()) {
+    std::unique_ptr<datasource::buffer> buffer;
+    if (md_buffer.empty() and ps.metadataLength != 0) {
+      buffer = source->host_read(md_offset, ps.metadataLength);
+    }
+    auto const md_raw = buffer ? buffer->data() : md_buffer.data();
+    size_t md_length  = 0;
+    auto md_data      = decompressor->Decompress(md_raw, ps.metadataLength, &md_length);
+    orc::ProtobufReader(md_data, md_length).read(md.emplace());
+    md_buffer = {};
+  }
+  return md.value();
+}
+
 void metadata::init_column_names()
 {
   column_names.resize(get_num_columns());
@@ -131,6 +131,24 @@ struct Metadata {
   std::vector<StripeStatistics> stripeStats;
 };
 
+struct RowIndexEntry {
+  std::vector<uint64_t> positions;              // Seek positions of the column streams
+  std::optional<column_statistics> statistics;  // Statistics of the row group
+};
+
+struct RowIndex {
+  std::vector<RowIndexEntry> entry;  // One entry per row group of the stripe
+};
+
+struct BloomFilter {
+  uint32_t numHashFunctions = 0;  // Number of hash functions
+  std::string utf8bitset;         // Bit set, as little-endian 64-bit words
+};
+
+struct BloomFilterIndex {
+  std::vector<BloomFilter> bloomFilter;  // One filter per row group of the stripe
+};
+
 int inline constexpr encode_field_number(int field_number, ProtofType field_type) noexcept
 {
   return (field_number * 8) + static_cast<int>(field_type);
@@ -223,6 +241,10 @@ class ProtobufReader {
   void read(column_statistics&, size_t maxlen);
   void read(StripeStatistics&, size_t maxlen);
   void read(Metadata&, size_t maxlen);
+  void read(RowIndexEntry&, size_t maxlen);
+  void read(RowIndex&, size_t maxlen);
+  void read(BloomFilter&, size_t maxlen);
+  void read(BloomFilterIndex&, size_t maxlen);
 
  private:
   template <int index>
@@ -514,6 +536,7 @@ class ProtobufWriter {
                            int32_t data2_ofs,
                            TypeKind kind,
                            ColStatsBlob const* stats);
+  void put_bloom_filter(uint32_t num_hash_functions, host_span<uint64_t const> bitset);
 
  public:
   size_t write(const PostScript&);
@@ -553,6 +576,7 @@ class OrcDecompressor {
   CompressionKind const m_kind;
   uint32_t m_log2MaxRatio = 24;  // log2 of maximum compression ratio
   uint32_t const m_blockSize;
+  int m_stream_type = IO_UNCOMP_STREAM_TYPE_INFER;  // Compression method of the blocks
   std::unique_ptr<HostDecompressor> m_decompressor;
   std::vector<uint8_t> m_buf;
 };
@@ -601,7 +625,14 @@ class metadata {
   };
 
  public:
-  explicit metadata(datasource* const src);
+  /**
+   * @brief Reads and parses the postscript and the file footer of a source.
+   *
+   * @param src Source of the ORC file
+   * @param tail_read_size Number of bytes read from the end of the file in the first request; the
+   * footer is only read separately when it doesn't fit in this range
+   */
+  metadata(datasource* const src, size_t tail_read_size);
 
   [[nodiscard]] size_t get_total_rows() const { return ff.numberOfRows; }
   [[nodiscard]] int get_num_stripes() const { return ff.stripes.size(); }
@@ -630,6 +661,14 @@ class metadata {
   }
   [[nodiscard]] int get_row_index_stride() const { return ff.rowIndexStride; }
 
+  /**
+   * @brief Returns the metadata section of the file, which holds the stripe statistics.
+   *
+   * The section is decoded on first use, and only read from the source if it was not part of the
+   * tail read by the constructor. Not thread-safe.
+   */
+  [[nodiscard]] Metadata const& get_metadata() const;
+
   /**
    * @brief Returns the ID of the parent column of the given column.
    */
@@ -657,7 +696,6 @@ class metadata {
  public:
   PostScript ps;
   FileFooter ff;
-  Metadata md;
   std::vector<StripeFooter> stripefooters;
   std::unique_ptr<OrcDecompressor> decompressor;
   datasource* const source;
@@ -676,6 +714,13 @@ class metadata {
   void init_column_names();
   std::vector<std::string> column_names;
   std::vector<std::string> column_paths;
+
+  // Decoded metadata section; empty until requested
+  mutable std::optional<Metadata> md;
+  // Compressed metadata section, if it was part of the tail read; released once decoded
+  mutable std::vector<uint8_t> md_buffer;
+  // Offset of the metadata section in the source
+  size_t md_offset = 0;
 };
 
 /**
@@ -29,6 +29,8 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <optional>
+
 namespace cudf {
 namespace io {
 namespace orc {
@@ -117,12 +119,13 @@ struct ColumnDesc {
  * @brief Struct to describe a groups of row belonging to a column stripe
  */
 struct RowGroup {
-  uint32_t chunk_id;        // Column chunk this entry belongs to
-  uint32_t strm_offset[2];  // Index offset for CI_DATA and CI_DATA2 streams
-  uint16_t run_pos[2];      // Run position for CI_DATA and CI_DATA2
-  uint32_t num_rows;        // number of rows in rowgroup
-  uint32_t start_row;       // starting row of the rowgroup
-  uint32_t num_child_rows;  // number of rows of children in rowgroup in case of list type
+  uint32_t chunk_id;          // Column chunk this entry belongs to
+  uint32_t strm_offset[2];    // Index offset for CI_DATA and CI_DATA2 streams
+  uint16_t run_pos[2];        // Run position for CI_DATA and CI_DATA2
+  uint32_t num_rows;          // number of rows in rowgroup
+  uint32_t start_row;         // starting row of the rowgroup
+  uint32_t num_child_rows;    // number of rows of children in rowgroup in case of list type
+  uint32_t num_skipped_rows;  // number of rows in the preceding row groups that are not output
 };
 
 /**
@@ -335,12 +338,28 @@ void CompactOrcDataStreams(device_2dspan<StripeStream> strm_desc,
                            device_2dspan<encoder_chunk_streams> enc_streams,
                            rmm::cuda_stream_view stream);
 
+/**
+ * @brief Returns the maximum size of a block of `comp_blk_size` bytes after compression
+ *
+ * @param[in] compression Type of compression
+ * @param[in] compression_level Compression level, if set by the user
+ * @param[in] comp_blk_size Compression block size
+ *
+ * @return The space to reserve for each compressed block
+ */
+size_t MaxCompressedBlockSize(CompressionKind compression,
+                              std::optional<int> compression_level,
+                              uint32_t comp_blk_size);
+
 /**
  * @brief Launches kernel(s) for compressing data streams
  *
+ * ZLIB and ZSTD blocks, and LZ4 blocks when nvCOMP is disabled, are compressed on the host.
+ *
  * @param[in] compressed_data Output compressed blocks
  * @param[in] num_compressed_blocks Total number of compressed blocks
  * @param[in] compression Type of compression
+ * @param[in] compression_level Compression level, if set by the user
  * @param[in] comp_blk_size Compression block size
  * @param[in] max_comp_blk_size Max size of any block after compression
  * @param[in,out] strm_desc StripeStream device array [stripe][stream]
@@ -352,6 +371,7 @@ void CompactOrcDataStreams(device_2dspan<StripeStream> strm_desc,
 void CompressOrcDataStreams(uint8_t* compressed_data,
                             uint32_t num_compressed_blocks,
                             CompressionKind compression,
+                            std::optional<int> compression_level,
                             uint32_t comp_blk_size,
                             uint32_t max_comp_blk_size,
                             device_2dspan<StripeStream> strm_desc,
@@ -25,10 +25,15 @@
 #include "timezone.cuh"
 
 #include <io/comp/gpuinflate.h>
+#include <io/comp/io_uncomp.h>
+#include <io/comp/nvcomp_adapter.hpp>
 #include <io/utilities/config_utils.hpp>
+#include <io/utilities/io_read_planner.hpp>
 #include <io/utilities/time_utils.cuh>
 
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
@@ -39,10 +44,12 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
-#include <nvcomp/snappy.h>
+#include <thrust/binary_search.h>
 
 #include <algorithm>
 #include <iterator>
+#include <numeric>
+#include <tuple>
 
 namespace cudf {
 namespace io {
@@ -172,6 +179,11 @@ size_t gather_stream_info(const size_t stripe_index,
   uint64_t src_offset = 0;
   uint64_t dst_offset = 0;
   for (const auto& stream : stripefooter->streams) {
+    // Bloom filters are only used on the host, when filtering row groups
+    if (stream.kind == orc::BLOOM_FILTER || stream.kind == orc::BLOOM_FILTER_UTF8) {
+      src_offset += stream.length;
+      continue;
+    }
     if (!stream.column_id || *stream.column_id >= orc2gdf.size()) {
       dst_offset += stream.length;
       continue;
@@ -227,6 +239,40 @@ size_t gather_stream_info(const size_t stripe_index,
   return dst_offset;
 }
 
+/**
+ * @brief Returns the file ranges of the streams of a stripe that `gather_stream_info` selects for
+ * the columns of a nesting level, in stripe footer order
+ */
+std::vector<byte_range> selected_stream_ranges(orc::StripeInformation const& stripeinfo,
+                                               orc::StripeFooter const& stripefooter,
+                                               std::vector<int> const& orc2gdf,
+                                               std::vector<orc::SchemaType> const& types,
+                                               bool apply_struct_map)
+{
+  std::vector<byte_range> ranges;
+  uint64_t src_offset = 0;
+  for (auto const& stream : stripefooter.streams) {
+    auto const offset = stripeinfo.offset + src_offset;
+    src_offset += stream.length;
+    if (stream.kind == orc::BLOOM_FILTER || stream.kind == orc::BLOOM_FILTER_UTF8) { continue; }
+    if (!stream.column_id || *stream.column_id >= orc2gdf.size()) { continue; }
+
+    auto const column_id = *stream.column_id;
+    auto is_selected     = orc2gdf[column_id] != -1;
+    if (not is_selected and apply_struct_map) {
+      // The PRESENT stream of a struct column is read for its selected children
+      auto const& schema_type = types[column_id];
+      is_selected =
+        schema_type.kind == orc::STRUCT && stream.kind == orc::PRESENT &&
+        std::any_of(schema_type.subtypes.cbegin(), schema_type.subtypes.cend(), [&](auto idx) {
+          return idx < orc2gdf.size() && orc2gdf[idx] >= 0;
+        });
+    }
+    if (is_selected) { ranges.push_back({offset, stream.length}); }
+  }
+  return ranges;
+}
+
 /**
  * @brief Determines cuDF type of an ORC Decimal column.
  */
@@ -261,70 +307,34 @@ auto decimal_column_type(std::vector<std::string> const& float64_columns,
   return type_id::DECIMAL128;
 }
 
-}  // namespace
-
-void snappy_decompress(device_span<gpu_inflate_input_s> comp_in,
-                       device_span<gpu_inflate_status_s> comp_stat,
-                       size_t max_uncomp_page_size,
-                       rmm::cuda_stream_view stream)
+/**
+ * @brief Returns an estimate of the device memory needed to decode a value of an ORC type
+ *
+ * Strings are decoded to (pointer, length) pairs before the output column is built.
+ */
+size_t estimated_decoded_size(TypeKind kind)
 {
-  size_t num_blocks = comp_in.size();
-  size_t temp_size;
-
-  auto status =
-    nvcompBatchedSnappyDecompressGetTempSize(num_blocks, max_uncomp_page_size, &temp_size);
-  CUDF_EXPECTS(nvcompStatus_t::nvcompSuccess == status,
-               "Unable to get scratch size for snappy decompression");
-
-  rmm::device_buffer scratch(temp_size, stream);
-  rmm::device_uvector<void const*> compressed_data_ptrs(num_blocks, stream);
-  rmm::device_uvector<size_t> compressed_data_sizes(num_blocks, stream);
-  rmm::device_uvector<void*> uncompressed_data_ptrs(num_blocks, stream);
-  rmm::device_uvector<size_t> uncompressed_data_sizes(num_blocks, stream);
-
-  rmm::device_uvector<size_t> actual_uncompressed_data_sizes(num_blocks, stream);
-  rmm::device_uvector<nvcompStatus_t> statuses(num_blocks, stream);
-
-  // Prepare the vectors
-  auto comp_it = thrust::make_zip_iterator(compressed_data_ptrs.begin(),
-                                           compressed_data_sizes.begin(),
-                                           uncompressed_data_ptrs.begin(),
-                                           uncompressed_data_sizes.data());
-  thrust::transform(rmm::exec_policy(stream),
-                    comp_in.begin(),
-                    comp_in.end(),
-                    comp_it,
-                    [] __device__(gpu_inflate_input_s in) {
-                      return thrust::make_tuple(in.srcDevice, in.srcSize, in.dstDevice, in.dstSize);
-                    });
-
-  status = nvcompBatchedSnappyDecompressAsync(compressed_data_ptrs.data(),
-                                              compressed_data_sizes.data(),
-                                              uncompressed_data_sizes.data(),
-                                              actual_uncompressed_data_sizes.data(),
-                                              num_blocks,
-                                              scratch.data(),
-                                              scratch.size(),
-                                              uncompressed_data_ptrs.data(),
-                                              statuses.data(),
-                                              stream.value());
-  CUDF_EXPECTS(nvcompStatus_t::nvcompSuccess == status, "unable to perform snappy decompression");
-
-  CUDF_EXPECTS(thrust::equal(rmm::exec_policy(stream),
-                             statuses.begin(),
-                             statuses.end(),
-                             thrust::make_constant_iterator(nvcompStatus_t::nvcompSuccess)),
-               "Error during snappy decompression");
-  thrust::for_each_n(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator(0),
-    num_blocks,
-    [=, actual_uncomp_sizes = actual_uncompressed_data_sizes.data()] __device__(auto i) {
-      comp_stat[i].bytes_written = actual_uncomp_sizes[i];
-      comp_stat[i].status        = 0;
-    });
+  switch (kind) {
+    case BOOLEAN:
+    case BYTE: return 1;
+    case SHORT: return 2;
+    case INT:
+    case FLOAT:
+    case DATE: return 4;
+    case LONG:
+    case DOUBLE:
+    case TIMESTAMP: return 8;
+    case DECIMAL: return 16;
+    case STRING:
+    case BINARY:
+    case VARCHAR:
+    case CHAR: return sizeof(string_index_pair);
+    default: return sizeof(size_type);
+  }
 }
 
+}  // namespace
+
 rmm::device_buffer reader::impl::decompress_stripe_data(
   cudf::detail::hostdevice_2dvector<gpu::ColumnDesc>& chunks,
   const std::vector<rmm::device_buffer>& stripe_data,
@@ -395,23 +405,64 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
 
   // Dispatch batches of blocks to decompress
   if (num_compressed_blocks > 0) {
+    device_span<gpu_inflate_input_s> inflate_in_view{inflate_in.data(), num_compressed_blocks};
+    device_span<gpu_inflate_status_s> inflate_out_view{inflate_out.data(), num_compressed_blocks};
+    // Codecs without a device decompressor are decoded on the host, as well as all codecs with a
+    // host decompressor if host decompression is always enabled
+    auto const is_host_preferred = host_decompression_integration::is_always_enabled();
+    auto decompress_on_host = [&](int stream_type) {
+      auto const h_inflate_in = cudf::detail::make_std_vector_sync(
+        device_span<gpu_inflate_input_s const>{inflate_in_view}, stream);
+      std::vector<gpu_inflate_status_s> h_inflate_out(num_compressed_blocks);
+      host_decompress(stream_type, h_inflate_in, h_inflate_out, stream);
+      CUDF_EXPECTS(std::all_of(h_inflate_out.cbegin(),
+                               h_inflate_out.cend(),
+                               [](auto const& status) { return status.status == 0; }),
+                   "Error during host decompression");
+      CUDA_TRY(cudaMemcpyAsync(inflate_out.data(),
+                               h_inflate_out.data(),
+                               sizeof(gpu_inflate_status_s) * num_compressed_blocks,
+                               cudaMemcpyHostToDevice,
+                               stream.value()));
+      stream.synchronize();
+    };
     switch (decompressor->GetKind()) {
       case orc::ZLIB:
-        CUDA_TRY(
-          gpuinflate(inflate_in.data(), inflate_out.data(), num_compressed_blocks, 0, stream));
+        if (is_host_preferred) {
+          decompress_on_host(IO_UNCOMP_STREAM_TYPE_INFLATE);
+        } else {
+          CUDA_TRY(
+            gpuinflate(inflate_in.data(), inflate_out.data(), num_compressed_blocks, 0, stream));
+        }
         break;
       case orc::SNAPPY:
-        if (nvcomp_integration::is_stable_enabled()) {
-          device_span<gpu_inflate_input_s> inflate_in_view{inflate_in.data(),
-                                                           num_compressed_blocks};
-          device_span<gpu_inflate_status_s> inflate_out_view{inflate_out.data(),
-                                                             num_compressed_blocks};
-          snappy_decompress(inflate_in_view, inflate_out_view, max_uncomp_block_size, stream);
+        if (is_host_preferred) {
+          decompress_on_host(IO_UNCOMP_STREAM_TYPE_SNAPPY);
+        } else if (nvcomp_integration::is_stable_enabled()) {
+          nvcomp::batched_decompress(nvcomp::compression_type::SNAPPY,
+                                     inflate_in_view,
+                                     inflate_out_view,
+                                     max_uncomp_block_size,
+                                     false,
+                                     stream);
         } else {
           CUDA_TRY(
             gpu_unsnap(inflate_in.data(), inflate_out.data(), num_compressed_blocks, stream));
         }
         break;
+      case orc::LZ4:
+        if (!is_host_preferred && nvcomp_integration::is_stable_enabled()) {
+          nvcomp::batched_decompress(nvcomp::compression_type::LZ4,
+                                     inflate_in_view,
+                                     inflate_out_view,
+                                     max_uncomp_block_size,
+                                     false,
+                                     stream);
+        } else {
+          decompress_on_host(IO_UNCOMP_STREAM_TYPE_LZ4);
+        }
+        break;
+      case orc::ZSTD: decompress_on_host(IO_UNCOMP_STREAM_TYPE_ZSTD); break;
       default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
     }
   }
@@ -590,6 +641,52 @@ void scan_null_counts(cudf::detail::hostdevice_2dvector<gpu::ColumnDesc> const&
   stream.synchronize();
 }
 
+/**
+ * @brief Replaces the null masks of all the decoded rows with the null masks of the rows of the
+ * kept row groups.
+ *
+ * @param out_buffers Output columns' device buffers
+ * @param kept_row_bounds Begin and end rows of the contiguous ranges of kept rows
+ * @param num_kept_rows Number of rows in the kept ranges
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource to use for device memory allocation
+ */
+void compact_null_masks(std::vector<column_buffer>& out_buffers,
+                        std::vector<size_type> const& kept_row_bounds,
+                        size_type num_kept_rows,
+                        rmm::cuda_stream_view stream,
+                        rmm::mr::device_memory_resource* mr)
+{
+  // First output row and first decoded row of each kept range
+  auto const num_ranges = kept_row_bounds.size() / 2;
+  std::vector<size_type> range_starts(2 * num_ranges);
+  size_type out_row = 0;
+  for (size_t range = 0; range < num_ranges; ++range) {
+    range_starts[range]              = out_row;
+    range_starts[num_ranges + range] = kept_row_bounds[2 * range];
+    out_row += kept_row_bounds[2 * range + 1] - kept_row_bounds[2 * range];
+  }
+  auto const d_range_starts = cudf::detail::make_device_uvector_async(range_starts, stream);
+
+  for (auto& out_buffer : out_buffers) {
+    if (not out_buffer.is_nullable) { continue; }
+    std::tie(out_buffer._null_mask, out_buffer.null_count()) = cudf::detail::valid_if(
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_kept_rows),
+      [out_starts = d_range_starts.data(),
+       in_starts  = d_range_starts.data() + num_ranges,
+       num_ranges,
+       valid_map = out_buffer.null_mask<bitmask_type const>()] __device__(size_type row) {
+        auto const range =
+          thrust::upper_bound(thrust::seq, out_starts, out_starts + num_ranges, row) - out_starts -
+          1;
+        return bit_is_set(valid_map, in_starts[range] + row - out_starts[range]);
+      },
+      stream,
+      mr);
+  }
+}
+
 void reader::impl::decode_stream_data(cudf::detail::hostdevice_2dvector<gpu::ColumnDesc>& chunks,
                                       size_t num_dicts,
                                       size_t skip_rows,
@@ -883,7 +980,7 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
                    rmm::mr::device_memory_resource* mr)
   : _mr(mr),
     _sources(std::move(sources)),
-    _metadata{_sources},
+    _metadata{_sources, options.get_tail_read_size()},
     selected_columns{_metadata.select_columns(options.get_columns())}
 {
   // Override output timestamp resolution if requested
@@ -903,11 +1000,219 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
   is_decimal128_enabled  = options.is_enabled_decimal128();
 }
 
+reader::impl::impl(std::size_t chunk_read_limit,
+                   std::vector<std::unique_ptr<datasource>>&& sources,
+                   orc_reader_options const& options,
+                   rmm::mr::device_memory_resource* mr)
+  : impl(std::move(sources), options, mr)
+{
+  _chunk_read_limit = chunk_read_limit;
+  _filters          = options.get_filters();
+  compute_batches(options);
+}
+
+reader::impl::~impl()
+{
+  // Reads ahead may still be writing to their host buffers
+  for (auto& prefetched : _next_prefetched) {
+    if (prefetched.read.valid()) { prefetched.read.wait(); }
+  }
+}
+
+void reader::impl::compute_batches(orc_reader_options const& options)
+{
+  auto const num_sources    = _metadata.per_file_metadata.size();
+  auto const use_row_bounds = options.get_skip_rows() != 0 or options.get_num_rows() != -1;
+
+  // Stripes to read, in order, with the rows to read from each of them
+  struct stripe_rows {
+    int source_idx;
+    size_type stripe_idx;
+    size_t begin;  // First row to read, counted from the start of the dataset with row bounds
+    size_t end;
+  };
+  std::vector<stripe_rows> selection;
+  if (use_row_bounds) {
+    auto const total_rows = static_cast<size_t>(_metadata.get_num_rows());
+    auto const rows_begin = std::min<size_t>(std::max(options.get_skip_rows(), 0), total_rows);
+    auto const rows_end =
+      options.get_num_rows() < 0
+        ? total_rows
+        : std::min<size_t>(rows_begin + options.get_num_rows(), total_rows);
+    size_t stripe_start_row = 0;
+    for (size_t src_idx = 0; src_idx < num_sources; ++src_idx) {
+      auto const& stripes = _metadata.per_file_metadata[src_idx].ff.stripes;
+      for (size_t stripe_idx = 0; stripe_idx < stripes.size(); ++stripe_idx) {
+        auto const begin = std::max(stripe_start_row, rows_begin);
+        auto const end   = std::min(stripe_start_row + stripes[stripe_idx].numberOfRows, rows_end);
+        if (begin < end) {
+          selection.push_back(
+            {static_cast<int>(src_idx), static_cast<size_type>(stripe_idx), begin, end});
+        }
+        stripe_start_row += stripes[stripe_idx].numberOfRows;
+      }
+    }
+  } else {
+    auto stripes = options.get_stripes();
+    if (not _filters.empty()) {
+      std::tie(stripes, _num_stripes_pruned) = _metadata.filter_stripes(stripes, _filters);
+    }
+    if (stripes.empty()) {
+      stripes.resize(num_sources);
+      for (size_t src_idx = 0; src_idx < num_sources; ++src_idx) {
+        stripes[src_idx].resize(_metadata.per_file_metadata[src_idx].ff.stripes.size());
+        std::iota(stripes[src_idx].begin(), stripes[src_idx].end(), 0);
+      }
+    }
+    CUDF_EXPECTS(stripes.size() == num_sources, "Must specify stripes for each source");
+    for (size_t src_idx = 0; src_idx < num_sources; ++src_idx) {
+      auto const& source_stripes = _metadata.per_file_metadata[src_idx].ff.stripes;
+      for (auto const stripe_idx : stripes[src_idx]) {
+        CUDF_EXPECTS(stripe_idx >= 0 and static_cast<size_t>(stripe_idx) < source_stripes.size(),
+                     "Invalid stripe index");
+        selection.push_back(
+          {static_cast<int>(src_idx), stripe_idx, 0, source_stripes[stripe_idx].numberOfRows});
+      }
+    }
+  }
+
+  // Decoded size of a row of the selected columns, at all levels of nesting
+  size_t row_size = 0;
+  for (auto const& level : selected_columns.levels) {
+    for (auto const& col : level) {
+      row_size += estimated_decoded_size(_metadata.get_col_type(col.id).kind);
+    }
+  }
+  auto const is_compressed = _metadata.per_file_metadata[0].ps.compression != orc::NONE;
+  // Batches of nested columns can only start at the first row, so row bounds are read at once
+  auto const is_split_allowed =
+    _chunk_read_limit != 0 and (not use_row_bounds or selected_columns.num_levels() <= 1);
+
+  _batches.clear();
+  size_t batch_size = 0;
+  for (auto const& stripe : selection) {
+    auto const& info = _metadata.per_file_metadata[stripe.source_idx].ff.stripes[stripe.stripe_idx];
+    auto const stream_size = (info.indexLength + info.dataLength) * (is_compressed ? 2 : 1);
+    auto const stripe_size =
+      (stream_size * (stripe.end - stripe.begin)) / std::max<uint64_t>(info.numberOfRows, 1) +
+      (stripe.end - stripe.begin) * row_size;
+
+    if (_batches.empty() or (is_split_allowed and batch_size + stripe_size > _chunk_read_limit)) {
+      auto& batch = _batches.emplace_back();
+      if (use_row_bounds) {
+        batch.skip_rows = static_cast<size_type>(stripe.begin);
+        batch.num_rows  = 0;
+      } else {
+        batch.stripes.resize(num_sources);
+        batch.skip_rows = 0;
+        batch.num_rows  = -1;
+      }
+      batch_size = 0;
+    }
+    auto& batch = _batches.back();
+    if (use_row_bounds) {
+      batch.num_rows = static_cast<size_type>(stripe.end - batch.skip_rows);
+    } else {
+      batch.stripes[stripe.source_idx].push_back(stripe.stripe_idx);
+    }
+    batch.stripe_ids.emplace_back(stripe.source_idx, stripe.stripe_idx);
+    batch_size += stripe_size;
+  }
+
+  // Always return at least one (empty) table
+  if (_batches.empty()) {
+    auto& batch = _batches.emplace_back();
+    if (use_row_bounds) {
+      batch.skip_rows = 0;
+      batch.num_rows  = 0;
+    } else {
+      batch.stripes.resize(num_sources);
+      batch.skip_rows = 0;
+      batch.num_rows  = -1;
+    }
+  }
+  _current_batch = 0;
+}
+
+void reader::impl::prefetch_batch(size_t batch)
+{
+  // Only the streams of the selected columns are read ahead, coalesced with the same plan as in
+  // `read()`, and the bytes in flight are limited to the read limit
+  size_t prefetched_size = 0;
+  for (auto const& [source_idx, stripe_idx] : _batches[batch].stripe_ids) {
+    auto const& file_metadata = _metadata.per_file_metadata[source_idx];
+    auto const& stripe        = file_metadata.ff.stripes[stripe_idx];
+    auto const footer         = _metadata.read_stripe_footer(source_idx, stripe);
+    for (size_t level = 0; level < selected_columns.num_levels(); ++level) {
+      std::vector<int> orc2gdf(_metadata.get_num_cols(), -1);
+      for (size_t col_idx = 0; col_idx < selected_columns.levels[level].size(); ++col_idx) {
+        orc2gdf[selected_columns.levels[level][col_idx].id] = col_idx;
+      }
+      auto const stream_ranges =
+        selected_stream_ranges(stripe, footer, orc2gdf, _metadata.get_types(), level == 0);
+      for (auto const& read : io_read_planner{}.plan(stream_ranges).reads) {
+        if (read.size == 0 or file_metadata.source->is_device_read_preferred(read.size)) {
+          continue;
+        }
+        if (prefetched_size + read.size > _chunk_read_limit) { return; }
+        prefetched_size += read.size;
+
+        auto& prefetched      = _next_prefetched.emplace_back();
+        prefetched.source_idx = source_idx;
+        prefetched.offset     = read.offset;
+        prefetched.data.resize(read.size);
+        prefetched.read =
+          file_metadata.source->host_read_async(read.offset, read.size, prefetched.data.data());
+      }
+    }
+  }
+}
+
+reader::impl::prefetched_stripe const* reader::impl::find_prefetched(int source_idx,
+                                                                     size_t offset,
+                                                                     size_t size) const
+{
+  auto const it =
+    std::find_if(_prefetched.cbegin(), _prefetched.cend(), [&](auto const& prefetched) {
+      return prefetched.source_idx == source_idx and offset >= prefetched.offset and
+             offset + size <= prefetched.offset + prefetched.data.size();
+    });
+  return it != _prefetched.cend() ? &*it : nullptr;
+}
+
+table_with_metadata reader::impl::read_chunk(rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(has_next(), "No more chunks to read");
+
+  // The stripes of this batch were read ahead while the previous batch was decoded
+  _prefetched = std::move(_next_prefetched);
+  _next_prefetched.clear();
+  for (auto& prefetched : _prefetched) {
+    CUDF_EXPECTS(prefetched.read.get() == prefetched.data.size(),
+                 "Unexpected discrepancy in bytes read.");
+  }
+  // Read the following batch ahead, while this one is decoded
+  if (_current_batch + 1 < _batches.size()) { prefetch_batch(_current_batch + 1); }
+
+  auto const& batch = _batches[_current_batch];
+  auto result       = read(batch.skip_rows, batch.num_rows, batch.stripes, _filters, stream);
+  _prefetched.clear();
+
+  // The pruned stripes are reported once, with the first chunk
+  if (_current_batch == 0) { result.metadata.num_stripes_pruned += _num_stripes_pruned; }
+  ++_current_batch;
+  return result;
+}
+
 timezone_table reader::impl::compute_timezone_table(
   const std::vector<cudf::io::orc::metadata::stripe_source_mapping>& selected_stripes,
   rmm::cuda_stream_view stream)
 {
-  if (selected_stripes.empty()) return {};
+  auto const first_stripes =
+    std::find_if(selected_stripes.cbegin(), selected_stripes.cend(), [](auto const& mapping) {
+      return not mapping.stripe_info.empty();
+    });
+  if (first_stripes == selected_stripes.cend()) return {};
 
   auto const has_timestamp_column = std::any_of(
     selected_columns.levels.cbegin(), selected_columns.levels.cend(), [&](auto& col_lvl) {
@@ -917,13 +1222,14 @@ timezone_table reader::impl::compute_timezone_table(
     });
   if (not has_timestamp_column) return {};
 
-  return build_timezone_transition_table(selected_stripes[0].stripe_info[0].second->writerTimezone,
+  return build_timezone_transition_table(first_stripes->stripe_info[0].second->writerTimezone,
                                          stream);
 }
 
 table_with_metadata reader::impl::read(size_type skip_rows,
                                        size_type num_rows,
                                        const std::vector<std::vector<size_type>>& stripes,
+                                       std::vector<column_predicate> const& filters,
                                        rmm::cuda_stream_view stream)
 {
   // Selected columns at different levels of nesting are stored in different elements
@@ -931,6 +1237,9 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   CUDF_EXPECTS(skip_rows == 0 or selected_columns.num_levels() == 1,
                "skip_rows is not supported by nested columns");
 
+  // The column mapping is rebuilt by each read of a chunked read
+  _col_meta = reader_column_meta{};
+
   std::vector<std::unique_ptr<column>> out_columns;
   // buffer and stripe data are stored as per nesting level
   std::vector<std::vector<column_buffer>> out_buffers(selected_columns.num_levels());
@@ -943,10 +1252,29 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   if (selected_columns.num_levels() == 0)
     return {std::make_unique<table>(), std::move(out_metadata)};
 
+  // Skip stripes in which the statistics prove that no row matches the filters
+  std::vector<std::vector<size_type>> filtered_stripes;
+  if (!filters.empty()) {
+    std::tie(filtered_stripes, out_metadata.num_stripes_pruned) =
+      _metadata.filter_stripes(stripes, filters);
+  }
+
+  // Row bounds of the row groups that aren't skipped based on the row index statistics
+  std::vector<size_type> kept_row_bounds;
+
   // Select only stripes required (aka row groups)
-  const auto selected_stripes = _metadata.select_stripes(stripes, skip_rows, num_rows);
+  const auto selected_stripes =
+    _metadata.select_stripes(filters.empty() ? stripes : filtered_stripes, skip_rows, num_rows);
 
-  auto const tz_table = compute_timezone_table(selected_stripes, stream);
+  // The timezone table is built once, and shared by all the chunks of a chunked read
+  auto const has_stripes =
+    std::any_of(selected_stripes.cbegin(), selected_stripes.cend(), [](auto const& mapping) {
+      return not mapping.stripe_info.empty();
+    });
+  if (has_stripes and not _tz_table.has_value()) {
+    _tz_table = compute_timezone_table(selected_stripes, stream);
+  }
+  auto const tz_table = _tz_table.has_value() ? _tz_table->view() : timezone_table_view{};
 
   // Iterates through levels of nested columns, child column will be one level down
   // compared to parent column.
@@ -1021,6 +1349,14 @@ table_with_metadata reader::impl::read(size_type skip_rows,
         // TODO: Fix logic to handle unaligned rows
         (skip_rows == 0);
 
+      // Row groups can only be skipped when each of them is decoded separately
+      auto const filter_row_groups =
+        use_index && level == 0 && !filters.empty() && selected_columns.num_levels() == 1;
+      std::vector<bool> excluded_row_groups;
+      // Number of rows in the skipped row groups that precede each row group
+      std::vector<size_type> row_group_skipped_rows;
+      size_type num_skipped_rows = 0;
+
       // Logically view streams as columns
       std::vector<orc_stream_info> stream_info;
 
@@ -1070,36 +1406,70 @@ table_with_metadata reader::impl::read(size_type skip_rows,
             is_data_empty = true;
           }
 
-          stripe_data.emplace_back(total_data_size, stream);
+          // Coalesce nearby streams into fewer reads; the gaps between the streams are read too,
+          // so the stream positions within the stripe buffer are remapped to the planned reads
+          auto const& source = _metadata.per_file_metadata[stripe_source_mapping.source_idx].source;
+          std::vector<byte_range> stream_ranges;
+          std::transform(stream_info.cbegin() + stream_count,
+                         stream_info.cend(),
+                         std::back_inserter(stream_ranges),
+                         [](auto const& info) -> byte_range {
+                           return {info.offset, info.length};
+                         });
+          auto const plan = io_read_planner{}.plan(stream_ranges);
+          out_metadata.num_bytes_requested += plan.requested_bytes;
+          out_metadata.num_bytes_over_read += plan.over_read_bytes;
+          out_metadata.num_read_requests_saved += plan.requests_saved;
+
+          std::vector<size_t> read_dst_pos(plan.reads.size() + 1, 0);
+          for (size_t r = 0; r < plan.reads.size(); ++r) {
+            read_dst_pos[r + 1] = read_dst_pos[r] + plan.reads[r].size;
+          }
+          for (size_t strm = 0; strm < stream_ranges.size(); ++strm) {
+            stream_info[stream_count + strm].dst_pos =
+              read_dst_pos[plan.read_index[strm]] +
+              (stream_ranges[strm].size != 0 ? plan.offset_in_read(strm, stream_ranges[strm]) : 0);
+          }
+
+          stripe_data.emplace_back(is_data_empty ? total_data_size : read_dst_pos.back(), stream);
           auto dst_base = static_cast<uint8_t*>(stripe_data.back().data());
 
-          // Coalesce consecutive streams into one read
-          while (not is_data_empty and stream_count < stream_info.size()) {
-            const auto d_dst  = dst_base + stream_info[stream_count].dst_pos;
-            const auto offset = stream_info[stream_count].offset;
-            auto len          = stream_info[stream_count].length;
-            stream_count++;
-
-            while (stream_count < stream_info.size() &&
-                   stream_info[stream_count].offset == offset + len) {
-              len += stream_info[stream_count].length;
-              stream_count++;
-            }
-            if (_metadata.per_file_metadata[stripe_source_mapping.source_idx]
-                  .source->is_device_read_preferred(len)) {
+          for (size_t r = 0; not is_data_empty and r < plan.reads.size(); ++r) {
+            const auto d_dst  = dst_base + read_dst_pos[r];
+            const auto offset = plan.reads[r].offset;
+            const auto len    = plan.reads[r].size;
+            auto const prefetched =
+              find_prefetched(stripe_source_mapping.source_idx, offset, len);
+            if (prefetched != nullptr) {
+              // Read ahead while the previous chunk of a chunked read was decoded
+              CUDA_TRY(cudaMemcpyAsync(d_dst,
+                                       prefetched->data.data() + (offset - prefetched->offset),
+                                       len,
+                                       cudaMemcpyHostToDevice,
+                                       stream.value()));
+            } else if (source->is_device_read_preferred(len)) {
               read_tasks.push_back(
-                std::make_pair(_metadata.per_file_metadata[stripe_source_mapping.source_idx]
-                                 .source->device_read_async(offset, len, d_dst, stream),
-                               len));
-
+                std::make_pair(source->device_read_async(offset, len, d_dst, stream), len));
             } else {
-              const auto buffer =
-                _metadata.per_file_metadata[stripe_source_mapping.source_idx].source->host_read(
-                  offset, len);
-              CUDF_EXPECTS(buffer->size() == len, "Unexpected discrepancy in bytes read.");
-              CUDA_TRY(cudaMemcpyAsync(
-                d_dst, buffer->data(), len, cudaMemcpyHostToDevice, stream.value()));
-              stream.synchronize();
+              // Keep the host read in flight; the copy to device happens when the task is waited on
+              auto host_buffer = std::vector<uint8_t>(len);
+              auto h_dst       = host_buffer.data();
+              auto copy_fn     = [d_dst, stream](std::vector<uint8_t> host_buffer,
+                                             std::future<size_t> fut_read_size) {
+                auto const read_size = fut_read_size.get();
+                CUDF_EXPECTS(read_size == host_buffer.size(),
+                             "Unexpected discrepancy in bytes read.");
+                CUDA_TRY(cudaMemcpyAsync(
+                  d_dst, host_buffer.data(), read_size, cudaMemcpyHostToDevice, stream.value()));
+                stream.synchronize();
+                return read_size;
+              };
+              read_tasks.push_back(
+                std::make_pair(std::async(std::launch::deferred,
+                                          copy_fn,
+                                          std::move(host_buffer),
+                                          source->host_read_async(offset, len, h_dst)),
+                               len));
             }
           }
 
@@ -1110,6 +1480,31 @@ table_with_metadata reader::impl::read(size_type skip_rows,
             stripe_num_rowgroups = (num_rows_per_stripe + _metadata.get_row_index_stride() - 1) /
                                    _metadata.get_row_index_stride();
           }
+          if (filter_row_groups) {
+            auto const stripe_excluded = _metadata.find_excluded_row_groups(
+              stripe_source_mapping.source_idx, *stripe_info, *stripe_footer, filters);
+            for (size_t rg = 0; rg < stripe_excluded.size(); ++rg) {
+              // Rows past `num_rows` are cropped from the output
+              auto const rg_begin = static_cast<size_type>(std::min<size_t>(
+                stripe_start_row + rg * _metadata.get_row_index_stride(), num_rows));
+              auto const rg_end   = static_cast<size_type>(
+                std::min<size_t>({stripe_start_row + num_rows_per_stripe,
+                                  stripe_start_row + (rg + 1) * _metadata.get_row_index_stride(),
+                                  static_cast<size_t>(num_rows)}));
+              excluded_row_groups.push_back(stripe_excluded[rg]);
+              row_group_skipped_rows.push_back(num_skipped_rows);
+              if (stripe_excluded[rg]) {
+                num_skipped_rows += rg_end - rg_begin;
+                continue;
+              }
+              // Rows of the row groups to return, merged with the previous range when contiguous
+              if (!kept_row_bounds.empty() && kept_row_bounds.back() == rg_begin) {
+                kept_row_bounds.back() = rg_end;
+              } else {
+                kept_row_bounds.insert(kept_row_bounds.end(), {rg_begin, rg_end});
+              }
+            }
+          }
           // Update chunks to reference streams pointers
           for (size_t col_idx = 0; col_idx < num_columns; col_idx++) {
             auto& chunk = chunks[stripe_idx][col_idx];
@@ -1218,6 +1613,30 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           }
         }
 
+        auto const num_excluded_row_groups =
+          std::count(excluded_row_groups.cbegin(), excluded_row_groups.cend(), true);
+        auto const prune_row_groups = num_excluded_row_groups != 0 and not is_data_empty;
+        if (prune_row_groups) {
+          // Nothing is decoded in the skipped row groups, and the rows of the other row groups are
+          // written to the output shifted by the number of preceding skipped rows. The row groups
+          // are positioned in the data streams with the row index and the present stream is
+          // decoded for the whole stripe, so the decoding state does not depend on the skipped
+          // rows.
+          row_groups.device_to_host(stream, true);
+          for (size_t rg = 0; rg < num_rowgroups; ++rg) {
+            for (size_t col_idx = 0; col_idx < num_columns; ++col_idx) {
+              if (excluded_row_groups[rg]) {
+                row_groups[rg][col_idx].num_rows = 0;
+              } else {
+                row_groups[rg][col_idx].num_skipped_rows = row_group_skipped_rows[rg];
+              }
+            }
+          }
+          row_groups.host_to_device(stream);
+          out_metadata.num_row_groups_pruned += static_cast<size_type>(num_excluded_row_groups);
+        }
+        auto const num_kept_rows = prune_row_groups ? num_rows - num_skipped_rows : num_rows;
+
         for (size_t i = 0; i < column_types.size(); ++i) {
           bool is_nullable = false;
           for (size_t j = 0; j < total_num_stripes; ++j) {
@@ -1227,17 +1646,27 @@ table_with_metadata reader::impl::read(size_type skip_rows,
             }
           }
           auto is_list_type = (column_types[i].id() == type_id::LIST);
-          auto n_rows       = (level == 0) ? num_rows : _col_meta.num_child_rows[i];
+          auto n_rows       = (level == 0) ? num_kept_rows : _col_meta.num_child_rows[i];
           // For list column, offset column will be always size + 1
           if (is_list_type) n_rows++;
           out_buffers[level].emplace_back(column_types[i], n_rows, is_nullable, stream, _mr);
         }
 
+        // The present streams are decoded for all the rows of the stripes; the null masks of the
+        // kept rows are gathered from them after decoding
+        if (prune_row_groups) {
+          for (auto& out_buffer : out_buffers[level]) {
+            if (not out_buffer.is_nullable) { continue; }
+            out_buffer._null_mask =
+              cudf::detail::create_null_mask(num_rows, mask_state::ALL_NULL, stream);
+          }
+        }
+
         if (not is_data_empty) {
           decode_stream_data(chunks,
                              num_dict_entries,
                              skip_rows,
-                             tz_table.view(),
+                             tz_table,
                              row_groups,
                              _metadata.get_row_index_stride(),
                              out_buffers[level],
@@ -1245,6 +1674,10 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                              stream);
         }
 
+        if (prune_row_groups) {
+          compact_null_masks(out_buffers[level], kept_row_bounds, num_kept_rows, stream, _mr);
+        }
+
         // Extract information to process nested child columns
         if (nested_col.size()) {
           if (not is_data_empty) {
@@ -1306,14 +1739,40 @@ reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
   _impl = std::make_unique<impl>(std::move(sources), options, mr);
 }
 
+reader::reader() = default;
+
 // Destructor within this translation unit
 reader::~reader() = default;
 
 // Forward to implementation
 table_with_metadata reader::read(orc_reader_options const& options, rmm::cuda_stream_view stream)
 {
-  return _impl->read(
-    options.get_skip_rows(), options.get_num_rows(), options.get_stripes(), stream);
+  return _impl->read(options.get_skip_rows(),
+                     options.get_num_rows(),
+                     options.get_stripes(),
+                     options.get_filters(),
+                     stream);
+}
+
+// Forward to implementation
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                               orc_reader_options const& options,
+                               rmm::mr::device_memory_resource* mr)
+{
+  _impl = std::make_unique<impl>(chunk_read_limit, std::move(sources), options, mr);
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk(rmm::cuda_stream_view stream)
+{
+  return _impl->read_chunk(stream);
 }
 
 }  // namespace orc
@@ -29,7 +29,9 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <future>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -86,12 +88,36 @@ class reader::impl {
                 orc_reader_options const& options,
                 rmm::mr::device_memory_resource* mr);
 
+  /**
+   * @brief Constructor for chunked reading, from a read limit and a dataset source with reader
+   * options.
+   *
+   * The stripes selected by the options are split into batches up front; see
+   * `compute_batches()`.
+   *
+   * @param chunk_read_limit Limit on the device memory used to read each chunk, in bytes, or `0`
+   * to read all the selected stripes in a single chunk
+   * @param sources Dataset sources
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit impl(std::size_t chunk_read_limit,
+                std::vector<std::unique_ptr<datasource>>&& sources,
+                orc_reader_options const& options,
+                rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Destructor; waits for the outstanding reads ahead of a chunked read
+   */
+  ~impl();
+
   /**
    * @brief Read an entire set or a subset of data and returns a set of columns
    *
    * @param skip_rows Number of rows to skip from the start
    * @param num_rows Number of rows to read
    * @param stripes Indices of individual stripes to load if non-empty
+   * @param filters Predicates used to skip stripes based on column statistics
    * @param stream CUDA stream used for device memory operations and kernel launches
    *
    * @return The set of columns along with metadata
@@ -99,9 +125,83 @@ class reader::impl {
   table_with_metadata read(size_type skip_rows,
                            size_type num_rows,
                            const std::vector<std::vector<size_type>>& stripes,
+                           std::vector<column_predicate> const& filters,
                            rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Returns whether there are chunks left to read, in chunked reading mode
+   */
+  [[nodiscard]] bool has_next() const { return _current_batch < _batches.size(); }
+
+  /**
+   * @brief Reads the next batch of stripes, in chunked reading mode
+   *
+   * The stripe data of the following batch is read ahead while this batch is decoded.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream);
+
  private:
+  /**
+   * @brief Consecutive stripes to be read as one chunk
+   */
+  struct stripe_batch {
+    std::vector<std::vector<size_type>> stripes;  // Stripes of each source; empty for row bounds
+    size_type skip_rows;                          // First row of the batch, with row bounds
+    size_type num_rows;                           // Number of rows of the batch, with row bounds
+    std::vector<std::pair<int, size_type>> stripe_ids;  // Source and index of the stripes
+  };
+
+  /**
+   * @brief Host copy of a range of stripe streams, read ahead of its batch
+   */
+  struct prefetched_stripe {
+    int source_idx;
+    size_t offset;
+    std::vector<uint8_t> data;
+    std::future<size_t> read;
+  };
+
+  /**
+   * @brief Splits the selected stripes into batches that can each be read within the read limit
+   *
+   * The device memory needed to read a stripe is estimated from the size of its streams
+   * (compressed streams are also decompressed to device memory) and from the sizes of the
+   * selected column types. Consecutive stripes are grouped into a batch while they fit in the
+   * limit.
+   *
+   * @param options Settings for controlling reading behavior
+   */
+  void compute_batches(orc_reader_options const& options);
+
+  /**
+   * @brief Starts reading the streams of the selected columns in the stripes of a batch to host
+   * memory
+   *
+   * The streams are coalesced into the same reads as in `read()`. Reads that the source prefers to
+   * issue directly to device memory are not read ahead, and the reads ahead stop once the read
+   * limit would be exceeded.
+   *
+   * @param batch Index of the batch
+   */
+  void prefetch_batch(size_t batch);
+
+  /**
+   * @brief Returns the read ahead that holds a range of a source, if any
+   *
+   * @param source_idx Index of the source
+   * @param offset Offset of the range in the source
+   * @param size Size of the range
+   *
+   * @return The read ahead, or `nullptr` if the range hasn't been read ahead
+   */
+  [[nodiscard]] prefetched_stripe const* find_prefetched(int source_idx,
+                                                         size_t offset,
+                                                         size_t size) const;
+
   /**
    * @brief Decompresses the stripe data, at stream granularity
    *
@@ -226,6 +326,17 @@ class reader::impl {
   bool is_decimal128_enabled{true};
   data_type _timestamp_type{type_id::EMPTY};
   reader_column_meta _col_meta{};
+  // shared by all the chunks of a chunked read
+  std::optional<timezone_table> _tz_table;
+
+  // chunked reading state
+  std::size_t _chunk_read_limit = 0;
+  std::vector<column_predicate> _filters;
+  size_type _num_stripes_pruned = 0;
+  std::vector<stripe_batch> _batches;
+  size_t _current_batch = 0;
+  std::vector<prefetched_stripe> _prefetched;       // stripes of the batch being read
+  std::vector<prefetched_stripe> _next_prefetched;  // stripes of the following batch
 };
 
 }  // namespace orc
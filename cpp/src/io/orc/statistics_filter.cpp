@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "statistics_filter.hpp"
+#include "bloom_filter.hpp"
+
+#include <io/utilities/column_predicate.hpp>
+
+#include <cudf/utilities/error.hpp>
+
+#include <cmath>
+#include <optional>
+#include <string>
+
+namespace cudf::io::orc::detail {
+namespace {
+
+/**
+ * @brief Evaluates the predicate against min/max values of type `T`.
+ *
+ * Missing min/max values are treated as unknown bounds.
+ */
+template <typename T>
+bool is_excluded(std::optional<T> const& min,
+                 std::optional<T> const& max,
+                 std::optional<int64_t> null_count,
+                 int64_t num_rows,
+                 predicate_op op,
+                 T const& value)
+{
+  io::detail::block_statistics<T> block;
+  block.min        = min;
+  block.max        = max;
+  block.null_count = null_count;
+  block.num_rows   = num_rows;
+  return io::detail::is_block_excluded(block, op, value);
+}
+
+}  // namespace
+
+bool is_block_excluded(ColStatsBlob const& blob,
+                       SchemaType const& type,
+                       int64_t num_rows,
+                       column_predicate const& predicate)
+{
+  if (blob.empty()) { return false; }
+  column_statistics stats;
+  ProtobufReader(blob.data(), blob.size()).read(stats);
+  return is_block_excluded(stats, type, num_rows, predicate);
+}
+
+bool is_block_excluded(column_statistics const& stats,
+                       SchemaType const& type,
+                       int64_t num_rows,
+                       column_predicate const& predicate)
+{
+  if (predicate.op == predicate_op::IN) {
+    return io::detail::is_in_list_excluded(predicate, [&](auto const& equal) {
+      return is_block_excluded(stats, type, num_rows, equal);
+    });
+  }
+
+  // `numberOfValues` only counts the non-null values
+  auto const null_count =
+    stats.number_of_values.has_value()
+      ? std::optional<int64_t>{num_rows - static_cast<int64_t>(stats.number_of_values.value())}
+      : std::nullopt;
+
+  auto const op = predicate.op;
+  if (op == predicate_op::IS_NULL || op == predicate_op::IS_NOT_NULL) {
+    return is_excluded<int64_t>(std::nullopt, std::nullopt, null_count, num_rows, op, 0);
+  }
+
+  auto const* const int_value = std::get_if<int64_t>(&predicate.value);
+  auto const* const fp_value  = std::get_if<double>(&predicate.value);
+  auto const* const str_value = std::get_if<std::string>(&predicate.value);
+  switch (type.kind) {
+    case BYTE:
+    case SHORT:
+    case INT:
+    case LONG: {
+      CUDF_EXPECTS(int_value != nullptr,
+                   "Filter on column " + predicate.column_name + " requires an integer value");
+      auto const& int_stats = stats.int_stats.value_or(integer_statistics{});
+      return is_excluded(
+        int_stats.minimum, int_stats.maximum, null_count, num_rows, op, *int_value);
+    }
+    case DATE: {
+      CUDF_EXPECTS(int_value != nullptr,
+                   "Filter on column " + predicate.column_name + " requires an integer value");
+      auto const& date_stats = stats.date_stats.value_or(date_statistics{});
+      auto const widen       = [](auto const& days) {
+        return days.has_value() ? std::optional<int64_t>{days.value()} : std::nullopt;
+      };
+      return is_excluded(
+        widen(date_stats.minimum), widen(date_stats.maximum), null_count, num_rows, op, *int_value);
+    }
+    case TIMESTAMP: {
+      CUDF_EXPECTS(int_value != nullptr,
+                   "Filter on column " + predicate.column_name + " requires an integer value");
+      auto const& ts_stats = stats.timestamp_stats.value_or(timestamp_statistics{});
+      // `minimum` and `maximum` are relative to the writer timezone; without the UTC bounds the
+      // range of the values is unknown
+      auto min = ts_stats.minimum_utc;
+      auto max = ts_stats.maximum_utc;
+      // The statistics are truncated to milliseconds; widen the bounds to cover the sub-millisecond
+      // part of the values
+      if (min.has_value()) { min = min.value() - 1; }
+      if (max.has_value()) { max = max.value() + 1; }
+      return is_excluded(min, max, null_count, num_rows, op, *int_value);
+    }
+    case FLOAT:
+    case DOUBLE: {
+      CUDF_EXPECTS(str_value == nullptr,
+                   "Filter on column " + predicate.column_name + " requires a numeric value");
+      auto const value = int_value != nullptr ? static_cast<double>(*int_value) : *fp_value;
+      // No value compares equal to NaN; `NOT_EQUAL` would hold for every row
+      if (std::isnan(value)) { return false; }
+      auto const& double_stats = stats.double_stats.value_or(double_statistics{});
+      // NaN bounds don't order the values of the block
+      if ((double_stats.minimum.has_value() && std::isnan(double_stats.minimum.value())) ||
+          (double_stats.maximum.has_value() && std::isnan(double_stats.maximum.value()))) {
+        return is_excluded<double>(std::nullopt, std::nullopt, null_count, num_rows, op, value);
+      }
+      return is_excluded(
+        double_stats.minimum, double_stats.maximum, null_count, num_rows, op, value);
+    }
+    case STRING:
+    case VARCHAR:
+    case CHAR: {
+      CUDF_EXPECTS(str_value != nullptr,
+                   "Filter on column " + predicate.column_name + " requires a string value");
+      auto const& string_stats = stats.string_stats.value_or(string_statistics{});
+      return is_excluded(
+        string_stats.minimum, string_stats.maximum, null_count, num_rows, op, *str_value);
+    }
+    default:
+      // Only the null count is known for the other types
+      return is_excluded<int64_t>(std::nullopt, std::nullopt, null_count, num_rows, op, 0);
+  }
+}
+
+bool is_bloom_filter_excluded(BloomFilter const& filter,
+                              SchemaType const& type,
+                              column_predicate const& predicate)
+{
+  if (predicate.op == predicate_op::IN) {
+    return io::detail::is_in_list_excluded(predicate, [&](auto const& equal) {
+      return is_bloom_filter_excluded(filter, type, equal);
+    });
+  }
+  if (predicate.op != predicate_op::EQUAL) { return false; }
+
+  auto const* const int_value = std::get_if<int64_t>(&predicate.value);
+  auto const* const fp_value  = std::get_if<double>(&predicate.value);
+  auto const* const str_value = std::get_if<std::string>(&predicate.value);
+  auto const may_contain      = [&](uint64_t hash) {
+    return bloom_filter_may_contain(reinterpret_cast<uint8_t const*>(filter.utf8bitset.data()),
+                                    filter.utf8bitset.size(),
+                                    filter.numHashFunctions,
+                                    hash);
+  };
+  switch (type.kind) {
+    case BOOLEAN:
+    case BYTE:
+    case SHORT:
+    case INT:
+    case LONG:
+    case DATE: return int_value != nullptr && !may_contain(bloom_filter_long_hash(*int_value));
+    case FLOAT:
+    case DOUBLE: {
+      if (str_value != nullptr) { return false; }
+      auto const value = int_value != nullptr ? static_cast<double>(*int_value) : *fp_value;
+      // Zero and NaN values have multiple representations
+      if (value == 0 || std::isnan(value)) { return false; }
+      // Float values are widened to double before they are hashed
+      if (type.kind == FLOAT && static_cast<double>(static_cast<float>(value)) != value) {
+        return false;
+      }
+      return !may_contain(bloom_filter_double_hash(value));
+    }
+    case STRING:
+    case VARCHAR:
+    case CHAR:
+      return str_value != nullptr &&
+             !may_contain(murmur3_hash64(reinterpret_cast<uint8_t const*>(str_value->data()),
+                                         str_value->size()));
+    // Timestamp predicates are in milliseconds and don't identify a single value
+    default: return false;
+  }
+}
+
+}  // namespace cudf::io::orc::detail
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file statistics_filter.hpp
+ * @brief Evaluation of reader filters against ORC column statistics
+ */
+
+#pragma once
+
+#include "orc.h"
+
+#include <cudf/io/types.hpp>
+
+#include <cstdint>
+
+namespace cudf::io::orc::detail {
+
+/**
+ * @brief Returns whether the column statistics prove that no row of a block of rows (e.g. a
+ * stripe) satisfies the predicate.
+ *
+ * Blocks without statistics, or with statistics that can't be ordered against the predicate value
+ * (e.g. decimal and binary columns), are never excluded.
+ *
+ * @throw cudf::logic_error if the predicate value cannot be compared with the column type
+ *
+ * @param blob Encoded statistics of the column in the block
+ * @param type Schema type of the (top-level) column
+ * @param num_rows Number of rows in the block
+ * @param predicate Predicate to evaluate
+ *
+ * @return `true` if the block can be skipped
+ */
+bool is_block_excluded(ColStatsBlob const& blob,
+                       SchemaType const& type,
+                       int64_t num_rows,
+                       column_predicate const& predicate);
+
+/**
+ * @brief Returns whether the decoded column statistics prove that no row of a block of rows (e.g.
+ * a row index group) satisfies the predicate.
+ *
+ * @throw cudf::logic_error if the predicate value cannot be compared with the column type
+ *
+ * @param stats Decoded statistics of the column in the block
+ * @param type Schema type of the (top-level) column
+ * @param num_rows Number of rows in the block
+ * @param predicate Predicate to evaluate
+ *
+ * @return `true` if the block can be skipped
+ */
+bool is_block_excluded(column_statistics const& stats,
+                       SchemaType const& type,
+                       int64_t num_rows,
+                       column_predicate const& predicate);
+
+/**
+ * @brief Returns whether the Bloom filter of a column in a row group proves that no row of the row
+ * group satisfies the predicate.
+ *
+ * Only `EQUAL` and `IN` predicates can be evaluated, on integral, date, floating-point and string
+ * columns. Values that have multiple representations (e.g. zero floating-point values) are never
+ * excluded.
+ *
+ * @param filter Bloom filter of the column in the row group
+ * @param type Schema type of the (top-level) column
+ * @param predicate Predicate to evaluate
+ *
+ * @return `true` if the row group can be skipped
+ */
+bool is_bloom_filter_excluded(BloomFilter const& filter,
+                              SchemaType const& type,
+                              column_predicate const& predicate);
+
+}  // namespace cudf::io::orc::detail
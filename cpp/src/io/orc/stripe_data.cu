@@ -1702,6 +1702,8 @@ __global__ void __launch_bounds__(block_size)
           s->top.data.cur_row + s->u.rowdec.row[t] - 1 < s->top.data.end_row) {
         size_t row = s->top.data.cur_row + s->u.rowdec.row[t] - 1 - first_row;
         if (row < max_num_rows) {
+          // The rows of the skipped row groups are not stored in the output
+          if (num_rowgroups > 0) { row -= s->top.data.index.num_skipped_rows; }
           void* data_out = s->chunk.column_data_base;
           switch (s->chunk.type_kind) {
             case FLOAT:
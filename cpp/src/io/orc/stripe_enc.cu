@@ -20,6 +20,8 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/utilities/bit.hpp>
+#include <io/comp/io_comp.h>
+#include <io/comp/nvcomp_adapter.hpp>
 #include <io/utilities/block_utils.cuh>
 #include <io/utilities/config_utils.hpp>
 #include <io/utilities/time_utils.cuh>
@@ -28,7 +30,6 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
-#include <nvcomp/snappy.h>
 
 namespace cudf {
 namespace io {
@@ -1299,9 +1300,61 @@ void CompactOrcDataStreams(device_2dspan<StripeStream> strm_desc,
   gpuCompactOrcDataStreams<<<dim_grid, dim_block, 0, stream.value()>>>(strm_desc, enc_streams);
 }
 
+namespace {
+
+/**
+ * @brief Returns whether blocks compressed with `compression` are compressed with nvCOMP
+ */
+bool use_nvcomp(CompressionKind compression)
+{
+  return (compression == SNAPPY or compression == LZ4) and
+         detail::nvcomp_integration::is_stable_enabled();
+}
+
+nvcomp::compression_type to_nvcomp_compression(CompressionKind compression)
+{
+  return compression == LZ4 ? nvcomp::compression_type::LZ4 : nvcomp::compression_type::SNAPPY;
+}
+
+/**
+ * @brief Returns the stream type of the host compressor used for an ORC compression kind
+ */
+int to_host_stream_type(CompressionKind compression)
+{
+  switch (compression) {
+    case ZLIB: return IO_UNCOMP_STREAM_TYPE_INFLATE;
+    case LZ4: return IO_UNCOMP_STREAM_TYPE_LZ4;
+    case ZSTD: return IO_UNCOMP_STREAM_TYPE_ZSTD;
+    default: CUDF_FAIL("Unsupported compression type");
+  }
+}
+
+}  // namespace
+
+size_t MaxCompressedBlockSize(CompressionKind compression,
+                              std::optional<int> compression_level,
+                              uint32_t comp_blk_size)
+{
+  switch (compression) {
+    case NONE: return 0;
+    // The GPU snappy compressor shares the bound of nvCOMP
+    case SNAPPY:
+      return nvcomp::batched_compress_get_max_output_chunk_size(nvcomp::compression_type::SNAPPY,
+                                                                comp_blk_size);
+    default:
+      if (use_nvcomp(compression)) {
+        return nvcomp::batched_compress_get_max_output_chunk_size(
+          to_nvcomp_compression(compression), comp_blk_size);
+      }
+      return HostCompressor::Create(to_host_stream_type(compression), compression_level)
+        ->GetMaxCompressedSize(comp_blk_size);
+  }
+}
+
 void CompressOrcDataStreams(uint8_t* compressed_data,
                             uint32_t num_compressed_blocks,
                             CompressionKind compression,
+                            std::optional<int> compression_level,
                             uint32_t comp_blk_size,
                             uint32_t max_comp_blk_size,
                             device_2dspan<StripeStream> strm_desc,
@@ -1314,66 +1367,13 @@ void CompressOrcDataStreams(uint8_t* compressed_data,
   dim3 dim_grid(strm_desc.size().first, strm_desc.size().second);
   gpuInitCompressionBlocks<<<dim_grid, dim_block_init, 0, stream.value()>>>(
     strm_desc, enc_streams, comp_in, comp_out, compressed_data, comp_blk_size, max_comp_blk_size);
-  if (compression == SNAPPY) {
-    if (detail::nvcomp_integration::is_stable_enabled()) {
-      try {
-        size_t temp_size;
-        nvcompStatus_t nvcomp_status = nvcompBatchedSnappyCompressGetTempSize(
-          num_compressed_blocks, comp_blk_size, nvcompBatchedSnappyDefaultOpts, &temp_size);
-
-        CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
-                     "Error in getting snappy compression scratch size");
-
-        rmm::device_buffer scratch(temp_size, stream);
-        rmm::device_uvector<void const*> uncompressed_data_ptrs(num_compressed_blocks, stream);
-        rmm::device_uvector<size_t> uncompressed_data_sizes(num_compressed_blocks, stream);
-        rmm::device_uvector<void*> compressed_data_ptrs(num_compressed_blocks, stream);
-        rmm::device_uvector<size_t> compressed_bytes_written(num_compressed_blocks, stream);
-
-        auto comp_it = thrust::make_zip_iterator(uncompressed_data_ptrs.begin(),
-                                                 uncompressed_data_sizes.begin(),
-                                                 compressed_data_ptrs.begin());
-        thrust::transform(rmm::exec_policy(stream),
-                          comp_in.begin(),
-                          comp_in.end(),
-                          comp_it,
-                          [] __device__(gpu_inflate_input_s in) {
-                            return thrust::make_tuple(in.srcDevice, in.srcSize, in.dstDevice);
-                          });
-        nvcomp_status = nvcompBatchedSnappyCompressAsync(uncompressed_data_ptrs.data(),
-                                                         uncompressed_data_sizes.data(),
-                                                         max_comp_blk_size,
-                                                         num_compressed_blocks,
-                                                         scratch.data(),
-                                                         scratch.size(),
-                                                         compressed_data_ptrs.data(),
-                                                         compressed_bytes_written.data(),
-                                                         nvcompBatchedSnappyDefaultOpts,
-                                                         stream.value());
-
-        CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess, "Error in snappy compression");
-
-        thrust::transform(rmm::exec_policy(stream),
-                          compressed_bytes_written.begin(),
-                          compressed_bytes_written.end(),
-                          comp_out.begin(),
-                          [] __device__(size_t size) {
-                            gpu_inflate_status_s status{};
-                            status.bytes_written = size;
-                            return status;
-                          });
-      } catch (...) {
-        // If we reach this then there was an error in compressing so set an error status for each
-        // block
-        thrust::for_each(rmm::exec_policy(stream),
-                         comp_out.begin(),
-                         comp_out.end(),
-                         [] __device__(gpu_inflate_status_s & stat) { stat.status = 1; });
-      };
-
-    } else {
-      gpu_snap(comp_in.data(), comp_out.data(), num_compressed_blocks, stream);
-    }
+  if (use_nvcomp(compression)) {
+    nvcomp::batched_compress(
+      to_nvcomp_compression(compression), comp_in, comp_out, comp_blk_size, stream);
+  } else if (compression == SNAPPY) {
+    gpu_snap(comp_in.data(), comp_out.data(), num_compressed_blocks, stream);
+  } else {
+    host_compress(to_host_stream_type(compression), compression_level, comp_in, comp_out, stream);
   }
   dim3 dim_block_compact(1024, 1);
   gpuCompactCompressedBlocks<<<dim_grid, dim_block_compact, 0, stream.value()>>>(
@@ -19,6 +19,8 @@
 
 #include <algorithm>
 #include <fstream>
+#include <mutex>
+#include <unordered_map>
 
 namespace cudf {
 namespace io {
@@ -373,8 +375,10 @@ static int64_t get_transition_time(dst_transition_s const& trans, int year)
   return trans.time + cuda::std::chrono::duration_cast<duration_s>(duration_D{day}).count();
 }
 
-timezone_table build_timezone_transition_table(std::string const& timezone_name,
-                                               rmm::cuda_stream_view stream)
+/**
+ * @brief Parses the TZif file of a timezone and builds its transition table on the host.
+ */
+host_timezone_table parse_timezone_transition_table(std::string const& timezone_name)
 {
   if (timezone_name == "UTC" || timezone_name.empty()) {
     // Return an empty table for UTC
@@ -461,12 +465,36 @@ timezone_table build_timezone_transition_table(std::string const& timezone_name,
                         .count();
   }
 
-  rmm::device_uvector<int64_t> d_ttimes  = cudf::detail::make_device_uvector_async(ttimes, stream);
-  rmm::device_uvector<int32_t> d_offsets = cudf::detail::make_device_uvector_async(offsets, stream);
-  auto const gmt_offset                  = get_gmt_offset(ttimes, offsets, orc_utc_offset);
-  stream.synchronize();
+  auto const gmt_offset = get_gmt_offset(ttimes, offsets, orc_utc_offset);
+  return {gmt_offset, std::move(ttimes), std::move(offsets)};
+}
+
+host_timezone_table const& get_host_timezone_transition_table(std::string const& timezone_name)
+{
+  // Tables are never evicted; a process only encounters a handful of timezones
+  static std::mutex cache_mutex;
+  static std::unordered_map<std::string, host_timezone_table> cache;
+
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  auto it = cache.find(timezone_name);
+  if (it == cache.end()) {
+    // Parse errors (e.g. unknown timezones) are not cached
+    it = cache.emplace(timezone_name, parse_timezone_transition_table(timezone_name)).first;
+  }
+  // References to the elements remain valid when the map is rehashed
+  return it->second;
+}
+
+timezone_table build_timezone_transition_table(std::string const& timezone_name,
+                                               rmm::cuda_stream_view stream)
+{
+  auto const& table = get_host_timezone_transition_table(timezone_name);
+  if (table.ttimes.empty()) { return {}; }
 
-  return {gmt_offset, std::move(d_ttimes), std::move(d_offsets)};
+  // No synchronization needed, the cached host tables outlive the copies
+  return {table.gmt_offset,
+          cudf::detail::make_device_uvector_async(table.ttimes, stream),
+          cudf::detail::make_device_uvector_async(table.offsets, stream)};
 }
 
 }  // namespace io
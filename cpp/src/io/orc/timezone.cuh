@@ -124,10 +124,34 @@ class timezone_table {
   [[nodiscard]] timezone_table_view view() const { return {gmt_offset, ttimes, offsets}; }
 };
 
+/**
+ * @brief Transition table of a timezone, in host memory.
+ *
+ * Empty for timezones that don't need a conversion (e.g. UTC).
+ */
+struct host_timezone_table {
+  int32_t gmt_offset = 0;
+  std::vector<int64_t> ttimes;
+  std::vector<int32_t> offsets;
+};
+
+/**
+ * @brief Returns the transition table of the given timezone, in host memory.
+ *
+ * Uses system's TZif files. Assumes little-endian platform when parsing these files. Each timezone
+ * is only parsed once; the tables are cached for the lifetime of the process. Thread-safe.
+ *
+ * @param timezone_name standard timezone name (for example, "US/Pacific")
+ *
+ * @return The transition table for the given timezone
+ */
+host_timezone_table const& get_host_timezone_transition_table(std::string const& timezone_name);
+
 /**
  * @brief Creates a transition table to convert ORC timestamps to UTC.
  *
- * Uses system's TZif files. Assumes little-endian platform when parsing these files.
+ * Copies the cached host table of the timezone (see `get_host_timezone_transition_table`) to the
+ * device.
  *
  * @param timezone_name standard timezone name (for example, "US/Pacific")
  * @param stream CUDA stream used for device memory operations and kernel launches
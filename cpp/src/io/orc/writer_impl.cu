@@ -19,6 +19,7 @@
  * @brief cuDF-IO ORC writer class implementation
  */
 
+#include "bloom_filter.hpp"
 #include "writer_impl.hpp"
 
 #include <io/statistics/column_statistics.cuh>
@@ -28,6 +29,7 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/span.hpp>
@@ -36,8 +38,6 @@
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 
-#include <nvcomp/snappy.h>
-
 #include <algorithm>
 #include <cstring>
 #include <numeric>
@@ -74,6 +74,10 @@ orc::CompressionKind to_orc_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return orc::CompressionKind::SNAPPY;
+    case compression_type::GZIP:
+    case compression_type::ZLIB: return orc::CompressionKind::ZLIB;
+    case compression_type::LZ4: return orc::CompressionKind::LZ4;
+    case compression_type::ZSTD: return orc::CompressionKind::ZSTD;
     case compression_type::NONE: return orc::CompressionKind::NONE;
     default: CUDF_EXPECTS(false, "Unsupported compression type"); return orc::CompressionKind::NONE;
   }
@@ -137,6 +141,25 @@ constexpr auto orc_precision(cudf::type_id decimal_id)
 
 }  // namespace
 
+/**
+ * @brief Returns whether the writer builds Bloom filters for columns of the given ORC type.
+ */
+constexpr bool is_bloom_filter_supported(TypeKind kind)
+{
+  switch (kind) {
+    case TypeKind::BOOLEAN:
+    case TypeKind::BYTE:
+    case TypeKind::SHORT:
+    case TypeKind::INT:
+    case TypeKind::LONG:
+    case TypeKind::FLOAT:
+    case TypeKind::DOUBLE:
+    case TypeKind::STRING:
+    case TypeKind::DATE: return true;
+    default: return false;
+  }
+}
+
 /**
  * @brief Helper class that adds ORC-specific column info
  */
@@ -164,6 +187,11 @@ class orc_column_view {
       name{metadata.get_name()}
   {
     if (metadata.is_nullability_defined()) { nullable_from_metadata = metadata.nullable(); }
+    // Bloom filters are only built for top-level columns; other types are silently ignored
+    if (metadata.is_bloom_filter_enabled() and parent == nullptr and
+        is_bloom_filter_supported(_type_kind)) {
+      _bloom_filter_fpp = metadata.get_bloom_filter_fpp();
+    }
     if (parent != nullptr) {
       parent->add_child(_index);
       _parent_index = parent->index();
@@ -244,6 +272,7 @@ class orc_column_view {
   [[nodiscard]] auto orc_kind() const noexcept { return _type_kind; }
   [[nodiscard]] auto orc_encoding() const noexcept { return _encoding_kind; }
   [[nodiscard]] std::string_view orc_name() const noexcept { return name; }
+  [[nodiscard]] double bloom_filter_fpp() const noexcept { return _bloom_filter_fpp; }
 
  private:
   column_view cudf_column;
@@ -263,6 +292,8 @@ class orc_column_view {
   int32_t _scale     = 0;
   int32_t _precision = 0;
 
+  double _bloom_filter_fpp = 0;  // False positive probability of the Bloom filters; 0 if disabled
+
   // String dictionary-related members
   size_t _dict_stride                        = 0;
   gpu::DictionaryChunk const* dict           = nullptr;
@@ -1299,6 +1330,38 @@ void writer::impl::write_index_stream(int32_t stripe_id,
   stripe->indexLength += buffer_.size();
 }
 
+std::vector<Stream> writer::impl::write_bloom_filter_streams(
+  int32_t stripe_id,
+  host_span<orc_column_view const> columns,
+  file_segmentation const& segmentation,
+  host_span<column_bloom_filters const> bloom_filters,
+  StripeInformation* stripe)
+{
+  std::vector<Stream> bloom_filter_streams;
+  for (auto const& column : columns) {
+    auto const& filters = bloom_filters[column.index()];
+    if (filters.bitsets.empty()) { continue; }
+
+    buffer_.resize((compression_kind_ != NONE) ? 3 : 0);
+    ProtobufWriter pbw(&buffer_);
+    auto const& rowgroups_range = segmentation.stripes[stripe_id];
+    std::for_each(rowgroups_range.cbegin(), rowgroups_range.cend(), [&](auto rowgroup) {
+      pbw.put_bloom_filter(
+        filters.num_hash_functions,
+        host_span<uint64_t const>{
+          filters.bitsets.data() + static_cast<size_t>(rowgroup) * filters.num_words,
+          filters.num_words});
+    });
+    // Filters of large stripes may not fit in a single compression block
+    add_uncompressed_block_headers(buffer_);
+
+    bloom_filter_streams.push_back({BLOOM_FILTER_UTF8, column.id(), buffer_.size()});
+    out_sink_->host_write(buffer_.data(), buffer_.size());
+    stripe->indexLength += buffer_.size();
+  }
+  return bloom_filter_streams;
+}
+
 std::future<void> writer::impl::write_data_stream(gpu::StripeStream const& strm_desc,
                                                   gpu::encoder_chunk_streams const& enc_stream,
                                                   uint8_t const* compressed_data,
@@ -1361,6 +1424,7 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
     max_stripe_size{options.get_stripe_size_bytes(), options.get_stripe_size_rows()},
     row_index_stride{options.get_row_index_stride()},
     compression_kind_(to_orc_compression(options.get_compression())),
+    compression_level_(options.get_compression_level()),
     stats_freq_(options.get_statistics_freq()),
     single_write_mode(mode == SingleWriteMode::YES),
     kv_meta(options.get_key_value_metadata()),
@@ -1382,6 +1446,7 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
     max_stripe_size{options.get_stripe_size_bytes(), options.get_stripe_size_rows()},
     row_index_stride{options.get_row_index_stride()},
     compression_kind_(to_orc_compression(options.get_compression())),
+    compression_level_(options.get_compression_level()),
     stats_freq_(options.get_statistics_freq()),
     single_write_mode(mode == SingleWriteMode::YES),
     kv_meta(options.get_key_value_metadata()),
@@ -1686,6 +1751,84 @@ hostdevice_2dvector<rowgroup_rows> calculate_rowgroup_bounds(orc_table_view cons
   return rowgroup_bounds;
 }
 
+/**
+ * @brief Hashes a (valid) element of a column the way ORC Bloom filters hash the values of the
+ * column's ORC type.
+ */
+__device__ uint64_t bloom_filter_hash(column_device_view const& col, size_type row)
+{
+  switch (col.type().id()) {
+    case type_id::BOOL8: return bloom_filter_long_hash(col.element<bool>(row) ? 1 : 0);
+    case type_id::INT8: return bloom_filter_long_hash(col.element<int8_t>(row));
+    case type_id::INT16: return bloom_filter_long_hash(col.element<int16_t>(row));
+    case type_id::INT32: return bloom_filter_long_hash(col.element<int32_t>(row));
+    case type_id::INT64: return bloom_filter_long_hash(col.element<int64_t>(row));
+    // Float values are widened to double
+    case type_id::FLOAT32: return bloom_filter_double_hash(col.element<float>(row));
+    case type_id::FLOAT64: return bloom_filter_double_hash(col.element<double>(row));
+    case type_id::TIMESTAMP_DAYS:
+      return bloom_filter_long_hash(col.element<cudf::timestamp_D>(row).time_since_epoch().count());
+    case type_id::STRING: {
+      auto const str = col.element<string_view>(row);
+      return murmur3_hash64(reinterpret_cast<uint8_t const*>(str.data()), str.size_bytes());
+    }
+    default: cudf_assert(false && "Unsupported type for Bloom filters"); return 0;
+  }
+}
+
+/**
+ * @brief Builds the Bloom filters of each rowgroup, for the columns that have them enabled.
+ *
+ * @param orc_table Table to encode
+ * @param row_index_stride Number of rows in a rowgroup
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Bloom filters of each column; empty for the columns without filters
+ */
+std::vector<column_bloom_filters> build_rowgroup_bloom_filters(orc_table_view const& orc_table,
+                                                               size_type row_index_stride,
+                                                               rmm::cuda_stream_view stream)
+{
+  auto const num_rowgroups =
+    cudf::util::div_rounding_up_unsafe<size_t, size_t>(orc_table.num_rows(), row_index_stride);
+
+  std::vector<column_bloom_filters> bloom_filters(orc_table.num_columns());
+  for (auto const& column : orc_table.columns) {
+    if (column.bloom_filter_fpp() == 0) { continue; }
+
+    // Sized for full rowgroups, like other writers do, so that readers can merge the filters
+    auto& filters     = bloom_filters[column.index()];
+    filters.num_words = bloom_filter_num_words(row_index_stride, column.bloom_filter_fpp());
+    filters.num_hash_functions =
+      bloom_filter_num_hash_functions(row_index_stride, filters.num_words);
+
+    auto d_bitsets = cudf::detail::make_zeroed_device_uvector_async<uint64_t>(
+      num_rowgroups * filters.num_words, stream);
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      column.size(),
+      [d_cols             = device_span<orc_column_device_view const>{orc_table.d_columns},
+       col_idx            = column.index(),
+       bitsets            = d_bitsets.data(),
+       num_words          = filters.num_words,
+       num_hash_functions = filters.num_hash_functions,
+       row_index_stride] __device__(size_type row) {
+        auto const& col = d_cols[col_idx];
+        if (col.is_null(row)) { return; }
+
+        auto const hash     = bloom_filter_hash(col, row);
+        auto const num_bits = num_words * 64;
+        auto* const bitset  = bitsets + static_cast<size_t>(row / row_index_stride) * num_words;
+        for (uint32_t i = 1; i <= num_hash_functions; ++i) {
+          auto const bit = bloom_filter_bit(hash, i, num_bits);
+          atomicOr(reinterpret_cast<unsigned long long*>(bitset + bit / 64), 1ull << (bit % 64));
+        }
+      });
+    filters.bitsets = cudf::detail::make_std_vector_sync(d_bitsets, stream);
+  }
+  return bloom_filters;
+}
+
 // returns host vector of per-rowgroup sizes
 encoder_decimal_info decimal_chunk_sizes(orc_table_view& orc_table,
                                          file_segmentation const& segmentation,
@@ -1905,11 +2048,8 @@ void writer::impl::write(table_view const& table)
     // Allocate intermediate output stream buffer
     size_t compressed_bfr_size       = 0;
     size_t num_compressed_blocks     = 0;
-    size_t max_compressed_block_size = 0;
-    if (compression_kind_ != NONE) {
-      nvcompBatchedSnappyCompressGetMaxOutputChunkSize(
-        compression_blocksize_, nvcompBatchedSnappyDefaultOpts, &max_compressed_block_size);
-    }
+    auto const max_compressed_block_size =
+      gpu::MaxCompressedBlockSize(compression_kind_, compression_level_, compression_blocksize_);
     auto stream_output = [&]() {
       size_t max_stream_size = 0;
       bool all_device_write  = true;
@@ -1951,6 +2091,7 @@ void writer::impl::write(table_view const& table)
       gpu::CompressOrcDataStreams(static_cast<uint8_t*>(compressed_data.data()),
                                   num_compressed_blocks,
                                   compression_kind_,
+                                  compression_level_,
                                   compression_blocksize_,
                                   max_compressed_block_size,
                                   strm_descs,
@@ -1966,6 +2107,8 @@ void writer::impl::write(table_view const& table)
 
     auto const statistics = gather_statistic_blobs(stats_freq_, orc_table, segmentation);
 
+    auto const bloom_filters = build_rowgroup_bloom_filters(orc_table, row_index_stride, stream);
+
     // Write stripes
     std::vector<std::future<void>> write_tasks;
     for (size_t stripe_id = 0; stripe_id < stripes.size(); ++stripe_id) {
@@ -1987,6 +2130,8 @@ void writer::impl::write(table_view const& table)
                            &streams,
                            &pbw_);
       }
+      auto const bloom_filter_streams = write_bloom_filter_streams(
+        stripe_id, orc_table.columns, segmentation, bloom_filters, &stripe);
 
       // Column data consisting one or more separate streams
       for (auto const& strm_desc : strm_descs[stripe_id]) {
@@ -2002,6 +2147,10 @@ void writer::impl::write(table_view const& table)
       // Write stripefooter consisting of stream information
       StripeFooter sf;
       sf.streams = streams;
+      // Bloom filter streams are index streams too, and precede all the data streams
+      sf.streams.insert(sf.streams.begin() + num_index_streams,
+                        bloom_filter_streams.cbegin(),
+                        bloom_filter_streams.cend());
       sf.columns.resize(orc_table.num_columns() + 1);
       sf.columns[0].kind = DIRECT;
       for (size_t i = 1; i < sf.columns.size(); ++i) {
@@ -34,6 +34,7 @@
 #include <thrust/iterator/counting_iterator.h>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -98,6 +99,15 @@ struct encoder_decimal_info {
   std::map<uint32_t, std::vector<uint32_t>> rg_sizes;  ///< Column index -> per-rowgroup size map
 };
 
+/**
+ * @brief Bloom filters of a column, one per rowgroup.
+ */
+struct column_bloom_filters {
+  uint32_t num_hash_functions = 0;
+  uint32_t num_words          = 0;  ///< Number of 64-bit words in each filter
+  std::vector<uint64_t> bitsets;    ///< Filters of all rowgroups; empty if filters are disabled
+};
+
 /**
  * @brief List of per-column ORC streams.
  *
@@ -330,6 +340,23 @@ class writer::impl {
                           orc_streams* streams,
                           ProtobufWriter* pbw);
 
+  /**
+   * @brief Writes the Bloom filter streams of a stripe, for the columns that have filters.
+   *
+   * @param[in] stripe_id Stripe's identifier
+   * @param[in] columns List of columns
+   * @param[in] segmentation stripe and rowgroup ranges
+   * @param[in] bloom_filters Bloom filters of each column, for all rowgroups
+   * @param[in,out] stripe Stream's parent stripe
+   * @return The written `BLOOM_FILTER_UTF8` streams, in column order
+   */
+  std::vector<Stream> write_bloom_filter_streams(
+    int32_t stripe_id,
+    host_span<orc_column_view const> columns,
+    file_segmentation const& segmentation,
+    host_span<column_bloom_filters const> bloom_filters,
+    StripeInformation* stripe);
+
   /**
    * @brief Write the specified column's data streams
    *
@@ -364,6 +391,7 @@ class writer::impl {
   size_type row_index_stride;
   size_t compression_blocksize_     = DEFAULT_COMPRESSION_BLOCKSIZE;
   CompressionKind compression_kind_ = CompressionKind::NONE;
+  std::optional<int> compression_level_;
 
   bool enable_dictionary_     = true;
   statistics_freq stats_freq_ = ORC_STATISTICS_ROW_GROUP;
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/parquet/bloom_filter.hpp>
+#include <io/parquet/parquet_gpu.hpp>
+
+#include <cudf/strings/string_view.cuh>
+
+namespace cudf {
+namespace io {
+namespace parquet {
+namespace gpu {
+
+/**
+ * @brief Hashes the plain encoding of a value, as written by the page encoder
+ */
+inline __device__ uint64_t hash_plain_value(parquet_column_device_view const& col,
+                                            column_device_view const& data_col,
+                                            size_type val_idx)
+{
+  auto hash_bytes = [](auto const& v) {
+    return xxhash64(reinterpret_cast<uint8_t const*>(&v), sizeof(v));
+  };
+  switch (col.physical_type) {
+    case INT32:
+    case FLOAT: {
+      int32_t v;
+      switch (int32_logical_len(data_col.type().id())) {
+        case 1: v = data_col.element<int8_t>(val_idx); break;
+        case 2: v = data_col.element<int16_t>(val_idx); break;
+        default: v = data_col.element<int32_t>(val_idx); break;
+      }
+      return hash_bytes(v);
+    }
+    case INT64: {
+      int64_t v = data_col.element<int64_t>(val_idx);
+      if (col.ts_scale < 0) {
+        v /= -col.ts_scale;
+      } else if (col.ts_scale > 0) {
+        v *= col.ts_scale;
+      }
+      return hash_bytes(v);
+    }
+    case DOUBLE: return hash_bytes(data_col.element<double>(val_idx));
+    case BYTE_ARRAY: {
+      auto const str = data_col.element<string_view>(val_idx);
+      return xxhash64(reinterpret_cast<uint8_t const*>(str.data()), str.size_bytes());
+    }
+    default: cudf_assert(false && "Unsupported type for Bloom filters"); return 0;
+  }
+}
+
+template <int block_size>
+__global__ void __launch_bounds__(block_size)
+  populate_chunk_bloom_filters_kernel(cudf::detail::device_2dspan<EncColumnChunk> chunks,
+                                      cudf::detail::device_2dspan<gpu::PageFragment const> frags)
+{
+  auto col_idx = blockIdx.y;
+  auto block_x = blockIdx.x;
+  auto t       = threadIdx.x;
+  auto frag    = frags[col_idx][block_x];
+  auto chunk   = frag.chunk;
+  auto col     = chunk->col_desc;
+
+  if (chunk->bloom_filter == nullptr) { return; }
+
+  size_type start_row = frag.start_row;
+  size_type end_row   = frag.start_row + frag.num_rows;
+
+  __shared__ size_type s_start_value_idx;
+  __shared__ size_type s_num_values;
+
+  if (t == 0) {
+    // Find the bounds of values in leaf column to be inserted into the filter for current chunk
+    auto cudf_col      = *(col->parent_column);
+    s_start_value_idx  = row_to_value_idx(start_row, cudf_col);
+    auto end_value_idx = row_to_value_idx(end_row, cudf_col);
+    s_num_values       = end_value_idx - s_start_value_idx;
+  }
+  __syncthreads();
+
+  column_device_view const& data_col = *col->leaf_column;
+  auto const num_blocks              = chunk->bloom_filter_size / bloom_filter_block_size;
+
+  for (size_type i = t; i < s_num_values; i += block_size) {
+    auto const val_idx = s_start_value_idx + i;
+    if (val_idx >= data_col.size() or not data_col.is_valid(val_idx)) { continue; }
+
+    auto const hash  = hash_plain_value(*col, data_col, val_idx);
+    auto const block = chunk->bloom_filter + bloom_filter_block_index(hash, num_blocks) *
+                                               bloom_filter_words_in_block;
+    for (uint32_t w = 0; w < bloom_filter_words_in_block; ++w) {
+      atomicOr(block + w, bloom_filter_word_mask(hash, w));
+    }
+  }
+}
+
+void populate_chunk_bloom_filters(cudf::detail::device_2dspan<EncColumnChunk> chunks,
+                                  cudf::detail::device_2dspan<gpu::PageFragment const> frags,
+                                  rmm::cuda_stream_view stream)
+{
+  constexpr int block_size = 256;
+  dim3 const dim_grid(frags.size().second, frags.size().first);
+
+  populate_chunk_bloom_filters_kernel<block_size>
+    <<<dim_grid, block_size, 0, stream.value()>>>(chunks, frags);
+}
+
+}  // namespace gpu
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
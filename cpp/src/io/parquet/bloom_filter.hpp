@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file bloom_filter.hpp
+ * @brief Parquet split-block Bloom filter primitives, shared by the writer kernels and the reader
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace cudf {
+namespace io {
+namespace parquet {
+
+constexpr uint32_t bloom_filter_block_size     = 32;  //!< Bytes in a filter block (8 words)
+constexpr uint32_t bloom_filter_min_size       = bloom_filter_block_size;
+constexpr uint32_t bloom_filter_max_size       = 1024 * 1024;
+constexpr double bloom_filter_default_fpp      = 0.01;
+constexpr uint32_t bloom_filter_words_in_block = bloom_filter_block_size / sizeof(uint32_t);
+
+constexpr uint64_t xxhash_prime1 = 0x9E3779B185EBCA87ull;
+constexpr uint64_t xxhash_prime2 = 0xC2B2AE3D27D4EB4Full;
+constexpr uint64_t xxhash_prime3 = 0x165667B19E3779F9ull;
+constexpr uint64_t xxhash_prime4 = 0x85EBCA77C2B2AE63ull;
+constexpr uint64_t xxhash_prime5 = 0x27D4EB2F165667C5ull;
+
+CUDF_HOST_DEVICE inline uint64_t xxhash_rotl64(uint64_t x, int r)
+{
+  return (x << r) | (x >> (64 - r));
+}
+
+CUDF_HOST_DEVICE inline uint64_t load_le64(uint8_t const* p)
+{
+  uint64_t v = 0;
+  for (int i = 7; i >= 0; --i) {
+    v = (v << 8) | p[i];
+  }
+  return v;
+}
+
+CUDF_HOST_DEVICE inline uint32_t load_le32(uint8_t const* p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+CUDF_HOST_DEVICE inline uint64_t xxhash_round(uint64_t acc, uint64_t input)
+{
+  acc += input * xxhash_prime2;
+  return xxhash_rotl64(acc, 31) * xxhash_prime1;
+}
+
+CUDF_HOST_DEVICE inline uint64_t xxhash_merge(uint64_t acc, uint64_t val)
+{
+  acc ^= xxhash_round(0, val);
+  return acc * xxhash_prime1 + xxhash_prime4;
+}
+
+/**
+ * @brief Computes the 64-bit xxHash (XXH64, seed 0) of a byte sequence
+ *
+ * This is the hash function of Parquet Bloom filters, applied to the plain encoding of the value
+ * (without the length prefix for byte arrays).
+ */
+CUDF_HOST_DEVICE inline uint64_t xxhash64(uint8_t const* data, size_t len)
+{
+  uint8_t const* p         = data;
+  uint8_t const* const end = data + len;
+  uint64_t h;
+  if (len >= 32) {
+    uint64_t v1 = xxhash_prime1 + xxhash_prime2;
+    uint64_t v2 = xxhash_prime2;
+    uint64_t v3 = 0;
+    uint64_t v4 = 0 - xxhash_prime1;
+    for (; p + 32 <= end; p += 32) {
+      v1 = xxhash_round(v1, load_le64(p));
+      v2 = xxhash_round(v2, load_le64(p + 8));
+      v3 = xxhash_round(v3, load_le64(p + 16));
+      v4 = xxhash_round(v4, load_le64(p + 24));
+    }
+    h = xxhash_rotl64(v1, 1) + xxhash_rotl64(v2, 7) + xxhash_rotl64(v3, 12) +
+        xxhash_rotl64(v4, 18);
+    h = xxhash_merge(h, v1);
+    h = xxhash_merge(h, v2);
+    h = xxhash_merge(h, v3);
+    h = xxhash_merge(h, v4);
+  } else {
+    h = xxhash_prime5;
+  }
+  h += len;
+  for (; p + 8 <= end; p += 8) {
+    h ^= xxhash_round(0, load_le64(p));
+    h = xxhash_rotl64(h, 27) * xxhash_prime1 + xxhash_prime4;
+  }
+  if (p + 4 <= end) {
+    h ^= load_le32(p) * xxhash_prime1;
+    h = xxhash_rotl64(h, 23) * xxhash_prime2 + xxhash_prime3;
+    p += 4;
+  }
+  for (; p < end; ++p) {
+    h ^= (*p) * xxhash_prime5;
+    h = xxhash_rotl64(h, 11) * xxhash_prime1;
+  }
+  h ^= h >> 33;
+  h *= xxhash_prime2;
+  h ^= h >> 29;
+  h *= xxhash_prime3;
+  h ^= h >> 32;
+  return h;
+}
+
+/**
+ * @brief Returns the index of the filter block that holds the bits of a hash
+ */
+CUDF_HOST_DEVICE inline uint32_t bloom_filter_block_index(uint64_t hash, uint32_t num_blocks)
+{
+  return static_cast<uint32_t>(((hash >> 32) * num_blocks) >> 32);
+}
+
+/**
+ * @brief Returns the bit set by a hash in word `i` of its filter block
+ */
+CUDF_HOST_DEVICE inline uint32_t bloom_filter_word_mask(uint64_t hash, uint32_t i)
+{
+  constexpr uint32_t salt[bloom_filter_words_in_block] = {0x47b6137bu,
+                                                          0x44974d91u,
+                                                          0x8824ad5bu,
+                                                          0xa2b7289du,
+                                                          0x705495c7u,
+                                                          0x2df1424bu,
+                                                          0x9efc4947u,
+                                                          0x5c6bfb31u};
+  return 1u << ((static_cast<uint32_t>(hash) * salt[i]) >> 27);
+}
+
+/**
+ * @brief Returns the size of a filter for `num_distinct` values and the given false positive
+ * probability, in bytes
+ *
+ * The size is a power of two between `bloom_filter_min_size` and `bloom_filter_max_size`.
+ */
+inline uint32_t bloom_filter_size(int64_t num_distinct, double fpp)
+{
+  auto const num_values = static_cast<double>(std::max<int64_t>(num_distinct, 1));
+  auto const num_bits   = -8.0 * num_values / std::log1p(-std::pow(fpp, 1.0 / 8));
+  uint32_t size         = bloom_filter_min_size;
+  while (size < bloom_filter_max_size && size * 8.0 < num_bits) {
+    size *= 2;
+  }
+  return size;
+}
+
+/**
+ * @brief Returns whether a filter bitset may contain a value with the given hash
+ *
+ * @param bitset Filter bitset; its size is a multiple of `bloom_filter_block_size`
+ * @param size Size of the bitset, in bytes
+ * @param hash xxHash of the plain-encoded value
+ *
+ * @return `false` if the value is definitely not in the set
+ */
+inline bool bloom_filter_may_contain(uint8_t const* bitset, size_t size, uint64_t hash)
+{
+  auto const num_blocks = static_cast<uint32_t>(size / bloom_filter_block_size);
+  if (num_blocks == 0) { return true; }
+  auto const block = bitset + bloom_filter_block_index(hash, num_blocks) * bloom_filter_block_size;
+  for (uint32_t i = 0; i < bloom_filter_words_in_block; ++i) {
+    auto const mask = bloom_filter_word_mask(hash, i);
+    if ((load_le32(block + i * sizeof(uint32_t)) & mask) == 0) { return false; }
+  }
+  return true;
+}
+
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
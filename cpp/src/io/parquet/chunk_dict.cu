@@ -92,6 +92,112 @@ struct map_find_fn {
   }
 };
 
+struct map_hash_fn {
+  template <typename T>
+  __device__ uint32_t operator()(column_device_view const& col, size_type i)
+  {
+    if constexpr (column_device_view::has_element_accessor<T>()) {
+      return hash_functor<T>{col}(i);
+    } else {
+      cudf_assert(false && "Unsupported type to hash");
+    }
+    return 0;
+  }
+};
+
+template <int block_size>
+__global__ void __launch_bounds__(block_size)
+  populate_chunk_cardinality_sketches_kernel(
+    cudf::detail::device_2dspan<EncColumnChunk> chunks,
+    cudf::detail::device_2dspan<gpu::PageFragment const> frags)
+{
+  auto col_idx = blockIdx.y;
+  auto block_x = blockIdx.x;
+  auto t       = threadIdx.x;
+  auto frag    = frags[col_idx][block_x];
+  auto chunk   = frag.chunk;
+  auto col     = chunk->col_desc;
+
+  if (chunk->hll_sketch == nullptr) { return; }
+
+  size_type start_row = frag.start_row;
+  size_type end_row   = frag.start_row + frag.num_rows;
+
+  __shared__ size_type s_start_value_idx;
+  __shared__ size_type s_num_values;
+  __shared__ uint32_t s_registers[CARDINALITY_SKETCH_SIZE];
+
+  for (size_type i = t; i < CARDINALITY_SKETCH_SIZE; i += block_size) {
+    s_registers[i] = 0;
+  }
+  if (t == 0) {
+    // Find the bounds of values in leaf column to be inserted into the sketch for current chunk
+    auto cudf_col      = *(col->parent_column);
+    s_start_value_idx  = row_to_value_idx(start_row, cudf_col);
+    auto end_value_idx = row_to_value_idx(end_row, cudf_col);
+    s_num_values       = end_value_idx - s_start_value_idx;
+  }
+  __syncthreads();
+
+  column_device_view const& data_col = *col->leaf_column;
+
+  for (size_type i = t; i < s_num_values; i += block_size) {
+    auto const val_idx = s_start_value_idx + i;
+    if (val_idx >= data_col.size() or not data_col.is_valid(val_idx)) { continue; }
+
+    uint32_t const hash = type_dispatcher(data_col.type(), map_hash_fn{}, data_col, val_idx);
+    // The leading bits select the register, which keeps the maximum position of the first set bit
+    // in the remaining bits
+    uint32_t const reg  = hash >> (32 - CARDINALITY_SKETCH_BITS);
+    uint32_t const rank = min(__clz(static_cast<int>(hash << CARDINALITY_SKETCH_BITS)) + 1,
+                              32 - CARDINALITY_SKETCH_BITS + 1);
+    atomicMax(&s_registers[reg], rank);
+  }
+  __syncthreads();
+
+  // Merge the fragment sketch into the chunk sketch
+  for (size_type i = t; i < CARDINALITY_SKETCH_SIZE; i += block_size) {
+    if (s_registers[i] != 0) { atomicMax(chunk->hll_sketch + i, s_registers[i]); }
+  }
+}
+
+template <int block_size>
+__global__ void __launch_bounds__(block_size)
+  estimate_chunk_cardinalities_kernel(device_span<EncColumnChunk> chunks)
+{
+  auto& chunk = chunks[blockIdx.x];
+  if (chunk.hll_sketch == nullptr) { return; }
+
+  auto t = threadIdx.x;
+
+  double sum          = 0;
+  size_type num_zeros = 0;
+  for (size_type i = t; i < CARDINALITY_SKETCH_SIZE; i += block_size) {
+    auto const reg = chunk.hll_sketch[i];
+    sum += ldexp(1.0, -static_cast<int>(reg));
+    num_zeros += (reg == 0);
+  }
+
+  using sum_reduce   = cub::BlockReduce<double, block_size>;
+  using count_reduce = cub::BlockReduce<size_type, block_size>;
+  __shared__ union {
+    typename sum_reduce::TempStorage sum;
+    typename count_reduce::TempStorage count;
+  } temp_storage;
+  sum = sum_reduce(temp_storage.sum).Sum(sum);
+  __syncthreads();
+  num_zeros = count_reduce(temp_storage.count).Sum(num_zeros);
+
+  if (t == 0) {
+    constexpr double m     = CARDINALITY_SKETCH_SIZE;
+    constexpr double alpha = 0.7213 / (1 + 1.079 / m);
+    auto estimate          = alpha * m * m / sum;
+    // Linear counting is more accurate while many registers are still empty
+    if (estimate <= 2.5 * m and num_zeros != 0) { estimate = m * log(m / num_zeros); }
+    chunk.est_dict_entries = min(static_cast<size_type>(llround(estimate)), chunk.num_values);
+  }
+}
+
 template <int block_size>
 __global__ void __launch_bounds__(block_size, 1)
   populate_chunk_hash_maps_kernel(cudf::detail::device_2dspan<EncColumnChunk> chunks,
@@ -278,6 +384,24 @@ void initialize_chunk_hash_maps(device_span<EncColumnChunk> chunks, rmm::cuda_st
     <<<chunks.size(), block_size, 0, stream.value()>>>(chunks);
 }
 
+void populate_chunk_cardinality_sketches(cudf::detail::device_2dspan<EncColumnChunk> chunks,
+                                         cudf::detail::device_2dspan<gpu::PageFragment const> frags,
+                                         rmm::cuda_stream_view stream)
+{
+  constexpr int block_size = 256;
+  dim3 const dim_grid(frags.size().second, frags.size().first);
+
+  populate_chunk_cardinality_sketches_kernel<block_size>
+    <<<dim_grid, block_size, 0, stream.value()>>>(chunks, frags);
+}
+
+void estimate_chunk_cardinalities(device_span<EncColumnChunk> chunks, rmm::cuda_stream_view stream)
+{
+  constexpr int block_size = 256;
+  estimate_chunk_cardinalities_kernel<block_size>
+    <<<chunks.size(), block_size, 0, stream.value()>>>(chunks);
+}
+
 void populate_chunk_hash_maps(cudf::detail::device_2dspan<EncColumnChunk> chunks,
                               cudf::detail::device_2dspan<gpu::PageFragment const> frags,
                               rmm::cuda_stream_view stream)
@@ -117,6 +117,66 @@ size_t CompactProtocolWriter::write(const ColumnChunkMetaData& s)
   if (s.index_page_offset != 0) { c.field_int(10, s.index_page_offset); }
   if (s.dictionary_page_offset != 0) { c.field_int(11, s.dictionary_page_offset); }
   if (s.statistics_blob.size() != 0) { c.field_struct_blob(12, s.statistics_blob); }
+  if (s.bloom_filter_offset != 0) { c.field_int(14, s.bloom_filter_offset); }
+  if (s.bloom_filter_length != 0) { c.field_int(15, s.bloom_filter_length); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const PageLocation& p)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_int(1, p.offset);
+  c.field_int(2, p.compressed_page_size);
+  c.field_int(3, p.first_row_index);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const OffsetIndex& o)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_struct_list(1, o.page_locations);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const ColumnIndex& s)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_bool_list(1, s.null_pages);
+  c.field_string_list(2, s.min_values);
+  c.field_string_list(3, s.max_values);
+  c.field_int(4, static_cast<int32_t>(s.boundary_order));
+  if (s.null_counts.size() != 0) { c.field_int64_list(5, s.null_counts); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterAlgorithm& a)
+{
+  CompactProtocolFieldWriter c(*this);
+  if (a.isset.BLOCK) { c.field_empty_struct(1); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterHash& h)
+{
+  CompactProtocolFieldWriter c(*this);
+  if (h.isset.XXHASH) { c.field_empty_struct(1); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterCompression& s)
+{
+  CompactProtocolFieldWriter c(*this);
+  if (s.isset.UNCOMPRESSED) { c.field_empty_struct(1); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterHeader& b)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_int(1, b.num_bytes);
+  c.field_struct(2, b.algorithm);
+  c.field_struct(3, b.hash);
+  c.field_struct(4, b.compression);
   return c.value();
 }
 
@@ -182,6 +242,28 @@ inline void CompactProtocolFieldWriter::field_int_list(int field, const std::vec
   current_field_value = field;
 }
 
+inline void CompactProtocolFieldWriter::field_int64_list(int field, const std::vector<int64_t>& val)
+{
+  put_field_header(field, current_field_value, ST_FLD_LIST);
+  put_byte((uint8_t)((std::min(val.size(), (size_t)0xfu) << 4) | ST_FLD_I64));
+  if (val.size() >= 0xf) put_uint(val.size());
+  for (auto v : val) {
+    put_int(v);
+  }
+  current_field_value = field;
+}
+
+inline void CompactProtocolFieldWriter::field_bool_list(int field, const std::vector<bool>& val)
+{
+  put_field_header(field, current_field_value, ST_FLD_LIST);
+  put_byte((uint8_t)((std::min(val.size(), (size_t)0xfu) << 4) | ST_FLD_TRUE));
+  if (val.size() >= 0xf) put_uint(val.size());
+  for (auto v : val) {
+    put_byte(v ? ST_FLD_TRUE : ST_FLD_FALSE);
+  }
+  current_field_value = field;
+}
+
 template <typename T>
 inline void CompactProtocolFieldWriter::field_struct(int field, const T& val)
 {
@@ -202,6 +284,13 @@ inline void CompactProtocolFieldWriter::field_struct_list(int field, const std::
   current_field_value = field;
 }
 
+inline void CompactProtocolFieldWriter::field_empty_struct(int field)
+{
+  put_field_header(field, current_field_value, ST_FLD_STRUCT);
+  put_byte(0);  // struct end
+  current_field_value = field;
+}
+
 inline size_t CompactProtocolFieldWriter::value()
 {
   put_byte(0);
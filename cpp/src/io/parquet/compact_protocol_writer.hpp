@@ -44,6 +44,13 @@ class CompactProtocolWriter {
   size_t write(const KeyValue&);
   size_t write(const ColumnChunk&);
   size_t write(const ColumnChunkMetaData&);
+  size_t write(const PageLocation&);
+  size_t write(const OffsetIndex&);
+  size_t write(const ColumnIndex&);
+  size_t write(const BloomFilterAlgorithm&);
+  size_t write(const BloomFilterHash&);
+  size_t write(const BloomFilterCompression&);
+  size_t write(const BloomFilterHeader&);
 
  protected:
   std::vector<uint8_t>& m_buf;
@@ -78,9 +85,15 @@ class CompactProtocolFieldWriter {
   template <typename Enum>
   inline void field_int_list(int field, const std::vector<Enum>& val);
 
+  inline void field_int64_list(int field, const std::vector<int64_t>& val);
+
+  inline void field_bool_list(int field, const std::vector<bool>& val);
+
   template <typename T>
   inline void field_struct(int field, const T& val);
 
+  inline void field_empty_struct(int field);
+
   template <typename T>
   inline void field_struct_list(int field, const std::vector<T>& val);
 
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "footer_cache.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace parquet {
+
+footer_cache& footer_cache::instance()
+{
+  static footer_cache cache;
+  return cache;
+}
+
+void footer_cache::set_capacity(size_t capacity_bytes)
+{
+  std::scoped_lock lock(_mutex);
+  _capacity = capacity_bytes;
+  evict_to(_capacity);
+}
+
+bool footer_cache::is_enabled() const
+{
+  std::scoped_lock lock(_mutex);
+  return _capacity != 0;
+}
+
+std::shared_ptr<FileMetaData const> footer_cache::find(file_identity const& key)
+{
+  std::scoped_lock lock(_mutex);
+  auto const it = _entries.find(key);
+  if (it == _entries.end()) {
+    ++_misses;
+    return nullptr;
+  }
+  ++_hits;
+  // Move the entry to the front of the LRU list
+  _lru.splice(_lru.begin(), _lru, it->second);
+  return it->second->metadata;
+}
+
+void footer_cache::insert(file_identity const& key,
+                          std::shared_ptr<FileMetaData const> metadata,
+                          size_t footer_size)
+{
+  std::scoped_lock lock(_mutex);
+  if (footer_size > _capacity) { return; }
+
+  auto const it = _entries.find(key);
+  if (it != _entries.end()) {
+    // Another reader inserted the same file concurrently
+    _lru.splice(_lru.begin(), _lru, it->second);
+    return;
+  }
+
+  evict_to(_capacity - footer_size);
+  _lru.push_front({key, std::move(metadata), footer_size});
+  _entries.emplace(key, _lru.begin());
+  _size += footer_size;
+}
+
+void footer_cache::clear()
+{
+  std::scoped_lock lock(_mutex);
+  evict_to(0);
+}
+
+parquet_footer_cache_statistics footer_cache::statistics() const
+{
+  std::scoped_lock lock(_mutex);
+  return {_hits, _misses, _entries.size(), _size};
+}
+
+void footer_cache::evict_to(size_t capacity_bytes)
+{
+  while (_size > capacity_bytes) {
+    auto const& victim = _lru.back();
+    _size -= victim.size;
+    _entries.erase(victim.key);
+    _lru.pop_back();
+  }
+}
+
+FileMetaData read_footer(datasource* source)
+{
+  using namespace cudf::io::parquet;
+
+  auto& cache        = footer_cache::instance();
+  auto const file_id = cache.is_enabled() ? get_file_identity(*source) : std::nullopt;
+  if (file_id.has_value()) {
+    if (auto const cached = cache.find(file_id.value()); cached != nullptr) { return *cached; }
+  }
+
+  constexpr auto header_len = sizeof(file_header_s);
+  constexpr auto ender_len  = sizeof(file_ender_s);
+
+  const auto len = source->size();
+  CUDF_EXPECTS(len > header_len + ender_len, "Incorrect data source");
+  const auto header_buffer = source->host_read(0, header_len);
+  const auto header        = reinterpret_cast<const file_header_s*>(header_buffer->data());
+  const auto ender_buffer  = source->host_read(len - ender_len, ender_len);
+  const auto ender         = reinterpret_cast<const file_ender_s*>(ender_buffer->data());
+  CUDF_EXPECTS(header->magic == parquet_magic && ender->magic == parquet_magic,
+               "Corrupted header or footer");
+  CUDF_EXPECTS(ender->footer_len != 0 && ender->footer_len <= (len - header_len - ender_len),
+               "Incorrect footer length");
+
+  FileMetaData metadata;
+  const auto buffer = source->host_read(len - ender->footer_len - ender_len, ender->footer_len);
+  CompactProtocolReader cp(buffer->data(), ender->footer_len);
+  CUDF_EXPECTS(cp.read(&metadata), "Cannot parse metadata");
+  CUDF_EXPECTS(cp.InitSchema(&metadata), "Cannot initialize schema");
+
+  if (file_id.has_value()) {
+    cache.insert(
+      file_id.value(), std::make_shared<FileMetaData const>(metadata), ender->footer_len);
+  }
+  return metadata;
+}
+
+}  // namespace parquet
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file footer_cache.hpp
+ * @brief Process-wide cache of parsed Parquet file footers
+ */
+
+#pragma once
+
+#include "parquet.hpp"
+
+#include <io/utilities/file_io_utilities.hpp>
+
+#include <cudf/io/parquet.hpp>
+
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace parquet {
+using FileMetaData = cudf::io::parquet::FileMetaData;
+
+/**
+ * @brief Size-bounded LRU cache of parsed `FileMetaData`, keyed on the file identity.
+ *
+ * The cache is disabled (zero capacity) until `set_capacity` is called with a non-zero size. The
+ * size of an entry is accounted as the size of its serialized footer.
+ */
+class footer_cache {
+ public:
+  /**
+   * @brief Returns the process-wide cache instance.
+   */
+  static footer_cache& instance();
+
+  /**
+   * @brief Sets the maximum total size of the cached footers, evicting entries as needed.
+   *
+   * @param capacity_bytes Maximum total size; zero disables and clears the cache
+   */
+  void set_capacity(size_t capacity_bytes);
+
+  /**
+   * @brief Returns whether the cache is enabled.
+   */
+  [[nodiscard]] bool is_enabled() const;
+
+  /**
+   * @brief Looks up the metadata of a file and counts a hit or a miss.
+   *
+   * @param key Identity of the file
+   *
+   * @return The cached metadata, or nullptr if the file is not in the cache
+   */
+  std::shared_ptr<FileMetaData const> find(file_identity const& key);
+
+  /**
+   * @brief Inserts the metadata of a file, evicting the least recently used entries as needed.
+   *
+   * Footers larger than the cache capacity are not inserted.
+   *
+   * @param key Identity of the file
+   * @param metadata Parsed file metadata
+   * @param footer_size Size of the serialized footer, in bytes
+   */
+  void insert(file_identity const& key,
+              std::shared_ptr<FileMetaData const> metadata,
+              size_t footer_size);
+
+  /**
+   * @brief Removes all entries; the hit/miss counters are not reset.
+   */
+  void clear();
+
+  /**
+   * @brief Returns the current counters and size of the cache.
+   */
+  [[nodiscard]] parquet_footer_cache_statistics statistics() const;
+
+ private:
+  struct entry {
+    file_identity key;
+    std::shared_ptr<FileMetaData const> metadata;
+    size_t size;
+  };
+
+  void evict_to(size_t capacity_bytes);
+
+  mutable std::mutex _mutex;
+  size_t _capacity = 0;
+  size_t _size     = 0;
+  size_t _hits     = 0;
+  size_t _misses   = 0;
+  std::list<entry> _lru;  // most recently used first
+  std::map<file_identity, std::list<entry>::iterator> _entries;
+};
+
+/**
+ * @brief Reads and parses the footer of a Parquet file, on the host.
+ *
+ * File sources are looked up in the process-wide footer cache, when the cache is enabled.
+ *
+ * @param source Source of the Parquet file
+ *
+ * @return Parsed file metadata, with the schema tree initialized
+ */
+FileMetaData read_footer(datasource* source);
+
+}  // namespace parquet
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -890,6 +890,21 @@ __global__ void __launch_bounds__(128, 8)
     s->chunk_start_val = row_to_value_idx(s->ck.start_row, col);
   }
   __syncthreads();
+  // BYTE_STREAM_SPLIT writes byte k of every value to stream k, so the size of the streams depends
+  // on the number of non-null values in the page
+  auto const values_start   = s->cur;
+  uint32_t num_split_values = 0;
+  if (s->ck.use_byte_stream_split) {
+    uint32_t num_valid = 0;
+    for (uint32_t i = t; i < s->page.num_leaf_values; i += block_size) {
+      size_type const val_idx_in_leaf_col = s->page_start_val + i;
+      num_valid += (val_idx_in_leaf_col < s->col.leaf_column->size() &&
+                    s->col.leaf_column->is_valid(val_idx_in_leaf_col));
+    }
+    uint32_t valid_offset;
+    block_scan(temp_storage).ExclusiveSum(num_valid, valid_offset, num_split_values);
+    __syncthreads();
+  }
   for (uint32_t cur_val_idx = 0; cur_val_idx < s->page.num_leaf_values;) {
     uint32_t nvals = min(s->page.num_leaf_values - cur_val_idx, 128);
     uint32_t len, pos;
@@ -960,7 +975,21 @@ __global__ void __launch_bounds__(128, 8)
       block_scan(temp_storage).ExclusiveSum(len, pos, total_len);
       __syncthreads();
       if (t == 0) { s->cur = dst + total_len; }
-      if (is_valid) {
+      if (is_valid && s->ck.use_byte_stream_split) {
+        // Only FLOAT and DOUBLE columns use BYTE_STREAM_SPLIT
+        auto const split_idx = (dst + pos - values_start) / dtype_len_out;
+        uint8_t bytes[sizeof(double)];
+        if (physical_type == FLOAT) {
+          auto const v = s->col.leaf_column->element<float>(val_idx);
+          memcpy(bytes, &v, sizeof(v));
+        } else {
+          auto const v = s->col.leaf_column->element<double>(val_idx);
+          memcpy(bytes, &v, sizeof(v));
+        }
+        for (uint32_t k = 0; k < dtype_len_out; k++) {
+          values_start[k * num_split_values + split_idx] = bytes[k];
+        }
+      } else if (is_valid) {
         switch (physical_type) {
           case INT32:
           case FLOAT: {
@@ -1344,7 +1373,9 @@ __global__ void __launch_bounds__(128)
     // RLE_DICTIONARY in data page, but parquet v1 uses PLAIN_DICTIONARY in both dictionary and
     // data pages (actual encoding is identical).
     Encoding encoding;
-    if (enable_bool_rle) {
+    if (ck_g.use_byte_stream_split) {
+      encoding = Encoding::BYTE_STREAM_SPLIT;
+    } else if (enable_bool_rle) {
       encoding = (col_g.physical_type == BOOLEAN) ? Encoding::RLE
                  : (page_type == PageType::DICTIONARY_PAGE || page_g.chunk->use_dictionary)
                    ? Encoding::PLAIN_DICTIONARY
@@ -0,0 +1,555 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "parquet_gpu.hpp"
+
+#include <cub/cub.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace io {
+namespace parquet {
+namespace gpu {
+namespace {
+
+// Threads per page; also the number of deltas decoded per batch
+constexpr int delta_block_size = 128;
+// Maximum number of miniblocks in a DELTA_BINARY_PACKED block
+constexpr uint32_t max_mini_blocks = 64;
+
+/**
+ * @brief Reads an unsigned LEB128 varint of up to 64 bits
+ */
+inline __device__ uint64_t get_uleb128(uint8_t const*& cur, uint8_t const* end)
+{
+  uint64_t v = 0;
+  for (uint32_t shift = 0; shift < 64 && cur < end; shift += 7) {
+    auto const c = *cur++;
+    v |= static_cast<uint64_t>(c & 0x7f) << shift;
+    if (c < 0x80) { break; }
+  }
+  return v;
+}
+
+/**
+ * @brief Reads a zigzag-encoded signed LEB128 varint of up to 64 bits
+ */
+inline __device__ int64_t get_zigzag128(uint8_t const*& cur, uint8_t const* end)
+{
+  auto const u = get_uleb128(cur, end);
+  return static_cast<int64_t>((u >> 1) ^ (~(u & 1) + 1));
+}
+
+/**
+ * @brief Converts a decoded value to a byte array length, mapping negative values to 0
+ */
+inline __device__ uint32_t to_length(uint64_t v)
+{
+  auto const len = static_cast<int32_t>(v);
+  return len < 0 ? 0 : len;
+}
+
+/**
+ * @brief Returns the size of the repetition or definition levels at the start of a data page
+ */
+inline __device__ uint32_t level_section_size(PageInfo const& page,
+                                              ColumnChunkDesc const& chunk,
+                                              uint8_t const* cur,
+                                              uint8_t const* end,
+                                              level_type lvl)
+{
+  auto const level_bits = chunk.level_bits[lvl];
+  auto const encoding   = lvl == level_type::DEFINITION ? page.definition_level_encoding
+                                                        : page.repetition_level_encoding;
+  if (level_bits == 0) { return 0; }
+  if (encoding == Encoding::RLE) {
+    if (cur + 4 > end) { return end - cur; }
+    return 4 + (cur[0] | (cur[1] << 8) | (cur[2] << 16) | (cur[3] << 24));
+  }
+  if (encoding == Encoding::BIT_PACKED) {
+    return (page.num_input_values * level_bits + 7) >> 3;
+  }
+  return 0;
+}
+
+/**
+ * @brief Block-wide decoder of a DELTA_BINARY_PACKED stream
+ *
+ * The first batch holds the first value of the stream; each following batch holds the values of
+ * the next `num_threads` deltas. Blocks hold a multiple of 128 deltas, so a batch never spans two
+ * blocks.
+ */
+template <int num_threads>
+struct delta_binary_decoder {
+  using block_scan = cub::BlockScan<uint64_t, num_threads>;
+
+  uint8_t const* cur;              // start of the next block
+  uint8_t const* end;              // end of the page data
+  uint8_t const* mini_block_data;  // start of the miniblocks of the current block
+  uint32_t block_size;             // number of deltas in a block
+  uint32_t num_mini_blocks;        // number of miniblocks in a block
+  uint32_t values_per_mini_block;  // number of deltas in a miniblock
+  uint32_t value_count;            // total number of values in the stream
+  uint32_t batch_start;            // index of the first value of the current batch
+  uint32_t batch_size;             // number of values in the current batch
+  uint64_t min_delta;              // minimum delta of the current block
+  uint64_t last_value;             // last value of the previous batch
+  uint8_t bit_widths[max_mini_blocks];
+  uint32_t mini_block_offsets[max_mini_blocks];
+  typename block_scan::TempStorage scan_storage;
+
+  /**
+   * @brief Parses the header of the stream. Called by a single thread
+   *
+   * @param start Start of the stream
+   * @param stream_end End of the page data
+   * @param max_values Upper bound of the number of values in the stream
+   */
+  __device__ void init(uint8_t const* start, uint8_t const* stream_end, uint32_t max_values)
+  {
+    cur                   = start;
+    end                   = stream_end;
+    block_size            = get_uleb128(cur, end);
+    num_mini_blocks       = get_uleb128(cur, end);
+    value_count           = get_uleb128(cur, end);
+    last_value            = get_zigzag128(cur, end);
+    values_per_mini_block = num_mini_blocks > 0 ? block_size / num_mini_blocks : 0;
+    batch_start           = 0;
+    batch_size            = 0;
+    if (block_size == 0 || block_size % 128 != 0 || num_mini_blocks == 0 ||
+        num_mini_blocks > max_mini_blocks || block_size % num_mini_blocks != 0 ||
+        values_per_mini_block % 32 != 0 || value_count > max_values) {
+      value_count = 0;
+    }
+  }
+
+  /**
+   * @brief Parses the header of the next block, which holds at most `num_deltas` deltas. Called by
+   * a single thread
+   *
+   * @return Whether the block is valid
+   */
+  __device__ bool parse_block(uint32_t num_deltas)
+  {
+    min_delta = get_zigzag128(cur, end);
+    if (cur + num_mini_blocks > end) { return false; }
+    mini_block_data = cur + num_mini_blocks;
+    // The last block only stores the miniblocks that hold deltas
+    auto const used_mini_blocks =
+      min(num_mini_blocks, (num_deltas + values_per_mini_block - 1) / values_per_mini_block);
+    size_t offset = 0;
+    for (uint32_t m = 0; m < used_mini_blocks; m++) {
+      bit_widths[m] = cur[m];
+      if (bit_widths[m] > 64) { return false; }
+      mini_block_offsets[m] = offset;
+      offset += (bit_widths[m] * values_per_mini_block) >> 3;
+    }
+    if (offset > static_cast<size_t>(end - mini_block_data)) { return false; }
+    cur = mini_block_data + offset;
+    return true;
+  }
+
+  /**
+   * @brief Returns the end of the stream, found from the block headers. Called by a single thread
+   *
+   * The decoder must be initialized again before decoding values.
+   */
+  __device__ uint8_t const* skip_values()
+  {
+    for (uint32_t pos = 1; pos < value_count; pos += block_size) {
+      if (!parse_block(value_count - pos)) { return end; }
+    }
+    return cur;
+  }
+
+  /**
+   * @brief Whether values remain to be decoded. Called by all threads between batches
+   */
+  __device__ bool has_more() const { return batch_start + batch_size < value_count; }
+
+  /**
+   * @brief Decodes the next batch of values. Called by all threads of the block
+   *
+   * @param t Thread index
+   *
+   * @return The value at index `batch_start + t`, valid if `t < batch_size`
+   */
+  __device__ uint64_t decode_batch(int t)
+  {
+    __syncthreads();
+    if (t == 0) {
+      auto const start = batch_start + batch_size;
+      batch_start      = start;
+      if (start == 0) {
+        batch_size = min(value_count, 1u);
+      } else {
+        batch_size =
+          start < value_count ? min(value_count - start, static_cast<uint32_t>(num_threads)) : 0;
+        // The delta of value `i` is delta `i - 1`; each block starts a new batch
+        if (batch_size > 0 && (start - 1) % block_size == 0 && !parse_block(value_count - start)) {
+          batch_size  = 0;
+          value_count = start;
+        }
+      }
+    }
+    __syncthreads();
+
+    uint64_t delta = 0;
+    if (batch_start > 0 && t < batch_size) {
+      auto const delta_idx  = (batch_start - 1 + t) % block_size;
+      auto const mini_block = delta_idx / values_per_mini_block;
+      auto const width      = bit_widths[mini_block];
+      delta                 = min_delta;
+      if (width > 0) {
+        auto const bit_pos = static_cast<uint64_t>(delta_idx % values_per_mini_block) * width;
+        auto const* p      = mini_block_data + mini_block_offsets[mini_block] + (bit_pos >> 3);
+        auto const shift   = static_cast<uint32_t>(bit_pos & 7);
+        uint64_t bits      = 0;
+        for (int i = 0; i < 8; i++) {
+          bits |= static_cast<uint64_t>(p + i < end ? p[i] : 0) << (8 * i);
+        }
+        bits >>= shift;
+        if (width + shift > 64) {
+          bits |= static_cast<uint64_t>(p + 8 < end ? p[8] : 0) << (64 - shift);
+        }
+        if (width < 64) { bits &= (uint64_t{1} << width) - 1; }
+        delta += bits;
+      }
+    }
+    uint64_t value;
+    block_scan(scan_storage).InclusiveSum(delta, value);
+    value = batch_start == 0 ? last_value : last_value + value;
+    __syncthreads();
+    if (batch_start > 0 && batch_size > 0 && t == static_cast<int>(batch_size) - 1) {
+      last_value = value;
+    }
+    __syncthreads();
+    return value;
+  }
+};
+
+/**
+ * @brief State of a page being expanded to PLAIN
+ */
+template <int num_threads>
+struct expand_page_state_s {
+  uint8_t const* page_data;     // start of the page, including the levels
+  uint8_t const* end;           // end of the page
+  uint8_t const* string_data;   // concatenated string or suffix bytes
+  uint8_t const* split_data;    // byte streams of BYTE_STREAM_SPLIT pages
+  uint32_t num_split_values;    // number of values in BYTE_STREAM_SPLIT pages
+  uint32_t levels_size;         // size of the repetition and definition levels
+  uint32_t value_size;          // size of a fixed-width value in the PLAIN encoding
+  uint32_t length_header_size;  // 4 for BYTE_ARRAY, 0 for FIXED_LEN_BYTE_ARRAY
+  // DELTA_BINARY_PACKED values, or prefix lengths of DELTA_BYTE_ARRAY pages
+  delta_binary_decoder<num_threads> values;
+  // String lengths of DELTA_LENGTH_BYTE_ARRAY pages, or suffix lengths of DELTA_BYTE_ARRAY pages
+  delta_binary_decoder<num_threads> lengths;
+  size_t string_pos[num_threads];
+  uint32_t prefix_len[num_threads];
+  uint32_t string_len[num_threads];
+};
+
+/**
+ * @brief Parses the levels and the stream headers of a page expanded to PLAIN. Called by a single
+ * thread
+ */
+template <int num_threads>
+__device__ void init_expanded_page(expand_page_state_s<num_threads>* s,
+                                   PageInfo const& page,
+                                   ColumnChunkDesc const& chunk)
+{
+  auto const* cur = page.page_data;
+  auto const* end = page.page_data + page.uncompressed_page_size;
+  cur += min(level_section_size(page, chunk, cur, end, level_type::REPETITION),
+             static_cast<uint32_t>(end - cur));
+  cur += min(level_section_size(page, chunk, cur, end, level_type::DEFINITION),
+             static_cast<uint32_t>(end - cur));
+
+  auto const data_type  = chunk.data_type & 7;
+  s->page_data          = page.page_data;
+  s->end                = end;
+  s->levels_size        = cur - page.page_data;
+  s->value_size         = data_type == INT64 ? sizeof(int64_t) : sizeof(int32_t);
+  s->length_header_size = data_type == BYTE_ARRAY ? sizeof(uint32_t) : 0;
+  s->string_data        = end;
+
+  auto const max_values = static_cast<uint32_t>(page.num_input_values);
+  switch (page.encoding) {
+    case Encoding::DELTA_BINARY_PACKED: s->values.init(cur, end, max_values); break;
+    case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+      s->lengths.init(cur, end, max_values);
+      s->string_data = s->lengths.skip_values();
+      s->lengths.init(cur, end, max_values);
+      break;
+    case Encoding::DELTA_BYTE_ARRAY: {
+      s->values.init(cur, end, max_values);
+      auto const* suffixes = s->values.skip_values();
+      s->values.init(cur, end, max_values);
+      s->lengths.init(suffixes, end, max_values);
+      s->string_data = s->lengths.skip_values();
+      s->lengths.init(suffixes, end, max_values);
+      break;
+    }
+    case Encoding::BYTE_STREAM_SPLIT:
+      s->value_size = [&]() -> uint32_t {
+        switch (data_type) {
+          case INT64:
+          case DOUBLE: return sizeof(int64_t);
+          case FIXED_LEN_BYTE_ARRAY: return chunk.data_type >> 3;
+          default: return sizeof(int32_t);
+        }
+      }();
+      s->split_data       = cur;
+      s->num_split_values = s->value_size > 0 ? (end - cur) / s->value_size : 0;
+      break;
+    default: break;
+  }
+}
+
+/**
+ * @brief Kernel for computing the size of pages once expanded to PLAIN
+ *
+ * @param[in] pages List of pages
+ * @param[in] chunks List of column chunks
+ * @param[out] plain_sizes Expanded size of each page, or 0 for pages that are not expanded
+ */
+template <int num_threads>
+__global__ void __launch_bounds__(num_threads) gpuComputePlainPageSizes(
+  PageInfo const* pages, ColumnChunkDesc const* chunks, size_t* plain_sizes)
+{
+  using block_reduce = cub::BlockReduce<uint64_t, num_threads>;
+  __shared__ expand_page_state_s<num_threads> state_g;
+  __shared__ typename block_reduce::TempStorage reduce_storage;
+
+  auto* const s    = &state_g;
+  auto const& page = pages[blockIdx.x];
+  int t            = threadIdx.x;
+
+  if (!is_expanded_to_plain(page)) {
+    if (t == 0) { plain_sizes[blockIdx.x] = 0; }
+    return;
+  }
+  if (t == 0) { init_expanded_page(s, page, chunks[page.chunk_idx]); }
+  __syncthreads();
+
+  uint64_t data_size = 0;
+  switch (page.encoding) {
+    case Encoding::DELTA_BINARY_PACKED:
+      if (t == 0) { data_size = static_cast<uint64_t>(s->values.value_count) * s->value_size; }
+      break;
+    case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+      while (s->lengths.has_more()) {
+        auto const len = to_length(s->lengths.decode_batch(t));
+        if (t < s->lengths.batch_size) { data_size += sizeof(uint32_t) + len; }
+      }
+      break;
+    case Encoding::DELTA_BYTE_ARRAY:
+      while (s->lengths.has_more()) {
+        auto const prefix = to_length(s->values.decode_batch(t));
+        auto const suffix = to_length(s->lengths.decode_batch(t));
+        if (t < s->lengths.batch_size) {
+          data_size += s->length_header_size + suffix + (t < s->values.batch_size ? prefix : 0);
+        }
+      }
+      break;
+    case Encoding::BYTE_STREAM_SPLIT:
+      if (t == 0) { data_size = static_cast<uint64_t>(s->num_split_values) * s->value_size; }
+      break;
+    default: break;
+  }
+
+  auto const total_size = block_reduce(reduce_storage).Sum(data_size);
+  if (t == 0) { plain_sizes[blockIdx.x] = s->levels_size + total_size; }
+}
+
+/**
+ * @brief Kernel for expanding DELTA and BYTE_STREAM_SPLIT pages into PLAIN-encoded pages
+ *
+ * The repetition and definition levels are copied unchanged.
+ *
+ * @param[in] pages List of pages
+ * @param[in] chunks List of column chunks
+ * @param[in] plain_offsets Offset of each expanded page in `plain_data`
+ * @param[out] plain_data Expanded pages
+ */
+template <int num_threads>
+__global__ void __launch_bounds__(num_threads) gpuExpandPagesToPlain(PageInfo const* pages,
+                                                                     ColumnChunkDesc const* chunks,
+                                                                     size_t const* plain_offsets,
+                                                                     uint8_t* plain_data)
+{
+  using block_scan = cub::BlockScan<uint64_t, num_threads>;
+  __shared__ expand_page_state_s<num_threads> state_g;
+  __shared__ typename block_scan::TempStorage scan_storage;
+
+  auto* const s    = &state_g;
+  auto const& page = pages[blockIdx.x];
+  int t            = threadIdx.x;
+
+  if (!is_expanded_to_plain(page)) { return; }
+  if (t == 0) { init_expanded_page(s, page, chunks[page.chunk_idx]); }
+  __syncthreads();
+
+  auto* const out = plain_data + plain_offsets[blockIdx.x];
+  for (uint32_t i = t; i < s->levels_size; i += num_threads) {
+    out[i] = s->page_data[i];
+  }
+  auto* const out_values = out + s->levels_size;
+  auto const* const end  = s->end;
+
+  // Writes a little-endian value of `size` bytes
+  auto write_le = [](uint8_t* dst, uint64_t value, uint32_t size) {
+    for (uint32_t i = 0; i < size; i++) {
+      dst[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+  };
+  auto copy_bytes = [end](uint8_t* dst, uint8_t const* src, uint32_t len) {
+    for (uint32_t i = 0; i < len; i++) {
+      dst[i] = src + i < end ? src[i] : 0;
+    }
+  };
+
+  switch (page.encoding) {
+    case Encoding::DELTA_BINARY_PACKED:
+      while (s->values.has_more()) {
+        auto const value = s->values.decode_batch(t);
+        if (t < s->values.batch_size) {
+          auto const idx = static_cast<size_t>(s->values.batch_start) + t;
+          write_le(out_values + idx * s->value_size, value, s->value_size);
+        }
+      }
+      break;
+    case Encoding::DELTA_LENGTH_BYTE_ARRAY: {
+      // Each string is preceded by its 4-byte length
+      uint64_t string_offset = 0;
+      while (s->lengths.has_more()) {
+        auto const len      = to_length(s->lengths.decode_batch(t));
+        auto const is_valid = t < s->lengths.batch_size;
+        uint64_t offset, batch_bytes;
+        block_scan(scan_storage).ExclusiveSum(is_valid ? len : 0, offset, batch_bytes);
+        if (is_valid) {
+          auto const idx = static_cast<size_t>(s->lengths.batch_start) + t;
+          auto* dst      = out_values + idx * sizeof(uint32_t) + string_offset + offset;
+          write_le(dst, len, sizeof(uint32_t));
+          copy_bytes(dst + sizeof(uint32_t), s->string_data + string_offset + offset, len);
+        }
+        string_offset += batch_bytes;
+      }
+      break;
+    }
+    case Encoding::DELTA_BYTE_ARRAY: {
+      // Strings are stored as the length of the prefix shared with the previous string, followed by
+      // the remaining suffix
+      uint64_t suffix_offset = 0;
+      uint64_t out_offset    = 0;
+      uint8_t const* prev    = nullptr;
+      uint32_t prev_len      = 0;
+      while (s->lengths.has_more()) {
+        auto const prefix_value = s->values.decode_batch(t);
+        auto const suffix_value = s->lengths.decode_batch(t);
+        auto const is_valid     = t < s->lengths.batch_size;
+        auto const prefix = is_valid && t < s->values.batch_size ? to_length(prefix_value) : 0;
+        auto const suffix = is_valid ? to_length(suffix_value) : 0;
+
+        uint64_t src_pos, batch_suffix_bytes, dst_pos, batch_out_bytes;
+        block_scan(scan_storage).ExclusiveSum(suffix, src_pos, batch_suffix_bytes);
+        __syncthreads();
+        block_scan(scan_storage)
+          .ExclusiveSum(is_valid ? s->length_header_size + prefix + suffix : 0,
+                        dst_pos,
+                        batch_out_bytes);
+        if (is_valid) {
+          auto* dst = out_values + out_offset + dst_pos;
+          write_le(dst, prefix + suffix, s->length_header_size);
+          dst += s->length_header_size;
+          copy_bytes(dst + prefix, s->string_data + suffix_offset + src_pos, suffix);
+          s->string_pos[t] = dst - out_values;
+          s->prefix_len[t] = prefix;
+          s->string_len[t] = prefix + suffix;
+        }
+        __syncthreads();
+
+        // Prefixes repeat the start of the previous string, so they are filled in order
+        if (t < 32) {
+          for (uint32_t i = 0; i < s->lengths.batch_size; i++) {
+            auto* const str  = out_values + s->string_pos[i];
+            auto const count = min(s->prefix_len[i], prev_len);
+            for (uint32_t j = t; j < count; j += 32) {
+              str[j] = prev[j];
+            }
+            __syncwarp();
+            prev     = str;
+            prev_len = s->string_len[i];
+          }
+        }
+        suffix_offset += batch_suffix_bytes;
+        out_offset += batch_out_bytes;
+      }
+      break;
+    }
+    case Encoding::BYTE_STREAM_SPLIT: {
+      // Byte k of value i is at offset i of stream k
+      auto const num_values = s->num_split_values;
+      auto const value_size = s->value_size;
+      auto const data_size  = static_cast<size_t>(num_values) * value_size;
+      for (size_t i = t; i < data_size; i += num_threads) {
+        out_values[i] = s->split_data[(i % value_size) * num_values + i / value_size];
+      }
+      break;
+    }
+    default: break;
+  }
+}
+
+}  // namespace
+
+/**
+ * @copydoc cudf::io::parquet::gpu::ComputePlainPageSizes
+ */
+void ComputePlainPageSizes(hostdevice_vector<PageInfo> const& pages,
+                           hostdevice_vector<ColumnChunkDesc> const& chunks,
+                           device_span<size_t> plain_sizes,
+                           rmm::cuda_stream_view stream)
+{
+  dim3 dim_block(delta_block_size, 1);
+  dim3 dim_grid(pages.size(), 1);  // 1 threadblock per page
+
+  gpuComputePlainPageSizes<delta_block_size><<<dim_grid, dim_block, 0, stream.value()>>>(
+    pages.device_ptr(), chunks.device_ptr(), plain_sizes.data());
+}
+
+/**
+ * @copydoc cudf::io::parquet::gpu::ExpandPagesToPlain
+ */
+void ExpandPagesToPlain(hostdevice_vector<PageInfo> const& pages,
+                        hostdevice_vector<ColumnChunkDesc> const& chunks,
+                        device_span<size_t const> plain_offsets,
+                        uint8_t* plain_data,
+                        rmm::cuda_stream_view stream)
+{
+  dim3 dim_block(delta_block_size, 1);
+  dim3 dim_grid(pages.size(), 1);  // 1 threadblock per page
+
+  gpuExpandPagesToPlain<delta_block_size><<<dim_grid, dim_block, 0, stream.value()>>>(
+    pages.device_ptr(), chunks.device_ptr(), plain_offsets.data(), plain_data);
+}
+
+}  // namespace gpu
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
@@ -240,7 +240,9 @@ bool CompactProtocolReader::read(ColumnChunkMetaData* c)
                             ParquetFieldInt64(9, c->data_page_offset),
                             ParquetFieldInt64(10, c->index_page_offset),
                             ParquetFieldInt64(11, c->dictionary_page_offset),
-                            ParquetFieldStructBlob(12, c->statistics_blob));
+                            ParquetFieldStructBlob(12, c->statistics_blob),
+                            ParquetFieldInt64(14, c->bloom_filter_offset),
+                            ParquetFieldInt32(15, c->bloom_filter_length));
   return function_builder(this, op);
 }
 
@@ -259,7 +261,8 @@ bool CompactProtocolReader::read(DataPageHeader* d)
   auto op = std::make_tuple(ParquetFieldInt32(1, d->num_values),
                             ParquetFieldEnum<Encoding>(2, d->encoding),
                             ParquetFieldEnum<Encoding>(3, d->definition_level_encoding),
-                            ParquetFieldEnum<Encoding>(4, d->repetition_level_encoding));
+                            ParquetFieldEnum<Encoding>(4, d->repetition_level_encoding),
+                            ParquetFieldStruct(5, d->statistics));
   return function_builder(this, op);
 }
 
@@ -276,6 +279,66 @@ bool CompactProtocolReader::read(KeyValue* k)
   return function_builder(this, op);
 }
 
+bool CompactProtocolReader::read(Statistics* s)
+{
+  auto op = std::make_tuple(ParquetFieldInt64(3, s->null_count),
+                            ParquetFieldInt64(4, s->distinct_count),
+                            ParquetFieldBinary(5, s->max_value, s->has_max_value),
+                            ParquetFieldBinary(6, s->min_value, s->has_min_value));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(PageLocation* p)
+{
+  auto op = std::make_tuple(ParquetFieldInt64(1, p->offset),
+                            ParquetFieldInt32(2, p->compressed_page_size),
+                            ParquetFieldInt64(3, p->first_row_index));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(OffsetIndex* o)
+{
+  auto op = std::make_tuple(ParquetFieldStructList(1, o->page_locations));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(ColumnIndex* c)
+{
+  auto op = std::make_tuple(ParquetFieldBoolList(1, c->null_pages),
+                            ParquetFieldStringList(2, c->min_values),
+                            ParquetFieldStringList(3, c->max_values),
+                            ParquetFieldEnum<BoundaryOrder>(4, c->boundary_order),
+                            ParquetFieldInt64List(5, c->null_counts));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(BloomFilterAlgorithm* a)
+{
+  auto op = std::make_tuple(ParquetFieldUnion(1, a->isset.BLOCK, a->BLOCK));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(BloomFilterHash* h)
+{
+  auto op = std::make_tuple(ParquetFieldUnion(1, h->isset.XXHASH, h->XXHASH));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(BloomFilterCompression* c)
+{
+  auto op = std::make_tuple(ParquetFieldUnion(1, c->isset.UNCOMPRESSED, c->UNCOMPRESSED));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(BloomFilterHeader* b)
+{
+  auto op = std::make_tuple(ParquetFieldInt32(1, b->num_bytes),
+                            ParquetFieldStruct(2, b->algorithm),
+                            ParquetFieldStruct(3, b->hash),
+                            ParquetFieldStruct(4, b->compression));
+  return function_builder(this, op);
+}
+
 /**
  * @brief Constructs the schema from the file-level metadata
  *
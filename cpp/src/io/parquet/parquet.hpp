@@ -201,6 +201,34 @@ struct SchemaElement {
            // this assumption might be a little weak.
            ((repetition_type != REPEATED) || (repetition_type == REPEATED && num_children == 2));
   }
+
+  // unsigned integers are stored as signed physical types, and their values and statistics are
+  // ordered as unsigned
+  [[nodiscard]] bool is_unsigned() const
+  {
+    switch (converted_type) {
+      case UINT_8:
+      case UINT_16:
+      case UINT_32:
+      case UINT_64: return true;
+      default: return logical_type.isset.INTEGER && !logical_type.INTEGER.isSigned;
+    }
+  }
+};
+
+/**
+ * @brief Thrift-derived struct describing column chunk statistics
+ *
+ * Only the `min_value` and `max_value` fields are read, as the deprecated `min` and `max` fields
+ * use an ordering that is undefined for some types.
+ */
+struct Statistics {
+  int64_t null_count     = -1;     // Count of null values; -1 if not set
+  int64_t distinct_count = -1;     // Count of distinct values; -1 if not set
+  std::vector<uint8_t> max_value;  // Plain-encoded max value
+  std::vector<uint8_t> min_value;  // Plain-encoded min value
+  bool has_max_value = false;
+  bool has_min_value = false;
 };
 
 /**
@@ -221,6 +249,8 @@ struct ColumnChunkMetaData {
   int64_t dictionary_page_offset =
     0;  // Byte offset from the beginning of file to first (only) dictionary page
   std::vector<uint8_t> statistics_blob;  // Encoded chunk-level statistics as binary blob
+  int64_t bloom_filter_offset = 0;  // Byte offset from the beginning of file to the Bloom filter
+  int32_t bloom_filter_length = 0;  // Size of the Bloom filter, including its header; optional
 };
 
 /**
@@ -289,6 +319,90 @@ struct DataPageHeader {
   Encoding encoding                  = Encoding::PLAIN;  // Encoding used for this data page
   Encoding definition_level_encoding = Encoding::PLAIN;  // Encoding used for definition levels
   Encoding repetition_level_encoding = Encoding::PLAIN;  // Encoding used for repetition levels
+  Statistics statistics;  // Optional page-level statistics
+};
+
+/**
+ * @brief Thrift-derived struct describing the location of a page in a column chunk
+ */
+struct PageLocation {
+  int64_t offset               = 0;  // Offset of the page in the file
+  int32_t compressed_page_size = 0;  // Size of the page, including the header
+  int64_t first_row_index      = 0;  // Index of the first row of the page within the row group
+};
+
+/**
+ * @brief Thrift-derived struct describing the locations of the data pages of a column chunk
+ */
+struct OffsetIndex {
+  std::vector<PageLocation> page_locations;
+};
+
+/**
+ * @brief Sort order of the page min/max values in a `ColumnIndex`
+ */
+enum BoundaryOrder { UNORDERED = 0, ASCENDING = 1, DESCENDING = 2 };
+
+/**
+ * @brief Thrift-derived struct describing the per-page statistics of a column chunk
+ *
+ * Entries are in the same order as the pages in the `OffsetIndex`.
+ */
+struct ColumnIndex {
+  std::vector<bool> null_pages;              // Whether each page contains only null values
+  std::vector<std::string> min_values;       // Plain-encoded page min values; empty for null pages
+  std::vector<std::string> max_values;       // Plain-encoded page max values; empty for null pages
+  BoundaryOrder boundary_order = UNORDERED;  // Sort order of the min/max values across pages
+  std::vector<int64_t> null_counts;          // Null count of each page; optional
+};
+
+// thrift generated code simplified.
+struct SplitBlockAlgorithm {
+};
+using BloomFilterAlgorithm_isset = struct BloomFilterAlgorithm_isset {
+  BloomFilterAlgorithm_isset() {}
+  bool BLOCK{false};
+};
+
+struct BloomFilterAlgorithm {
+  BloomFilterAlgorithm_isset isset;
+  SplitBlockAlgorithm BLOCK;
+};
+
+struct XxHash {
+};
+using BloomFilterHash_isset = struct BloomFilterHash_isset {
+  BloomFilterHash_isset() {}
+  bool XXHASH{false};
+};
+
+struct BloomFilterHash {
+  BloomFilterHash_isset isset;
+  XxHash XXHASH;
+};
+
+struct Uncompressed {
+};
+using BloomFilterCompression_isset = struct BloomFilterCompression_isset {
+  BloomFilterCompression_isset() {}
+  bool UNCOMPRESSED{false};
+};
+
+struct BloomFilterCompression {
+  BloomFilterCompression_isset isset;
+  Uncompressed UNCOMPRESSED;
+};
+
+/**
+ * @brief Thrift-derived struct describing the header of a column chunk Bloom filter
+ *
+ * The header is followed by `num_bytes` bytes of filter bitset.
+ */
+struct BloomFilterHeader {
+  int32_t num_bytes = 0;               // Size of the bitset, in bytes
+  BloomFilterAlgorithm algorithm;      // Algorithm used to set the bits
+  BloomFilterHash hash;                // Hash function applied to the plain-encoded values
+  BloomFilterCompression compression;  // Compression of the bitset
 };
 
 /**
@@ -423,6 +537,14 @@ class CompactProtocolReader {
   bool read(DataPageHeader* d);
   bool read(DictionaryPageHeader* d);
   bool read(KeyValue* k);
+  bool read(Statistics* s);
+  bool read(PageLocation* p);
+  bool read(OffsetIndex* o);
+  bool read(ColumnIndex* c);
+  bool read(BloomFilterAlgorithm* a);
+  bool read(BloomFilterHash* h);
+  bool read(BloomFilterCompression* c);
+  bool read(BloomFilterHeader* b);
 
  public:
   static int NumRequiredBits(uint32_t max_level) noexcept
@@ -460,6 +582,9 @@ class CompactProtocolReader {
   friend class ParquetFieldEnumListFunctor;
   friend class ParquetFieldStringList;
   friend class ParquetFieldStructBlob;
+  friend class ParquetFieldBinary;
+  friend class ParquetFieldBoolList;
+  friend class ParquetFieldInt64List;
 };
 
 /**
@@ -792,6 +917,93 @@ class ParquetFieldStringList {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to read a vector of booleans from CompactProtocolReader
+ *
+ * @return True if field types mismatch
+ */
+class ParquetFieldBoolList {
+  int field_val;
+  std::vector<bool>& val;
+
+ public:
+  ParquetFieldBoolList(int f, std::vector<bool>& v) : field_val(f), val(v) {}
+  inline bool operator()(CompactProtocolReader* cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_TRUE && (current_byte & 0xf) != ST_FLD_FALSE) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) {
+      val[i] = (cpr->getb() == ST_FLD_TRUE);
+    }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
+/**
+ * @brief Functor to read a vector of 64 bit integers from CompactProtocolReader
+ *
+ * @return True if field types mismatch
+ */
+class ParquetFieldInt64List {
+  int field_val;
+  std::vector<int64_t>& val;
+
+ public:
+  ParquetFieldInt64List(int f, std::vector<int64_t>& v) : field_val(f), val(v) {}
+  inline bool operator()(CompactProtocolReader* cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_I64) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) {
+      val[i] = cpr->get_i64();
+    }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
+/**
+ * @brief Functor to read a binary field from CompactProtocolReader
+ *
+ * @return True if field type mismatches or if size of binary exceeds bounds
+ * of the CompactProtocolReader
+ */
+class ParquetFieldBinary {
+  int field_val;
+  std::vector<uint8_t>& val;
+  bool& is_set;
+
+ public:
+  ParquetFieldBinary(int f, std::vector<uint8_t>& v, bool& s) : field_val(f), val(v), is_set(s) {}
+
+  inline bool operator()(CompactProtocolReader* cpr, int field_type)
+  {
+    if (field_type != ST_FLD_BINARY) return true;
+    uint32_t n = cpr->get_u32();
+    if (n <= (size_t)(cpr->m_end - cpr->m_cur)) {
+      val.assign(cpr->m_cur, cpr->m_cur + n);
+      cpr->m_cur += n;
+      is_set = true;
+      return false;
+    } else {
+      return true;
+    }
+  }
+
+  int field() { return field_val; }
+};
+
 /**
  * @brief Functor to read a struct from CompactProtocolReader
  *
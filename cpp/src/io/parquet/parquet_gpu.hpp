@@ -153,6 +153,21 @@ struct PageInfo {
   PageNestingInfo* nesting;
 };
 
+/**
+ * @brief Returns whether a data page is expanded to PLAIN before decoding
+ *
+ * This is the case for the DELTA encodings and BYTE_STREAM_SPLIT, which `DecodePageData` does not
+ * read directly.
+ */
+inline __host__ __device__ bool is_expanded_to_plain(PageInfo const& page)
+{
+  return !(page.flags & PAGEINFO_FLAGS_DICTIONARY) &&
+         (page.encoding == Encoding::DELTA_BINARY_PACKED ||
+          page.encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY ||
+          page.encoding == Encoding::DELTA_BYTE_ARRAY ||
+          page.encoding == Encoding::BYTE_STREAM_SPLIT);
+}
+
 /**
  * @brief Struct describing a particular chunk of column data
  */
@@ -274,6 +289,11 @@ struct PageFragment {
 constexpr unsigned int kDictHashBits = 16;
 constexpr size_t kDictScratchSize    = (1 << kDictHashBits) * sizeof(uint32_t);
 
+/// Number of hash bits that select a register of the per-chunk cardinality sketch
+constexpr unsigned int CARDINALITY_SKETCH_BITS = 11;
+/// Number of registers of the per-chunk cardinality sketch (relative error ~1.04/sqrt(size))
+constexpr size_type CARDINALITY_SKETCH_SIZE = 1 << CARDINALITY_SKETCH_BITS;
+
 /**
  * @brief Return the byte length of parquet dtypes that are physically represented by INT32
  */
@@ -352,8 +372,13 @@ struct EncColumnChunk {
   size_type plain_data_size;  //!< Size of data in this chunk if plain encoding is used
   size_type* dict_data;       //!< Dictionary data (unique row indices)
   uint16_t* dict_index;   //!< Index of value in dictionary page. column[dict_data[dict_index[row]]]
-  uint8_t dict_rle_bits;  //!< Bit size for encoding dictionary indices
-  bool use_dictionary;    //!< True if the chunk uses dictionary encoding
+  uint8_t dict_rle_bits;       //!< Bit size for encoding dictionary indices
+  bool use_dictionary;         //!< True if the chunk uses dictionary encoding
+  bool use_byte_stream_split;  //!< True if the chunk uses BYTE_STREAM_SPLIT encoding
+  uint32_t* bloom_filter;      //!< Bloom filter bitset; nullptr if the chunk has no filter
+  uint32_t bloom_filter_size;  //!< Size of the Bloom filter bitset, in bytes
+  uint32_t* hll_sketch;        //!< Cardinality sketch registers; nullptr if not estimated
+  size_type est_dict_entries;  //!< Estimated number of distinct values; -1 if not estimated
 };
 
 /**
@@ -426,6 +451,41 @@ void PreprocessColumnData(hostdevice_vector<PageInfo>& pages,
                           rmm::cuda_stream_view stream,
                           rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Launches kernel for computing the size of pages once expanded to PLAIN
+ *
+ * The size of each page includes its repetition and definition levels. Pages that are not
+ * expanded (see `is_expanded_to_plain`) have a size of 0.
+ *
+ * @param[in] pages All pages to be decoded
+ * @param[in] chunks All chunks to be decoded
+ * @param[out] plain_sizes Expanded size of each page
+ * @param[in] stream CUDA stream to use, default 0
+ */
+void ComputePlainPageSizes(hostdevice_vector<PageInfo> const& pages,
+                           hostdevice_vector<ColumnChunkDesc> const& chunks,
+                           device_span<size_t> plain_sizes,
+                           rmm::cuda_stream_view stream);
+
+/**
+ * @brief Launches kernel for expanding DELTA and BYTE_STREAM_SPLIT pages into PLAIN pages
+ *
+ * DELTA_BINARY_PACKED, DELTA_LENGTH_BYTE_ARRAY, DELTA_BYTE_ARRAY and BYTE_STREAM_SPLIT values are
+ * rewritten in the PLAIN encoding of the column's physical type, so that the pages can be read by
+ * `DecodePageData`. Other pages are left untouched.
+ *
+ * @param[in] pages All pages to be decoded
+ * @param[in] chunks All chunks to be decoded
+ * @param[in] plain_offsets Offset of each expanded page in `plain_data`
+ * @param[out] plain_data Expanded pages, sized from `ComputePlainPageSizes`
+ * @param[in] stream CUDA stream to use, default 0
+ */
+void ExpandPagesToPlain(hostdevice_vector<PageInfo> const& pages,
+                        hostdevice_vector<ColumnChunkDesc> const& chunks,
+                        device_span<size_t const> plain_offsets,
+                        uint8_t* plain_data,
+                        rmm::cuda_stream_view stream);
+
 /**
  * @brief Launches kernel for reading the column data stored in the pages
  *
@@ -514,6 +574,27 @@ void InitFragmentStatistics(cudf::detail::device_2dspan<statistics_group> groups
                             device_span<gpu::parquet_column_device_view const> col_desc,
                             rmm::cuda_stream_view stream);
 
+/**
+ * @brief Insert the hashes of chunk values into their respective cardinality sketches
+ *
+ * Chunks without a sketch (`hll_sketch == nullptr`) are skipped. Sketches must be zeroed.
+ *
+ * @param chunks Column chunks [rowgroup][column]
+ * @param frags Column fragments
+ * @param stream CUDA stream to use
+ */
+void populate_chunk_cardinality_sketches(cudf::detail::device_2dspan<EncColumnChunk> chunks,
+                                         cudf::detail::device_2dspan<gpu::PageFragment const> frags,
+                                         rmm::cuda_stream_view stream);
+
+/**
+ * @brief Compute chunk.est_dict_entries from the populated HyperLogLog sketches
+ *
+ * @param chunks Flat span of chunks to estimate the cardinality of
+ * @param stream CUDA stream to use
+ */
+void estimate_chunk_cardinalities(device_span<EncColumnChunk> chunks, rmm::cuda_stream_view stream);
+
 /**
  * @brief Initialize per-chunk hash maps used for dictionary with sentinel values
  *
@@ -541,6 +622,19 @@ void populate_chunk_hash_maps(cudf::detail::device_2dspan<EncColumnChunk> chunks
  */
 void collect_map_entries(device_span<EncColumnChunk> chunks, rmm::cuda_stream_view stream);
 
+/**
+ * @brief Insert the hashes of chunk values into their respective Bloom filters
+ *
+ * Chunks without a filter (`bloom_filter == nullptr`) are skipped. Filters must be zeroed.
+ *
+ * @param chunks Column chunks [rowgroup][column]
+ * @param frags Column fragments
+ * @param stream CUDA stream to use
+ */
+void populate_chunk_bloom_filters(cudf::detail::device_2dspan<EncColumnChunk> chunks,
+                                  cudf::detail::device_2dspan<gpu::PageFragment const> frags,
+                                  rmm::cuda_stream_view stream);
+
 /**
  * @brief Get the Dictionary Indices for each row
  *
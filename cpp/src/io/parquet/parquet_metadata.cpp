@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file parquet_metadata.cpp
+ * @brief Conversion of parsed Parquet footers to the public `parquet_metadata`
+ */
+
+#include "footer_cache.hpp"
+
+#include <cudf/io/detail/parquet.hpp>
+#include <cudf/io/parquet_metadata.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace parquet {
+using namespace cudf::io::parquet;
+
+namespace {
+
+/**
+ * @brief Decodes a plain-encoded statistics value according to the type of the column.
+ */
+std::optional<parquet_statistics_value> decode_value(std::vector<uint8_t> const& encoded,
+                                                     bool is_set,
+                                                     SchemaElement const& schema)
+{
+  if (!is_set) { return std::nullopt; }
+
+  auto decode = [&](auto value) -> std::optional<decltype(value)> {
+    if (encoded.size() != sizeof(value)) { return std::nullopt; }
+    std::memcpy(&value, encoded.data(), sizeof(value));
+    return value;
+  };
+
+  switch (schema.type) {
+    case BOOLEAN:
+      if (encoded.size() != 1) { return std::nullopt; }
+      return int64_t{encoded[0] != 0};
+    case INT32:
+      if (auto const value = decode(int32_t{}); value.has_value()) {
+        if (schema.is_unsigned()) { return uint64_t{static_cast<uint32_t>(value.value())}; }
+        return int64_t{value.value()};
+      }
+      return std::nullopt;
+    case INT64:
+      if (auto const value = decode(int64_t{}); value.has_value()) {
+        if (schema.is_unsigned()) { return static_cast<uint64_t>(value.value()); }
+        return value.value();
+      }
+      return std::nullopt;
+    case FLOAT:
+      if (auto const value = decode(float{}); value.has_value()) {
+        return static_cast<double>(value.value());
+      }
+      return std::nullopt;
+    case DOUBLE:
+      if (auto const value = decode(double{}); value.has_value()) { return value.value(); }
+      return std::nullopt;
+    default: return std::string(encoded.cbegin(), encoded.cend());
+  }
+}
+
+parquet_column_statistics convert_statistics(std::vector<uint8_t> const& blob,
+                                             SchemaElement const& schema)
+{
+  parquet_column_statistics result;
+  if (blob.empty()) { return result; }
+
+  Statistics stats;
+  CompactProtocolReader cp(blob.data(), blob.size());
+  if (!cp.read(&stats)) { return result; }
+
+  if (stats.null_count >= 0) { result.null_count = stats.null_count; }
+  if (stats.distinct_count >= 0) { result.distinct_count = stats.distinct_count; }
+  result.minimum = decode_value(stats.min_value, stats.has_min_value, schema);
+  result.maximum = decode_value(stats.max_value, stats.has_max_value, schema);
+  return result;
+}
+
+parquet_schema_element convert_schema(std::vector<SchemaElement> const& schema, size_t idx)
+{
+  auto const& element = schema[idx];
+
+  parquet_schema_element result;
+  result.name            = element.name;
+  result.repetition_type = static_cast<parquet_repetition_type>(element.repetition_type);
+  result.type_length     = element.type_length;
+  if (element.num_children == 0 && element.type != UNDEFINED_TYPE) {
+    result.physical_type = static_cast<parquet_physical_type>(element.type);
+  }
+  if (element.converted_type != UNKNOWN) { result.converted_type = element.converted_type; }
+  result.decimal_scale     = element.decimal_scale;
+  result.decimal_precision = element.decimal_precision;
+  std::transform(element.children_idx.cbegin(),
+                 element.children_idx.cend(),
+                 std::back_inserter(result.children),
+                 [&](auto child_idx) { return convert_schema(schema, child_idx); });
+  return result;
+}
+
+parquet_column_chunk_metadata convert_column_chunk(ColumnChunk const& chunk,
+                                                   std::vector<SchemaElement> const& schema)
+{
+  auto const& meta = chunk.meta_data;
+
+  parquet_column_chunk_metadata result;
+  result.path_in_schema = meta.path_in_schema;
+  result.file_path      = chunk.file_path;
+  result.physical_type  = static_cast<parquet_physical_type>(meta.type);
+  std::transform(meta.encodings.cbegin(),
+                 meta.encodings.cend(),
+                 std::back_inserter(result.encodings),
+                 [](auto encoding) { return static_cast<parquet_encoding>(encoding); });
+  result.codec                   = static_cast<parquet_compression>(meta.codec);
+  result.num_values              = meta.num_values;
+  result.total_uncompressed_size = meta.total_uncompressed_size;
+  result.total_compressed_size   = meta.total_compressed_size;
+  result.data_page_offset        = meta.data_page_offset;
+  if (meta.dictionary_page_offset != 0) {
+    result.dictionary_page_offset = meta.dictionary_page_offset;
+  }
+  if (chunk.schema_idx >= 0 && static_cast<size_t>(chunk.schema_idx) < schema.size()) {
+    result.statistics = convert_statistics(meta.statistics_blob, schema[chunk.schema_idx]);
+  }
+  return result;
+}
+
+}  // namespace
+
+parquet_metadata read_parquet_metadata(datasource* source)
+{
+  auto const footer = read_footer(source);
+  CUDF_EXPECTS(!footer.schema.empty(), "Missing schema in the Parquet footer");
+
+  parquet_metadata result;
+  result.version    = footer.version;
+  result.created_by = footer.created_by;
+  result.num_rows   = footer.num_rows;
+  result.schema     = convert_schema(footer.schema, 0);
+  for (auto const& row_group : footer.row_groups) {
+    parquet_row_group_metadata rg;
+    rg.num_rows        = row_group.num_rows;
+    rg.total_byte_size = row_group.total_byte_size;
+    std::transform(row_group.columns.cbegin(),
+                   row_group.columns.cend(),
+                   std::back_inserter(rg.columns),
+                   [&](auto const& chunk) { return convert_column_chunk(chunk, footer.schema); });
+    result.row_groups.push_back(std::move(rg));
+  }
+  for (auto const& kv : footer.key_value_metadata) {
+    result.key_value_metadata.insert_or_assign(kv.key, kv.value);
+  }
+  return result;
+}
+
+}  // namespace parquet
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -19,10 +19,17 @@
  * @brief cuDF-IO Parquet reader class implementation
  */
 
+#include "bloom_filter.hpp"
+#include "footer_cache.hpp"
 #include "reader_impl.hpp"
+#include "statistics_filter.hpp"
 
 #include <io/comp/gpuinflate.h>
+#include <io/comp/io_uncomp.h>
+#include <io/comp/nvcomp_adapter.hpp>
 #include <io/utilities/config_utils.hpp>
+#include <io/utilities/file_io_utilities.hpp>
+#include <io/utilities/io_read_planner.hpp>
 #include <io/utilities/time_utils.cuh>
 
 #include <cudf/detail/utilities/vector_factories.hpp>
@@ -35,11 +42,12 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
-#include <nvcomp/snappy.h>
-
 #include <algorithm>
 #include <array>
+#include <future>
+#include <map>
 #include <numeric>
+#include <optional>
 #include <regex>
 
 namespace cudf {
@@ -235,6 +243,212 @@ std::tuple<int32_t, int32_t, int8_t> conversion_info(type_id column_type_id,
   return std::make_tuple(type_width, clock_rate, converted_type);
 }
 
+/**
+ * @brief Reads a page index structure (`ColumnIndex` or `OffsetIndex`) of a column chunk
+ *
+ * @param source Source of the file
+ * @param offset File offset of the structure
+ * @param length Size of the structure, in bytes
+ *
+ * @return The parsed structure, or `std::nullopt` if the file does not have a valid one
+ */
+template <typename T>
+std::optional<T> read_page_index(datasource* source, int64_t offset, int32_t length)
+{
+  if (offset <= 0 || length <= 0 || static_cast<size_t>(offset) + length > source->size()) {
+    return std::nullopt;
+  }
+  auto const buffer = source->host_read(offset, length);
+  T index;
+  CompactProtocolReader cp(buffer->data(), buffer->size());
+  if (!cp.read(&index)) { return std::nullopt; }
+  return index;
+}
+
+/**
+ * @brief Reads page index structures (`ColumnIndex` or `OffsetIndex`) of several column chunks of
+ * a source, with a single batched read
+ *
+ * @param source Source of the file
+ * @param locations File offset and size, in bytes, of each structure
+ *
+ * @return The parsed structures, with `std::nullopt` for the ones that are not valid
+ */
+template <typename T>
+std::vector<std::optional<T>> read_page_indexes(
+  datasource* source, std::vector<std::pair<int64_t, int32_t>> const& locations)
+{
+  std::vector<datasource::range> ranges;
+  for (auto const& [offset, length] : locations) {
+    if (offset > 0 && length > 0 && static_cast<size_t>(offset) + length <= source->size()) {
+      ranges.push_back({static_cast<size_t>(offset), static_cast<size_t>(length)});
+    }
+  }
+  auto const buffers = source->host_read_batch(ranges);
+
+  std::vector<std::optional<T>> indexes;
+  auto buffer = buffers.cbegin();
+  for (auto const& [offset, length] : locations) {
+    if (offset <= 0 || length <= 0 || static_cast<size_t>(offset) + length > source->size()) {
+      indexes.emplace_back();
+      continue;
+    }
+    T index;
+    CompactProtocolReader cp((*buffer)->data(), (*buffer)->size());
+    indexes.emplace_back(cp.read(&index) ? std::optional<T>{std::move(index)} : std::nullopt);
+    ++buffer;
+  }
+  return indexes;
+}
+
+/**
+ * @brief Reads the bitset of the split-block Bloom filter of a column chunk
+ *
+ * @param source Source of the file
+ * @param chunk Metadata of the column chunk
+ *
+ * @return The filter bitset, or `std::nullopt` if the chunk does not have a supported filter
+ */
+std::optional<std::vector<uint8_t>> read_bloom_filter(datasource* source,
+                                                      ColumnChunkMetaData const& chunk)
+{
+  // Bloom filter headers are small; the length is optional in the metadata
+  constexpr int64_t max_header_size = 64;
+  auto const offset                 = chunk.bloom_filter_offset;
+  auto const file_size              = static_cast<int64_t>(source->size());
+  if (offset <= 0 || offset >= file_size) { return std::nullopt; }
+  auto const read_size = (chunk.bloom_filter_length > 0)
+                           ? std::min<int64_t>(chunk.bloom_filter_length, file_size - offset)
+                           : std::min<int64_t>(max_header_size, file_size - offset);
+  auto buffer = source->host_read(offset, read_size);
+
+  BloomFilterHeader header;
+  CompactProtocolReader cp(buffer->data(), buffer->size());
+  if (!cp.read(&header) || !header.algorithm.isset.BLOCK || !header.hash.isset.XXHASH ||
+      !header.compression.isset.UNCOMPRESSED || header.num_bytes <= 0 ||
+      header.num_bytes % bloom_filter_block_size != 0) {
+    return std::nullopt;
+  }
+  auto const bitset_offset = offset + cp.bytecount();
+  if (bitset_offset + header.num_bytes > file_size) { return std::nullopt; }
+  if (static_cast<int64_t>(buffer->size()) < cp.bytecount() + header.num_bytes) {
+    buffer = source->host_read(bitset_offset, header.num_bytes);
+    return std::vector<uint8_t>(buffer->data(), buffer->data() + buffer->size());
+  }
+  auto const bitset = buffer->data() + cp.bytecount();
+  return std::vector<uint8_t>(bitset, bitset + header.num_bytes);
+}
+
+/**
+ * @brief File ranges and rows of the pages of a column chunk to read
+ */
+struct page_selection {
+  std::vector<byte_range> ranges;  // File ranges of the pages, in file order
+  int64_t num_values;              // Number of values in the selected data pages
+  size_t start_row;                // Absolute index of the first row of the selected pages
+  size_t num_rows;                 // Number of rows in the selected pages
+};
+
+/**
+ * @brief Selects the data pages of a flat column chunk that overlap the rows to read
+ *
+ * The dictionary page, if any, is located between the start of the chunk and the first data page
+ * and is always selected.
+ *
+ * @param offset_index Offset index of the column chunk
+ * @param chunk_offset File offset of the column chunk
+ * @param row_group_start Absolute index of the first row of the row group
+ * @param row_group_rows Number of rows in the row group
+ * @param skip_rows Absolute index of the first row to read
+ * @param num_rows Number of rows to read
+ *
+ * @return The selected pages, or `std::nullopt` if the offset index is not usable
+ */
+std::optional<page_selection> select_pages(OffsetIndex const& offset_index,
+                                           int64_t chunk_offset,
+                                           size_t row_group_start,
+                                           int64_t row_group_rows,
+                                           size_type skip_rows,
+                                           size_type num_rows)
+{
+  auto const& locations = offset_index.page_locations;
+  if (locations.empty() || locations.front().first_row_index != 0 ||
+      locations.front().offset < chunk_offset) {
+    return std::nullopt;
+  }
+  auto const first_row = std::max<int64_t>(0, int64_t{skip_rows} - int64_t(row_group_start));
+  auto const end_row =
+    std::min<int64_t>(row_group_rows, int64_t{skip_rows} + num_rows - int64_t(row_group_start));
+  auto page_end_row = [&](size_t page) {
+    return page + 1 < locations.size() ? locations[page + 1].first_row_index : row_group_rows;
+  };
+
+  size_t first_page = 0;
+  while (first_page + 1 < locations.size() && page_end_row(first_page) <= first_row) {
+    ++first_page;
+  }
+  auto last_page = first_page;
+  while (last_page + 1 < locations.size() && page_end_row(last_page) < end_row) {
+    ++last_page;
+  }
+
+  page_selection selection;
+  if (locations.front().offset > chunk_offset) {
+    selection.ranges.push_back({static_cast<size_t>(chunk_offset),
+                                static_cast<size_t>(locations.front().offset - chunk_offset)});
+  }
+  auto const pages_offset = static_cast<size_t>(locations[first_page].offset);
+  auto const pages_size   = static_cast<size_t>(locations[last_page].offset +
+                                                 locations[last_page].compressed_page_size) -
+                          pages_offset;
+  if (!selection.ranges.empty() &&
+      selection.ranges.back().offset + selection.ranges.back().size == pages_offset) {
+    selection.ranges.back().size += pages_size;
+  } else {
+    selection.ranges.push_back({pages_offset, pages_size});
+  }
+  // Flat columns have one value per row
+  selection.start_row  = row_group_start + locations[first_page].first_row_index;
+  selection.num_rows   = page_end_row(last_page) - locations[first_page].first_row_index;
+  selection.num_values = selection.num_rows;
+  return selection;
+}
+
+/**
+ * @brief Returns an estimate of the device memory needed to read a column chunk, in bytes
+ *
+ * The compressed and the decompressed pages are both resident while the chunk is decoded. The
+ * decoded values take at least the size of their physical type (dictionary-encoded pages are
+ * smaller than their values), and strings also need an offset per value.
+ *
+ * @param col_meta Metadata of the column chunk
+ * @param schema Schema element of the column
+ */
+size_t estimate_read_size(ColumnChunkMetaData const& col_meta, SchemaElement const& schema)
+{
+  auto const num_values      = static_cast<size_t>(col_meta.num_values);
+  auto const page_data_size  = static_cast<size_t>(col_meta.total_uncompressed_size);
+  auto const compressed_size = col_meta.codec != Compression::UNCOMPRESSED
+                                 ? static_cast<size_t>(col_meta.total_compressed_size)
+                                 : 0;
+  auto const value_size = [&]() -> size_t {
+    switch (schema.type) {
+      case BOOLEAN: return 1;
+      case INT32:
+      case FLOAT: return 4;
+      case INT64:
+      case DOUBLE:
+      case INT96: return 8;
+      case FIXED_LEN_BYTE_ARRAY: return schema.type_length;
+      default: return 0;
+    }
+  }();
+  auto const output_size = schema.type == BYTE_ARRAY
+                             ? page_data_size + num_values * sizeof(size_type)
+                             : num_values * value_size;
+  return compressed_size + page_data_size + output_size;
+}
+
 }  // namespace
 
 std::string name_from_path(const std::vector<std::string>& path_in_schema)
@@ -278,27 +492,7 @@ std::string name_from_path(const std::vector<std::string>& path_in_schema)
  * @brief Class for parsing dataset metadata
  */
 struct metadata : public FileMetaData {
-  explicit metadata(datasource* source)
-  {
-    constexpr auto header_len = sizeof(file_header_s);
-    constexpr auto ender_len  = sizeof(file_ender_s);
-
-    const auto len           = source->size();
-    const auto header_buffer = source->host_read(0, header_len);
-    const auto header        = reinterpret_cast<const file_header_s*>(header_buffer->data());
-    const auto ender_buffer  = source->host_read(len - ender_len, ender_len);
-    const auto ender         = reinterpret_cast<const file_ender_s*>(ender_buffer->data());
-    CUDF_EXPECTS(len > header_len + ender_len, "Incorrect data source");
-    CUDF_EXPECTS(header->magic == parquet_magic && ender->magic == parquet_magic,
-                 "Corrupted header or footer");
-    CUDF_EXPECTS(ender->footer_len != 0 && ender->footer_len <= (len - header_len - ender_len),
-                 "Incorrect footer length");
-
-    const auto buffer = source->host_read(len - ender->footer_len - ender_len, ender->footer_len);
-    CompactProtocolReader cp(buffer->data(), ender->footer_len);
-    CUDF_EXPECTS(cp.read(this), "Cannot parse metadata");
-    CUDF_EXPECTS(cp.InitSchema(this), "Cannot initialize schema");
-  }
+  explicit metadata(datasource* source) : FileMetaData(read_footer(source)) {}
 };
 
 class aggregate_reader_metadata {
@@ -311,12 +505,8 @@ class aggregate_reader_metadata {
    */
   auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const& sources)
   {
-    std::vector<metadata> metadatas;
-    std::transform(
-      sources.cbegin(), sources.cend(), std::back_inserter(metadatas), [](auto const& source) {
-        return metadata(source.get());
-      });
-    return metadatas;
+    return cudf::io::detail::parse_footers(sources,
+                                           [](datasource* source) { return metadata(source); });
   }
 
   /**
@@ -388,9 +578,9 @@ class aggregate_reader_metadata {
     return per_file_metadata[src_idx].row_groups[row_group_index];
   }
 
-  [[nodiscard]] auto const& get_column_metadata(size_type row_group_index,
-                                                size_type src_idx,
-                                                int schema_idx) const
+  [[nodiscard]] auto const& get_column_chunk(size_type row_group_index,
+                                             size_type src_idx,
+                                             int schema_idx) const
   {
     auto col = std::find_if(
       per_file_metadata[src_idx].row_groups[row_group_index].columns.begin(),
@@ -398,7 +588,14 @@ class aggregate_reader_metadata {
       [schema_idx](ColumnChunk const& col) { return col.schema_idx == schema_idx ? true : false; });
     CUDF_EXPECTS(col != std::end(per_file_metadata[src_idx].row_groups[row_group_index].columns),
                  "Found no metadata for schema index");
-    return col->meta_data;
+    return *col;
+  }
+
+  [[nodiscard]] auto const& get_column_metadata(size_type row_group_index,
+                                                size_type src_idx,
+                                                int schema_idx) const
+  {
+    return get_column_chunk(row_group_index, src_idx, schema_idx).meta_data;
   }
 
   [[nodiscard]] auto get_num_rows() const { return num_rows; }
@@ -495,16 +692,6 @@ class aggregate_reader_metadata {
     return names;
   }
 
-  struct row_group_info {
-    size_type const index;
-    size_t const start_row;  // TODO source index
-    size_type const source_index;
-    row_group_info(size_type index, size_t start_row, size_type source_index)
-      : index(index), start_row(start_row), source_index(source_index)
-    {
-    }
-  };
-
   /**
    * @brief Filters and reduces down to a selection of row groups
    *
@@ -562,6 +749,104 @@ class aggregate_reader_metadata {
     return selection;
   }
 
+  /**
+   * @brief Removes the row groups in which the column statistics prove that no row satisfies all
+   * the filters
+   *
+   * Row groups kept by the column chunk statistics are also removed when the page index of a
+   * filtered column excludes each of its pages, or when the Bloom filter of a column proves that
+   * an `EQUAL` predicate does not match. Bloom filters are read last, since they are the largest.
+   *
+   * @param sources Dataset sources, used to read the page indexes
+   * @param row_groups Lists of row group indices to consider, per source; all if empty
+   * @param filters Conjunction of column predicates
+   *
+   * @return Lists of the remaining row group indices per source, and the number of row groups
+   * removed
+   */
+  [[nodiscard]] std::pair<std::vector<std::vector<size_type>>, size_type> filter_row_groups(
+    std::vector<std::unique_ptr<datasource>> const& sources,
+    std::vector<std::vector<size_type>> const& row_groups,
+    std::vector<column_predicate> const& filters) const
+  {
+    CUDF_EXPECTS(row_groups.empty() || row_groups.size() == per_file_metadata.size(),
+                 "Must specify row groups for each source");
+
+    // Resolve the filtered columns; only flat columns carry usable statistics
+    auto const& root = get_schema(0);
+    std::vector<int> filter_schema_idx;
+    for (auto const& filter : filters) {
+      auto const it =
+        std::find_if(root.children_idx.cbegin(), root.children_idx.cend(), [&](auto schema_idx) {
+          return get_schema(schema_idx).name == filter.column_name;
+        });
+      CUDF_EXPECTS(it != root.children_idx.cend(),
+                   "Filter column " + filter.column_name + " not found in the file schema");
+      auto const& schema = get_schema(*it);
+      auto const is_flat = schema.num_children == 0 && schema.repetition_type != REPEATED;
+      filter_schema_idx.push_back(is_flat ? static_cast<int>(*it) : -1);
+    }
+
+    std::vector<std::vector<size_type>> selection(per_file_metadata.size());
+    size_type num_pruned = 0;
+    for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
+      auto const num_row_groups =
+        static_cast<size_type>(per_file_metadata[src_idx].row_groups.size());
+      std::vector<size_type> candidates;
+      if (row_groups.empty()) {
+        candidates.resize(num_row_groups);
+        std::iota(candidates.begin(), candidates.end(), 0);
+      } else {
+        candidates = row_groups[src_idx];
+      }
+
+      for (auto const rg_idx : candidates) {
+        CUDF_EXPECTS(rg_idx >= 0 && rg_idx < num_row_groups, "Invalid rowgroup index");
+        auto const& row_group = get_row_group(rg_idx, src_idx);
+        bool is_excluded      = false;
+        for (size_t f = 0; f < filters.size() && !is_excluded; ++f) {
+          auto const schema_idx = filter_schema_idx[f];
+          if (schema_idx < 0) { continue; }
+          is_excluded = is_chunk_excluded(get_column_metadata(rg_idx, src_idx, schema_idx),
+                                          get_schema(schema_idx),
+                                          row_group.num_rows,
+                                          filters[f]);
+        }
+        for (size_t f = 0; f < filters.size() && !is_excluded; ++f) {
+          auto const schema_idx = filter_schema_idx[f];
+          if (schema_idx < 0) { continue; }
+          auto const& chunk       = get_column_chunk(rg_idx, src_idx, schema_idx);
+          auto const column_index = read_page_index<ColumnIndex>(
+            sources[src_idx].get(), chunk.column_index_offset, chunk.column_index_length);
+          if (!column_index.has_value() || column_index->null_pages.empty()) { continue; }
+          auto const& schema = get_schema(schema_idx);
+          is_excluded        = true;
+          for (size_t page = 0; page < column_index->null_pages.size() && is_excluded; ++page) {
+            is_excluded = is_page_excluded(column_index.value(), page, schema, filters[f]);
+          }
+        }
+        for (size_t f = 0; f < filters.size() && !is_excluded; ++f) {
+          auto const schema_idx = filter_schema_idx[f];
+          if (schema_idx < 0 ||
+              (filters[f].op != predicate_op::EQUAL && filters[f].op != predicate_op::IN)) {
+            continue;
+          }
+          auto const bitset = read_bloom_filter(sources[src_idx].get(),
+                                                get_column_metadata(rg_idx, src_idx, schema_idx));
+          if (!bitset.has_value()) { continue; }
+          is_excluded =
+            is_bloom_filter_excluded(bitset.value(), get_schema(schema_idx), filters[f]);
+        }
+        if (is_excluded) {
+          ++num_pruned;
+        } else {
+          selection[src_idx].push_back(rg_idx);
+        }
+      }
+    }
+    return {std::move(selection), num_pruned};
+  }
+
   /**
    * @brief Filters and reduces down to a selection of columns
    *
@@ -942,55 +1227,96 @@ std::future<void> reader::impl::read_column_chunks(
   hostdevice_vector<gpu::ColumnChunkDesc>& chunks,  // TODO const?
   size_t begin_chunk,
   size_t end_chunk,
-  const std::vector<size_t>& column_chunk_offsets,
+  std::vector<std::vector<byte_range>> const& chunk_ranges,
   std::vector<size_type> const& chunk_source_map,
+  table_metadata& out_metadata,
   rmm::cuda_stream_view stream)
 {
-  // Transfer chunk data, coalescing adjacent chunks
   std::vector<std::future<size_t>> read_tasks;
-  for (size_t chunk = begin_chunk; chunk < end_chunk;) {
-    const size_t io_offset   = column_chunk_offsets[chunk];
-    size_t io_size           = chunks[chunk].compressed_size;
-    size_t next_chunk        = chunk + 1;
-    const bool is_compressed = (chunks[chunk].codec != parquet::Compression::UNCOMPRESSED);
-    while (next_chunk < end_chunk) {
-      const size_t next_offset = column_chunk_offsets[next_chunk];
-      const bool is_next_compressed =
-        (chunks[next_chunk].codec != parquet::Compression::UNCOMPRESSED);
-      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed) {
-        // Can't merge if not contiguous or mixing compressed and uncompressed
-        // Not coalescing uncompressed with compressed chunks is so that compressed buffers can be
-        // freed earlier (immediately after decompression stage) to limit peak memory requirements
-        break;
-      }
-      io_size += chunks[next_chunk].compressed_size;
-      next_chunk++;
+  auto read_to_device = [&](datasource* source, size_t io_offset, size_t io_size, uint8_t* d_dst) {
+    if (source->is_device_read_preferred(io_size)) {
+      read_tasks.emplace_back(source->device_read_async(io_offset, io_size, d_dst, stream));
+    } else {
+      // Keep the host read in flight; the copy to device happens when the task is synchronized
+      auto host_buffer = std::vector<uint8_t>(io_size);
+      auto h_dst       = host_buffer.data();
+      auto copy_fn     = [d_dst, stream](std::vector<uint8_t> host_buffer,
+                                     std::future<size_t> fut_read_size) {
+        auto const read_size = fut_read_size.get();
+        CUDF_EXPECTS(read_size == host_buffer.size(), "Unexpected discrepancy in bytes read.");
+        CUDA_TRY(cudaMemcpyAsync(
+          d_dst, host_buffer.data(), read_size, cudaMemcpyHostToDevice, stream.value()));
+        stream.synchronize();
+        return read_size;
+      };
+      read_tasks.emplace_back(std::async(std::launch::deferred,
+                                         copy_fn,
+                                         std::move(host_buffer),
+                                         source->host_read_async(io_offset, io_size, h_dst)));
     }
-    if (io_size != 0) {
+  };
+
+  // Transfer chunk data, coalescing nearby chunks of the same source.
+  // Compressed and uncompressed chunks are planned separately so that compressed buffers can be
+  // freed earlier (immediately after decompression stage) to limit peak memory requirements
+  std::map<std::pair<size_type, bool>, std::vector<size_t>> chunk_groups;
+  for (size_t chunk = begin_chunk; chunk < end_chunk; ++chunk) {
+    if (chunk_ranges[chunk].size() > 1) {
+      // Chunks trimmed with the page index consist of the dictionary page and of the selected
+      // data pages; the pieces are gathered into a contiguous buffer
       auto& source = _sources[chunk_source_map[chunk]];
-      if (source->is_device_read_preferred(io_size)) {
-        auto buffer        = rmm::device_buffer(io_size, stream);
-        auto fut_read_size = source->device_read_async(
-          io_offset, io_size, static_cast<uint8_t*>(buffer.data()), stream);
-        read_tasks.emplace_back(std::move(fut_read_size));
-        page_data[chunk] = datasource::buffer::create(std::move(buffer));
-      } else {
-        auto const buffer = source->host_read(io_offset, io_size);
-        page_data[chunk] =
-          datasource::buffer::create(rmm::device_buffer(buffer->data(), buffer->size(), stream));
+      auto buffer  = rmm::device_buffer(chunks[chunk].compressed_size, stream);
+      auto d_dst   = static_cast<uint8_t*>(buffer.data());
+      for (auto const& range : chunk_ranges[chunk]) {
+        read_to_device(source.get(), range.offset, range.size, d_dst);
+        d_dst += range.size;
       }
-      auto d_compdata = page_data[chunk]->data();
-      do {
-        chunks[chunk].compressed_data = d_compdata;
-        d_compdata += chunks[chunk].compressed_size;
-      } while (++chunk != next_chunk);
-    } else {
-      chunk = next_chunk;
+      page_data[chunk]              = datasource::buffer::create(std::move(buffer));
+      chunks[chunk].compressed_data = page_data[chunk]->data();
+      continue;
+    }
+    auto const is_compressed = (chunks[chunk].codec != parquet::Compression::UNCOMPRESSED);
+    chunk_groups[{chunk_source_map[chunk], is_compressed}].push_back(chunk);
+  }
+
+  io_read_planner const planner;
+  for (auto const& [group, group_chunks] : chunk_groups) {
+    auto& source = _sources[group.first];
+
+    std::vector<byte_range> ranges;
+    ranges.reserve(group_chunks.size());
+    std::transform(group_chunks.cbegin(),
+                   group_chunks.cend(),
+                   std::back_inserter(ranges),
+                   [&](auto chunk) -> byte_range {
+                     return chunk_ranges[chunk].empty() ? byte_range{0, 0}
+                                                        : chunk_ranges[chunk].front();
+                   });
+    auto const plan = planner.plan(ranges);
+    out_metadata.num_bytes_requested += plan.requested_bytes;
+    out_metadata.num_bytes_over_read += plan.over_read_bytes;
+    out_metadata.num_read_requests_saved += plan.requests_saved;
+
+    // The first chunk that maps to each read owns the read buffer
+    std::vector<uint8_t const*> read_buffers(plan.reads.size(), nullptr);
+    for (size_t r = 0; r < ranges.size(); ++r) {
+      if (ranges[r].size == 0) { continue; }
+      auto const read_idx = plan.read_index[r];
+      auto const chunk    = group_chunks[r];
+      if (read_buffers[read_idx] == nullptr) {
+        auto const io_offset = plan.reads[read_idx].offset;
+        auto const io_size   = plan.reads[read_idx].size;
+        auto buffer          = rmm::device_buffer(io_size, stream);
+        read_to_device(source.get(), io_offset, io_size, static_cast<uint8_t*>(buffer.data()));
+        page_data[chunk]       = datasource::buffer::create(std::move(buffer));
+        read_buffers[read_idx] = page_data[chunk]->data();
+      }
+      chunks[chunk].compressed_data = read_buffers[read_idx] + plan.offset_in_read(r, ranges[r]);
     }
   }
   auto sync_fn = [](decltype(read_tasks) read_tasks) {
     for (auto& task : read_tasks) {
-      task.wait();
+      task.get();
     }
   };
   return std::async(std::launch::deferred, sync_fn, std::move(read_tasks));
@@ -1035,73 +1361,6 @@ void reader::impl::decode_page_headers(hostdevice_vector<gpu::ColumnChunkDesc>&
   pages.device_to_host(stream, true);
 }
 
-void snappy_decompress(device_span<gpu_inflate_input_s> comp_in,
-                       device_span<gpu_inflate_status_s> comp_stat,
-                       size_t max_uncomp_page_size,
-                       rmm::cuda_stream_view stream)
-{
-  size_t num_comp_pages = comp_in.size();
-  size_t temp_size;
-
-  nvcompStatus_t nvcomp_status =
-    nvcompBatchedSnappyDecompressGetTempSize(num_comp_pages, max_uncomp_page_size, &temp_size);
-  CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
-               "Unable to get scratch size for snappy decompression");
-
-  // Not needed now but nvcomp API makes no promises about future
-  rmm::device_buffer scratch(temp_size, stream);
-  // Analogous to comp_in.srcDevice
-  rmm::device_uvector<void const*> compressed_data_ptrs(num_comp_pages, stream);
-  // Analogous to comp_in.srcSize
-  rmm::device_uvector<size_t> compressed_data_sizes(num_comp_pages, stream);
-  // Analogous to comp_in.dstDevice
-  rmm::device_uvector<void*> uncompressed_data_ptrs(num_comp_pages, stream);
-  // Analogous to comp_in.dstSize
-  rmm::device_uvector<size_t> uncompressed_data_sizes(num_comp_pages, stream);
-
-  // Analogous to comp_stat.bytes_written
-  rmm::device_uvector<size_t> actual_uncompressed_data_sizes(num_comp_pages, stream);
-  // Convertible to comp_stat.status
-  rmm::device_uvector<nvcompStatus_t> statuses(num_comp_pages, stream);
-
-  // Prepare the vectors
-  auto comp_it = thrust::make_zip_iterator(compressed_data_ptrs.begin(),
-                                           compressed_data_sizes.begin(),
-                                           uncompressed_data_ptrs.begin(),
-                                           uncompressed_data_sizes.data());
-  thrust::transform(rmm::exec_policy(stream),
-                    comp_in.begin(),
-                    comp_in.end(),
-                    comp_it,
-                    [] __device__(gpu_inflate_input_s in) {
-                      return thrust::make_tuple(in.srcDevice, in.srcSize, in.dstDevice, in.dstSize);
-                    });
-
-  nvcomp_status = nvcompBatchedSnappyDecompressAsync(compressed_data_ptrs.data(),
-                                                     compressed_data_sizes.data(),
-                                                     uncompressed_data_sizes.data(),
-                                                     actual_uncompressed_data_sizes.data(),
-                                                     num_comp_pages,
-                                                     scratch.data(),
-                                                     scratch.size(),
-                                                     uncompressed_data_ptrs.data(),
-                                                     statuses.data(),
-                                                     stream.value());
-  CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
-               "unable to perform snappy decompression");
-
-  CUDF_EXPECTS(thrust::equal(rmm::exec_policy(stream),
-                             uncompressed_data_sizes.begin(),
-                             uncompressed_data_sizes.end(),
-                             actual_uncompressed_data_sizes.begin()),
-               "Mismatch in expected and actual decompressed size during snappy decompression");
-  CUDF_EXPECTS(thrust::equal(rmm::exec_policy(stream),
-                             statuses.begin(),
-                             statuses.end(),
-                             thrust::make_constant_iterator(nvcompStatus_t::nvcompSuccess)),
-               "Error during snappy decompression");
-}
-
 /**
  * @copydoc cudf::io::detail::parquet::decompress_page_data
  */
@@ -1135,9 +1394,21 @@ rmm::device_buffer reader::impl::decompress_page_data(
     int32_t max_decompressed_size;
   };
 
-  std::array<codec_stats, 3> codecs{codec_stats{parquet::GZIP, 0, 0},
+  std::array<codec_stats, 6> codecs{codec_stats{parquet::GZIP, 0, 0},
                                     codec_stats{parquet::SNAPPY, 0, 0},
-                                    codec_stats{parquet::BROTLI, 0, 0}};
+                                    codec_stats{parquet::BROTLI, 0, 0},
+                                    codec_stats{parquet::ZSTD, 0, 0},
+                                    codec_stats{parquet::LZ4, 0, 0},
+                                    codec_stats{parquet::LZ4_RAW, 0, 0}};
+
+  for (size_t c = 0; c < chunks.size(); c++) {
+    auto const codec = chunks[c].codec;
+    CUDF_EXPECTS(codec == parquet::UNCOMPRESSED ||
+                   std::any_of(codecs.cbegin(),
+                               codecs.cend(),
+                               [&](auto const& stats) { return stats.compression_type == codec; }),
+                 "Unsupported Parquet compression type");
+  }
 
   for (auto& codec : codecs) {
     for_each_codec_page(codec.compression_type, [&](size_t page) {
@@ -1193,20 +1464,53 @@ rmm::device_buffer reader::impl::decompress_page_data(
                                cudaMemcpyHostToDevice,
                                stream.value()));
 
+      // Codecs without a device decompressor are decoded on the host, as well as all codecs with a
+      // host decompressor if host decompression is always enabled
+      auto decompress_on_host = [&](int stream_type) {
+        host_decompress(stream_type,
+                        host_span<gpu_inflate_input_s const>(inflate_in.host_ptr(start_pos),
+                                                             argc - start_pos),
+                        host_span<gpu_inflate_status_s>(inflate_out.host_ptr(start_pos),
+                                                        argc - start_pos),
+                        stream);
+        CUDF_EXPECTS(std::all_of(inflate_out.host_ptr(start_pos),
+                                 inflate_out.host_ptr(argc),
+                                 [](auto const& status) { return status.status == 0; }),
+                     "Error during host decompression");
+        // Pages must decompress to exactly their uncompressed size
+        for (auto i = start_pos; i < argc; ++i) {
+          CUDF_EXPECTS(inflate_out[i].bytes_written == inflate_in[i].dstSize,
+                       "Mismatch in expected and actual decompressed size during host "
+                       "decompression");
+        }
+      };
+      bool is_host_decompressed = false;
+      auto const is_host_preferred = host_decompression_integration::is_always_enabled();
+
       switch (codec.compression_type) {
         case parquet::GZIP:
-          CUDA_TRY(gpuinflate(inflate_in.device_ptr(start_pos),
-                              inflate_out.device_ptr(start_pos),
-                              argc - start_pos,
-                              1,
-                              stream))
+          if (is_host_preferred) {
+            decompress_on_host(IO_UNCOMP_STREAM_TYPE_GZIP);
+            is_host_decompressed = true;
+          } else {
+            CUDA_TRY(gpuinflate(inflate_in.device_ptr(start_pos),
+                                inflate_out.device_ptr(start_pos),
+                                argc - start_pos,
+                                1,
+                                stream))
+          }
           break;
         case parquet::SNAPPY:
-          if (nvcomp_integration::is_stable_enabled()) {
-            snappy_decompress(inflate_in_view.subspan(start_pos, argc - start_pos),
-                              inflate_out_view.subspan(start_pos, argc - start_pos),
-                              codec.max_decompressed_size,
-                              stream);
+          if (is_host_preferred) {
+            decompress_on_host(IO_UNCOMP_STREAM_TYPE_SNAPPY);
+            is_host_decompressed = true;
+          } else if (nvcomp_integration::is_stable_enabled()) {
+            nvcomp::batched_decompress(nvcomp::compression_type::SNAPPY,
+                                       inflate_in_view.subspan(start_pos, argc - start_pos),
+                                       inflate_out_view.subspan(start_pos, argc - start_pos),
+                                       codec.max_decompressed_size,
+                                       true,
+                                       stream);
           } else {
             CUDA_TRY(gpu_unsnap(inflate_in.device_ptr(start_pos),
                                 inflate_out.device_ptr(start_pos),
@@ -1222,13 +1526,37 @@ rmm::device_buffer reader::impl::decompress_page_data(
                                 argc - start_pos,
                                 stream));
           break;
+        case parquet::ZSTD:
+          decompress_on_host(IO_UNCOMP_STREAM_TYPE_ZSTD);
+          is_host_decompressed = true;
+          break;
+        case parquet::LZ4:
+          // The legacy LZ4 codec is usually written with the Hadoop block framing
+          decompress_on_host(IO_UNCOMP_STREAM_TYPE_LZ4_HADOOP);
+          is_host_decompressed = true;
+          break;
+        case parquet::LZ4_RAW:
+          if (!is_host_preferred && nvcomp_integration::is_stable_enabled()) {
+            nvcomp::batched_decompress(nvcomp::compression_type::LZ4,
+                                       inflate_in_view.subspan(start_pos, argc - start_pos),
+                                       inflate_out_view.subspan(start_pos, argc - start_pos),
+                                       codec.max_decompressed_size,
+                                       true,
+                                       stream);
+          } else {
+            decompress_on_host(IO_UNCOMP_STREAM_TYPE_LZ4);
+            is_host_decompressed = true;
+          }
+          break;
         default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
       }
-      CUDA_TRY(cudaMemcpyAsync(inflate_out.host_ptr(start_pos),
-                               inflate_out.device_ptr(start_pos),
-                               sizeof(decltype(inflate_out)::value_type) * (argc - start_pos),
-                               cudaMemcpyDeviceToHost,
-                               stream.value()));
+      if (!is_host_decompressed) {
+        CUDA_TRY(cudaMemcpyAsync(inflate_out.host_ptr(start_pos),
+                                 inflate_out.device_ptr(start_pos),
+                                 sizeof(decltype(inflate_out)::value_type) * (argc - start_pos),
+                                 cudaMemcpyDeviceToHost,
+                                 stream.value()));
+      }
     }
   }
   stream.synchronize();
@@ -1240,6 +1568,50 @@ rmm::device_buffer reader::impl::decompress_page_data(
   return decomp_pages;
 }
 
+/**
+ * @copydoc cudf::io::detail::parquet::expand_pages_to_plain
+ */
+rmm::device_buffer reader::impl::expand_pages_to_plain(
+  hostdevice_vector<gpu::ColumnChunkDesc> const& chunks,
+  hostdevice_vector<gpu::PageInfo>& pages,
+  rmm::cuda_stream_view stream)
+{
+  if (std::none_of(pages.host_ptr(), pages.host_ptr() + pages.size(), [](auto const& page) {
+        return gpu::is_expanded_to_plain(page);
+      })) {
+    return {};
+  }
+
+  hostdevice_vector<size_t> plain_offsets(pages.size(), stream);
+  gpu::ComputePlainPageSizes(pages, chunks, plain_offsets, stream);
+  plain_offsets.device_to_host(stream, true);
+
+  // Convert the page sizes into offsets in a single buffer
+  std::vector<size_t> plain_sizes(plain_offsets.host_ptr(),
+                                  plain_offsets.host_ptr() + plain_offsets.size());
+  std::exclusive_scan(
+    plain_sizes.cbegin(), plain_sizes.cend(), plain_offsets.host_ptr(), size_t{0});
+  plain_offsets.host_to_device(stream);
+
+  // The page decoder may read a few bytes past the end of the last value
+  constexpr size_t plain_data_padding = 16;
+  rmm::device_buffer plain_pages(
+    plain_offsets[pages.size() - 1] + plain_sizes.back() + plain_data_padding, stream);
+  auto const plain_base = static_cast<uint8_t*>(plain_pages.data());
+  gpu::ExpandPagesToPlain(pages, chunks, plain_offsets, plain_base, stream);
+
+  // Point the pages at the expanded data, which is decoded like any other PLAIN page
+  for (size_t p = 0; p < pages.size(); p++) {
+    if (!gpu::is_expanded_to_plain(pages[p])) { continue; }
+    pages[p].page_data              = plain_base + plain_offsets[p];
+    pages[p].uncompressed_page_size = static_cast<int32_t>(plain_sizes[p]);
+    pages[p].encoding               = Encoding::PLAIN;
+  }
+  pages.host_to_device(stream);
+
+  return plain_pages;
+}
+
 /**
  * @copydoc cudf::io::detail::parquet::allocate_nesting_info
  */
@@ -1608,16 +1980,228 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
                               _timestamp_type.id());
 }
 
+reader::impl::impl(std::size_t chunk_read_limit,
+                   std::vector<std::unique_ptr<datasource>>&& sources,
+                   parquet_reader_options const& options,
+                   rmm::mr::device_memory_resource* mr)
+  : impl(std::move(sources), options, mr)
+{
+  _chunk_read_limit    = chunk_read_limit;
+  _selected_columns    = options.get_columns();
+  _use_pandas_metadata = options.is_enabled_use_pandas_metadata();
+
+  _selection = select_rows(options.get_skip_rows(),
+                           options.get_num_rows(),
+                           options.get_row_groups(),
+                           options.get_filters());
+  compute_chunks();
+}
+
+reader::impl::row_selection reader::impl::select_rows(
+  size_type skip_rows,
+  size_type num_rows,
+  std::vector<std::vector<size_type>> const& row_group_list,
+  std::vector<column_predicate> const& filters)
+{
+  // Skip row groups in which the statistics prove that no row matches the filters
+  std::vector<std::vector<size_type>> filtered_row_groups;
+  size_type num_row_groups_pruned = 0;
+  if (!filters.empty()) {
+    std::tie(filtered_row_groups, num_row_groups_pruned) =
+      _metadata->filter_row_groups(_sources, row_group_list, filters);
+  }
+
+  // Select only row groups required
+  auto selected_row_groups = _metadata->select_row_groups(
+    filters.empty() ? row_group_list : filtered_row_groups, skip_rows, num_rows);
+
+  return {std::move(selected_row_groups), skip_rows, num_rows, num_row_groups_pruned};
+}
+
+void reader::impl::compute_chunks()
+{
+  auto const& row_groups = _selection.row_groups;
+  auto const rows_begin  = static_cast<size_t>(_selection.skip_rows);
+  auto const rows_end    = rows_begin + _selection.num_rows;
+
+  // Rows of each row group to read, and their estimated size
+  struct row_group_rows {
+    size_t row_group;
+    size_t begin;
+    size_t end;
+    size_t row_size;
+  };
+  std::vector<row_group_rows> row_group_reads;
+  // Locations of the offset indexes of the row groups that don't fit in the limit, per source
+  std::vector<std::vector<std::pair<int64_t, int32_t>>> index_locations(_sources.size());
+  for (size_t r = 0; r < row_groups.size(); ++r) {
+    auto const& rg        = row_groups[r];
+    auto const& row_group = _metadata->get_row_group(rg.index, rg.source_index);
+    auto const begin      = std::max(rg.start_row, rows_begin);
+    auto const end        = std::min(rg.start_row + row_group.num_rows, rows_end);
+    if (begin >= end) { continue; }
+
+    size_t row_group_size = 0;
+    for (auto const& col : _input_columns) {
+      auto const& col_meta =
+        _metadata->get_column_metadata(rg.index, rg.source_index, col.schema_idx);
+      row_group_size += estimate_read_size(col_meta, _metadata->get_schema(col.schema_idx));
+    }
+    auto const row_size = row_group_size / std::max<size_t>(row_group.num_rows, 1);
+    row_group_reads.push_back({r, begin, end, row_size});
+    if (_chunk_read_limit == 0 || (end - begin) * row_size <= _chunk_read_limit) { continue; }
+
+    // Only the pages of flat columns are selected when reading a part of a row group; nested
+    // columns are always read whole, as if they had no offset index
+    for (auto const& col : _input_columns) {
+      auto const& column_chunk =
+        _metadata->get_column_chunk(rg.index, rg.source_index, col.schema_idx);
+      index_locations[rg.source_index].emplace_back(
+        _metadata->get_schema(col.schema_idx).max_repetition_level == 0
+          ? column_chunk.offset_index_offset
+          : 0,
+        column_chunk.offset_index_length);
+    }
+  }
+  std::vector<std::vector<std::optional<OffsetIndex>>> offset_indexes(_sources.size());
+  for (size_t src = 0; src < _sources.size(); ++src) {
+    if (index_locations[src].empty()) { continue; }
+    offset_indexes[src] =
+      read_page_indexes<OffsetIndex>(_sources[src].get(), index_locations[src]);
+  }
+
+  // Ranges of rows of a single row group, each expected to fit in the read limit
+  struct row_range {
+    size_t row_group;
+    size_t begin;
+    size_t end;
+    size_t size;
+  };
+  std::vector<row_range> ranges;
+  std::vector<size_t> next_offset_index(_sources.size(), 0);
+  for (auto const& [r, begin, end, row_size] : row_group_reads) {
+    if (_chunk_read_limit == 0 || (end - begin) * row_size <= _chunk_read_limit) {
+      ranges.push_back({r, begin, end, (end - begin) * row_size});
+      continue;
+    }
+
+    // Split the row group on the page boundaries that all the selected columns share, so that
+    // each page is read by a single range. A row group in which a column has no offset index is
+    // kept whole; any split would read and decompress the whole column chunk again.
+    auto const& rg = row_groups[r];
+    auto const column_offset_indexes =
+      host_span<std::optional<OffsetIndex> const>(offset_indexes[rg.source_index].data() +
+                                                    next_offset_index[rg.source_index],
+                                                  _input_columns.size());
+    next_offset_index[rg.source_index] += _input_columns.size();
+    std::vector<size_t> page_rows;
+    for (size_t c = 0; c < column_offset_indexes.size(); ++c) {
+      auto const& offset_index = column_offset_indexes[c];
+      if (not offset_index.has_value()) {
+        page_rows.clear();
+        break;
+      }
+      std::vector<size_t> column_page_rows;
+      for (auto const& page : offset_index->page_locations) {
+        column_page_rows.push_back(rg.start_row + page.first_row_index);
+      }
+      if (c == 0) {
+        page_rows = std::move(column_page_rows);
+        continue;
+      }
+      std::vector<size_t> shared_page_rows;
+      std::set_intersection(page_rows.cbegin(),
+                            page_rows.cend(),
+                            column_page_rows.cbegin(),
+                            column_page_rows.cend(),
+                            std::back_inserter(shared_page_rows));
+      page_rows = std::move(shared_page_rows);
+    }
+
+    // Each range ends on the last shared page boundary that fits in the limit, or on the first
+    // one past the limit when none fits
+    auto const max_rows = std::max<size_t>(_chunk_read_limit / std::max<size_t>(row_size, 1), 1);
+    for (auto range_begin = begin; range_begin < end;) {
+      auto range_end = end;
+      if (range_begin + max_rows < end) {
+        auto const first_boundary =
+          std::upper_bound(page_rows.cbegin(), page_rows.cend(), range_begin);
+        auto boundary = std::upper_bound(first_boundary, page_rows.cend(), range_begin + max_rows);
+        if (boundary != first_boundary) { boundary = std::prev(boundary); }
+        if (boundary != page_rows.cend() && *boundary < end) { range_end = *boundary; }
+      }
+      ranges.push_back({r, range_begin, range_end, (range_end - range_begin) * row_size});
+      range_begin = range_end;
+    }
+  }
+
+  // Group consecutive ranges of rows into chunks while they fit in the limit
+  _chunks.clear();
+  size_t chunk_size = 0;
+  for (auto const& range : ranges) {
+    auto const fits = _chunk_read_limit == 0 || chunk_size + range.size <= _chunk_read_limit;
+    if (_chunks.empty() || !fits) {
+      _chunks.push_back({range.row_group,
+                         1,
+                         static_cast<size_type>(range.begin),
+                         static_cast<size_type>(range.end - range.begin)});
+      chunk_size = range.size;
+      continue;
+    }
+    auto& chunk          = _chunks.back();
+    chunk.num_row_groups = range.row_group - chunk.first_row_group + 1;
+    chunk.num_rows       = static_cast<size_type>(range.end - chunk.skip_rows);
+    chunk_size += range.size;
+  }
+  // Always return at least one (empty) table
+  if (_chunks.empty()) { _chunks.push_back({0, 0, _selection.skip_rows, 0}); }
+  _current_chunk = 0;
+}
+
+table_with_metadata reader::impl::read_chunk(rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(has_next(), "No more chunks to read");
+
+  // The output buffers are consumed by each read; select them again for the following chunks
+  if (_current_chunk > 0) {
+    std::tie(std::ignore, _output_columns, std::ignore) = _metadata->select_columns(
+      _selected_columns, _use_pandas_metadata, _strings_to_categorical, _timestamp_type.id());
+  }
+
+  auto const& chunk = _chunks[_current_chunk];
+  auto const row_groups =
+    host_span<row_group_info const>(_selection.row_groups.data() + chunk.first_row_group,
+                                    chunk.num_row_groups);
+  // The pruned row groups are reported once, with the first chunk
+  auto const num_row_groups_pruned = _current_chunk == 0 ? _selection.num_row_groups_pruned : 0;
+  ++_current_chunk;
+  return read_row_groups(
+    row_groups, chunk.skip_rows, chunk.num_rows, num_row_groups_pruned, stream);
+}
+
 table_with_metadata reader::impl::read(size_type skip_rows,
                                        size_type num_rows,
                                        std::vector<std::vector<size_type>> const& row_group_list,
+                                       std::vector<column_predicate> const& filters,
                                        rmm::cuda_stream_view stream)
 {
-  // Select only row groups required
-  const auto selected_row_groups =
-    _metadata->select_row_groups(row_group_list, skip_rows, num_rows);
+  auto const selection = select_rows(skip_rows, num_rows, row_group_list, filters);
+  return read_row_groups(selection.row_groups,
+                         selection.skip_rows,
+                         selection.num_rows,
+                         selection.num_row_groups_pruned,
+                         stream);
+}
 
+table_with_metadata reader::impl::read_row_groups(
+  host_span<row_group_info const> selected_row_groups,
+  size_type skip_rows,
+  size_type num_rows,
+  size_type num_row_groups_pruned,
+  rmm::cuda_stream_view stream)
+{
   table_metadata out_metadata;
+  out_metadata.num_row_groups_pruned = num_row_groups_pruned;
 
   // output cudf columns as determined by the top level schema
   std::vector<std::unique_ptr<column>> out_columns;
@@ -1635,8 +2219,8 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     // Tracker for eventually deallocating compressed and uncompressed data
     std::vector<std::unique_ptr<datasource::buffer>> page_data(num_chunks);
 
-    // Keep track of column chunk file offsets
-    std::vector<size_t> column_chunk_offsets(num_chunks);
+    // Keep track of the file ranges of the column chunks
+    std::vector<std::vector<byte_range>> chunk_ranges(num_chunks);
 
     // if there are lists present, we need to preprocess
     bool has_lists = false;
@@ -1644,13 +2228,11 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     // Initialize column chunk information
     size_t total_decompressed_size = 0;
     auto remaining_rows            = num_rows;
-    std::vector<std::future<void>> read_rowgroup_tasks;
     for (const auto& rg : selected_row_groups) {
       const auto& row_group       = _metadata->get_row_group(rg.index, rg.source_index);
       auto const row_group_start  = rg.start_row;
       auto const row_group_source = rg.source_index;
       auto const row_group_rows   = std::min<int>(remaining_rows, row_group.num_rows);
-      auto const io_chunk_idx     = chunks.size();
 
       // generate ColumnChunkDesc objects for everything to be decoded (all input columns)
       for (size_t i = 0; i < num_input_columns; ++i) {
@@ -1680,18 +2262,50 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                           schema.converted_type,
                           schema.type_length);
 
-        column_chunk_offsets[chunks.size()] =
+        auto const chunk_offset =
           (col_meta.dictionary_page_offset != 0)
             ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
             : col_meta.data_page_offset;
-
-        chunks.insert(gpu::ColumnChunkDesc(col_meta.total_compressed_size,
+        auto chunk_pages = page_selection{{{static_cast<size_t>(chunk_offset),
+                                            static_cast<size_t>(col_meta.total_compressed_size)}},
+                                          col_meta.num_values,
+                                          row_group_start,
+                                          static_cast<size_t>(row_group_rows)};
+        // Only fetch the pages of flat columns that overlap the selected rows
+        auto const is_partial_row_group =
+          row_group_start < static_cast<size_t>(skip_rows) ||
+          row_group_start + row_group.num_rows > static_cast<size_t>(skip_rows) + num_rows;
+        if (schema.max_repetition_level == 0 && is_partial_row_group) {
+          auto const& column_chunk =
+            _metadata->get_column_chunk(rg.index, rg.source_index, col.schema_idx);
+          auto const offset_index =
+            read_page_index<OffsetIndex>(_sources[row_group_source].get(),
+                                         column_chunk.offset_index_offset,
+                                         column_chunk.offset_index_length);
+          if (offset_index.has_value()) {
+            chunk_pages = select_pages(offset_index.value(),
+                                       chunk_offset,
+                                       row_group_start,
+                                       row_group.num_rows,
+                                       skip_rows,
+                                       num_rows)
+                            .value_or(chunk_pages);
+          }
+        }
+        chunk_ranges[chunks.size()] = chunk_pages.ranges;
+        auto const compressed_size =
+          std::accumulate(chunk_pages.ranges.cbegin(),
+                          chunk_pages.ranges.cend(),
+                          size_t{0},
+                          [](size_t sum, byte_range const& range) { return sum + range.size; });
+
+        chunks.insert(gpu::ColumnChunkDesc(compressed_size,
                                            nullptr,
-                                           col_meta.num_values,
+                                           chunk_pages.num_values,
                                            schema.type,
                                            type_width,
-                                           row_group_start,
-                                           row_group_rows,
+                                           chunk_pages.start_row,
+                                           chunk_pages.num_rows,
                                            schema.max_definition_level,
                                            schema.max_repetition_level,
                                            _metadata->get_output_nesting_depth(col.schema_idx),
@@ -1711,20 +2325,19 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           total_decompressed_size += col_meta.total_uncompressed_size;
         }
       }
-      // Read compressed chunk data to device memory
-      read_rowgroup_tasks.push_back(read_column_chunks(page_data,
-                                                       chunks,
-                                                       io_chunk_idx,
-                                                       chunks.size(),
-                                                       column_chunk_offsets,
-                                                       chunk_source_map,
-                                                       stream));
-
       remaining_rows -= row_group.num_rows;
     }
-    for (auto& task : read_rowgroup_tasks) {
-      task.wait();
-    }
+    // Read compressed chunk data to device memory; planning all row groups at once allows
+    // coalescing column chunks across row group boundaries
+    read_column_chunks(page_data,
+                       chunks,
+                       0,
+                       chunks.size(),
+                       chunk_ranges,
+                       chunk_source_map,
+                       out_metadata,
+                       stream)
+      .wait();
     assert(remaining_rows <= 0);
 
     // Process dataset chunk pages into output columns
@@ -1742,6 +2355,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           if (chunks[c].codec != parquet::Compression::UNCOMPRESSED) { page_data[c].reset(); }
         }
       }
+      auto const plain_page_data = expand_pages_to_plain(chunks, pages, stream);
 
       // build output column info
       // walk the schema, building out_buffers that mirror what our final cudf columns will look
@@ -1812,6 +2426,8 @@ reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
 {
 }
 
+reader::reader() = default;
+
 // Destructor within this translation unit
 reader::~reader() = default;
 
@@ -1819,8 +2435,32 @@ reader::~reader() = default;
 table_with_metadata reader::read(parquet_reader_options const& options,
                                  rmm::cuda_stream_view stream)
 {
-  return _impl->read(
-    options.get_skip_rows(), options.get_num_rows(), options.get_row_groups(), stream);
+  return _impl->read(options.get_skip_rows(),
+                     options.get_num_rows(),
+                     options.get_row_groups(),
+                     options.get_filters(),
+                     stream);
+}
+
+// Forward to implementation
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::vector<std::unique_ptr<datasource>>&& sources,
+                               parquet_reader_options const& options,
+                               rmm::mr::device_memory_resource* mr)
+{
+  _impl = std::make_unique<impl>(chunk_read_limit, std::move(sources), options, mr);
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk(rmm::cuda_stream_view stream)
+{
+  return _impl->read_chunk(stream);
 }
 
 }  // namespace parquet
@@ -26,10 +26,12 @@
 
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/io_read_planner.hpp>
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/detail/parquet.hpp>
 #include <cudf/io/parquet.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
@@ -48,6 +50,19 @@ using namespace cudf::io;
 // Forward declarations
 class aggregate_reader_metadata;
 
+/**
+ * @brief A row group selected to be read, with its first row in the row space of the selection
+ */
+struct row_group_info {
+  size_type const index;
+  size_t const start_row;
+  size_type const source_index;
+  row_group_info(size_type index, size_t start_row, size_type source_index)
+    : index(index), start_row(start_row), source_index(source_index)
+  {
+  }
+};
+
 /**
  * @brief Implementation for Parquet reader
  */
@@ -64,12 +79,30 @@ class reader::impl {
                 parquet_reader_options const& options,
                 rmm::mr::device_memory_resource* mr);
 
+  /**
+   * @brief Constructor for chunked reading, from a read limit and an array of dataset sources
+   * with reader options.
+   *
+   * The rows selected by the options are split into chunks up front; see `compute_chunks()`.
+   *
+   * @param chunk_read_limit Limit on the device memory used to read each chunk, in bytes, or `0`
+   * to read all the selected rows in a single chunk
+   * @param sources Dataset sources
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit impl(std::size_t chunk_read_limit,
+                std::vector<std::unique_ptr<datasource>>&& sources,
+                parquet_reader_options const& options,
+                rmm::mr::device_memory_resource* mr);
+
   /**
    * @brief Read an entire set or a subset of data and returns a set of columns
    *
    * @param skip_rows Number of rows to skip from the start
    * @param num_rows Number of rows to read
    * @param row_group_indices TODO
+   * @param filters Predicates used to skip row groups based on column statistics
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return The set of columns along with metadata
@@ -77,17 +110,102 @@ class reader::impl {
   table_with_metadata read(size_type skip_rows,
                            size_type num_rows,
                            std::vector<std::vector<size_type>> const& row_group_indices,
+                           std::vector<column_predicate> const& filters,
                            rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Returns whether there are chunks left to read, in chunked reading mode
+   */
+  [[nodiscard]] bool has_next() const { return _current_chunk < _chunks.size(); }
+
+  /**
+   * @brief Reads the next chunk of rows, in chunked reading mode
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream);
+
  private:
+  /**
+   * @brief Rows selected to be read, along with the row groups that hold them
+   */
+  struct row_selection {
+    std::vector<row_group_info> row_groups;
+    size_type skip_rows;              // First selected row, in the row space of the row groups
+    size_type num_rows;               // Number of selected rows
+    size_type num_row_groups_pruned;  // Number of row groups skipped by the filters
+  };
+
+  /**
+   * @brief A range of the selected rows to be read as one chunk
+   */
+  struct chunk_info {
+    size_t first_row_group;  // Index of the first row group of the chunk in the selection
+    size_t num_row_groups;   // Number of row groups holding rows of the chunk
+    size_type skip_rows;     // First row of the chunk, in the row space of the selection
+    size_type num_rows;      // Number of rows of the chunk
+  };
+
+  /**
+   * @brief Selects the row groups to read, skipping the ones excluded by the filters
+   *
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read
+   * @param row_group_indices Lists of row groups to read, one per source; empty to read all
+   * @param filters Predicates used to skip row groups based on column statistics
+   *
+   * @return The selected rows
+   */
+  row_selection select_rows(size_type skip_rows,
+                            size_type num_rows,
+                            std::vector<std::vector<size_type>> const& row_group_indices,
+                            std::vector<column_predicate> const& filters);
+
+  /**
+   * @brief Splits the selected rows into chunks that can each be read within the read limit
+   *
+   * The device memory needed to read a row group is estimated from the metadata of its column
+   * chunks. Consecutive row groups are grouped into a chunk while they fit in the limit; a row
+   * group that doesn't fit on its own is split into ranges of rows aligned to the page boundaries
+   * shared by all the selected columns. The row group is kept whole when a selected column is
+   * nested or has no offset index.
+   */
+  void compute_chunks();
+
+  /**
+   * @brief Reads a range of rows of the selected row groups and returns a set of columns
+   *
+   * @param row_groups Row groups holding the rows to read
+   * @param skip_rows First row to read, in the row space of the row groups
+   * @param num_rows Number of rows to read
+   * @param num_row_groups_pruned Number of row groups skipped by the filters, to report in the
+   * metadata
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_row_groups(host_span<row_group_info const> row_groups,
+                                      size_type skip_rows,
+                                      size_type num_rows,
+                                      size_type num_row_groups_pruned,
+                                      rmm::cuda_stream_view stream);
+
   /**
    * @brief Reads compressed page data to device memory
    *
+   * Nearby column chunks from the same source are coalesced into a single read, as planned by
+   * `io_read_planner`. Chunks stored in multiple file ranges (the dictionary page and the data
+   * pages selected with the page index) are gathered into their own buffer.
+   *
    * @param page_data Buffers to hold compressed page data for each chunk
    * @param chunks List of column chunk descriptors
    * @param begin_chunk Index of first column chunk to read
    * @param end_chunk Index after the last column chunk to read
-   * @param column_chunk_offsets File offset for all chunks
+   * @param chunk_ranges File ranges holding the pages of each chunk, in file order
+   * @param chunk_source_map Index of the source of each chunk
+   * @param out_metadata Metadata to which the statistics of the coalesced reads are added
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    */
@@ -95,8 +213,9 @@ class reader::impl {
                                        hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
                                        size_t begin_chunk,
                                        size_t end_chunk,
-                                       const std::vector<size_t>& column_chunk_offsets,
+                                       std::vector<std::vector<byte_range>> const& chunk_ranges,
                                        std::vector<size_type> const& chunk_source_map,
+                                       table_metadata& out_metadata,
                                        rmm::cuda_stream_view stream);
 
   /**
@@ -134,6 +253,22 @@ class reader::impl {
                                           hostdevice_vector<gpu::PageInfo>& pages,
                                           rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Expands DELTA and BYTE_STREAM_SPLIT pages into PLAIN-encoded pages.
+   *
+   * The page information is updated to point at the expanded data, so that all pages can be
+   * decoded by the same kernel.
+   *
+   * @param chunks List of column chunk descriptors
+   * @param pages List of page information
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Device buffer to expanded page data, empty if no page needs to be expanded
+   */
+  rmm::device_buffer expand_pages_to_plain(hostdevice_vector<gpu::ColumnChunkDesc> const& chunks,
+                                           hostdevice_vector<gpu::PageInfo>& pages,
+                                           rmm::cuda_stream_view stream);
+
   /**
    * @brief Allocate nesting information storage for all pages and set pointers
    *        to it.
@@ -210,6 +345,14 @@ class reader::impl {
 
   bool _strings_to_categorical = false;
   data_type _timestamp_type{type_id::EMPTY};
+
+  // chunked reading state; the output columns are selected again for each chunk
+  std::size_t _chunk_read_limit = 0;
+  std::vector<std::string> _selected_columns;
+  bool _use_pandas_metadata = false;
+  row_selection _selection;
+  std::vector<chunk_info> _chunks;
+  size_t _current_chunk = 0;
 };
 
 }  // namespace parquet
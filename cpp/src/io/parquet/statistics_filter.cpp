@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "statistics_filter.hpp"
+#include "bloom_filter.hpp"
+
+#include <io/utilities/column_predicate.hpp>
+
+#include <cudf/utilities/error.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+namespace cudf {
+namespace io {
+namespace parquet {
+namespace {
+
+/**
+ * @brief Decodes a plain-encoded statistics value.
+ */
+template <typename T>
+std::optional<T> decode_value(std::vector<uint8_t> const& encoded, bool is_set)
+{
+  if (!is_set) { return std::nullopt; }
+  if constexpr (std::is_same_v<T, std::string>) {
+    return std::string(encoded.cbegin(), encoded.cend());
+  } else {
+    if (encoded.size() != sizeof(T)) { return std::nullopt; }
+    T value;
+    std::memcpy(&value, encoded.data(), sizeof(T));
+    return value;
+  }
+}
+
+std::optional<int64_t> null_count(Statistics const& stats)
+{
+  return stats.null_count >= 0 ? std::optional<int64_t>{stats.null_count} : std::nullopt;
+}
+
+/**
+ * @brief Evaluates the predicate against min/max values stored as `Physical` and compared as `T`.
+ */
+template <typename Physical, typename T = Physical>
+bool is_excluded(Statistics const& stats, int64_t num_rows, predicate_op op, T const& value)
+{
+  detail::block_statistics<T> block;
+  block.null_count = null_count(stats);
+  block.num_rows   = num_rows;
+
+  auto const min = decode_value<Physical>(stats.min_value, stats.has_min_value);
+  auto const max = decode_value<Physical>(stats.max_value, stats.has_max_value);
+  if (min.has_value() && max.has_value()) {
+    // NaN bounds don't order the values of the chunk
+    if constexpr (std::is_floating_point_v<Physical>) {
+      if (std::isnan(min.value()) || std::isnan(max.value())) {
+        return detail::is_block_excluded(block, op, value);
+      }
+    }
+    block.min = static_cast<T>(min.value());
+    block.max = static_cast<T>(max.value());
+  }
+  return detail::is_block_excluded(block, op, value);
+}
+
+/**
+ * @brief Evaluates the predicate against the statistics of a block of `num_rows` rows.
+ */
+bool is_block_excluded(Statistics const& stats,
+                       SchemaElement const& schema,
+                       int64_t num_rows,
+                       column_predicate const& predicate)
+{
+  if (predicate.op == predicate_op::IN) {
+    return detail::is_in_list_excluded(predicate, [&](auto const& equal) {
+      return is_block_excluded(stats, schema, num_rows, equal);
+    });
+  }
+
+  auto const op = predicate.op;
+  if (op == predicate_op::IS_NULL || op == predicate_op::IS_NOT_NULL) {
+    detail::block_statistics<int64_t> const null_stats{
+      std::nullopt, std::nullopt, null_count(stats), num_rows};
+    return detail::is_block_excluded(null_stats, op, int64_t{0});
+  }
+
+  auto const* const int_value = std::get_if<int64_t>(&predicate.value);
+  auto const* const fp_value  = std::get_if<double>(&predicate.value);
+  auto const* const str_value = std::get_if<std::string>(&predicate.value);
+  switch (schema.type) {
+    case BOOLEAN:
+    case INT32:
+    case INT64:
+      CUDF_EXPECTS(int_value != nullptr,
+                   "Filter on column " + predicate.column_name + " requires an integer value");
+      if (schema.is_unsigned()) {
+        // Negative values compare lower than the whole column; keep the chunk
+        if (*int_value < 0) { return false; }
+        auto const value = static_cast<uint64_t>(*int_value);
+        return schema.type == INT64 ? is_excluded<uint64_t>(stats, num_rows, op, value)
+                                    : is_excluded<uint32_t, uint64_t>(stats, num_rows, op, value);
+      }
+      if (schema.type == BOOLEAN) {
+        return is_excluded<uint8_t, int64_t>(stats, num_rows, op, *int_value);
+      }
+      return schema.type == INT64 ? is_excluded<int64_t>(stats, num_rows, op, *int_value)
+                                  : is_excluded<int32_t, int64_t>(stats, num_rows, op, *int_value);
+    case FLOAT:
+    case DOUBLE: {
+      CUDF_EXPECTS(str_value == nullptr,
+                   "Filter on column " + predicate.column_name + " requires a numeric value");
+      auto const value = int_value != nullptr ? static_cast<double>(*int_value) : *fp_value;
+      // No value compares equal to NaN; `NOT_EQUAL` would hold for every row
+      if (std::isnan(value)) { return false; }
+      return schema.type == DOUBLE ? is_excluded<double>(stats, num_rows, op, value)
+                                   : is_excluded<float, double>(stats, num_rows, op, value);
+    }
+    case BYTE_ARRAY:
+      // Binary decimals are big-endian and not ordered as byte strings
+      if (schema.converted_type == DECIMAL) { return false; }
+      CUDF_EXPECTS(str_value != nullptr,
+                   "Filter on column " + predicate.column_name + " requires a string value");
+      return is_excluded<std::string>(stats, num_rows, op, *str_value);
+    default: return false;
+  }
+}
+
+}  // namespace
+
+bool is_chunk_excluded(ColumnChunkMetaData const& chunk,
+                       SchemaElement const& schema,
+                       int64_t num_rows,
+                       column_predicate const& predicate)
+{
+  Statistics stats;
+  if (!chunk.statistics_blob.empty()) {
+    CompactProtocolReader cp(chunk.statistics_blob.data(), chunk.statistics_blob.size());
+    if (!cp.read(&stats)) { stats = Statistics{}; }
+  }
+  return is_block_excluded(stats, schema, num_rows, predicate);
+}
+
+bool is_page_excluded(ColumnIndex const& column_index,
+                      size_t page,
+                      SchemaElement const& schema,
+                      column_predicate const& predicate)
+{
+  if (page >= column_index.null_pages.size()) { return false; }
+
+  // The column index does not store the page row counts. Null pages only contain nulls, and other
+  // pages contain at least one value, which is all the null-based operators need to know
+  Statistics stats;
+  int64_t num_rows = std::numeric_limits<int64_t>::max();
+  if (column_index.null_pages[page]) {
+    stats.null_count = 1;
+    num_rows         = 1;
+  } else {
+    if (page < column_index.null_counts.size()) {
+      stats.null_count = column_index.null_counts[page];
+    }
+    if (page < column_index.min_values.size() && page < column_index.max_values.size()) {
+      auto const& min_value = column_index.min_values[page];
+      auto const& max_value = column_index.max_values[page];
+      stats.min_value.assign(min_value.cbegin(), min_value.cend());
+      stats.max_value.assign(max_value.cbegin(), max_value.cend());
+      stats.has_min_value = true;
+      stats.has_max_value = true;
+    }
+  }
+  return is_block_excluded(stats, schema, num_rows, predicate);
+}
+
+bool is_bloom_filter_excluded(std::vector<uint8_t> const& bitset,
+                              SchemaElement const& schema,
+                              column_predicate const& predicate)
+{
+  if (predicate.op == predicate_op::IN) {
+    return detail::is_in_list_excluded(predicate, [&](auto const& equal) {
+      return is_bloom_filter_excluded(bitset, schema, equal);
+    });
+  }
+  if (predicate.op != predicate_op::EQUAL || schema.is_unsigned()) { return false; }
+
+  auto const* const int_value = std::get_if<int64_t>(&predicate.value);
+  auto const* const fp_value  = std::get_if<double>(&predicate.value);
+  auto const* const str_value = std::get_if<std::string>(&predicate.value);
+  auto may_contain            = [&](auto const& v) {
+    return bloom_filter_may_contain(
+      bitset.data(), bitset.size(), xxhash64(reinterpret_cast<uint8_t const*>(&v), sizeof(v)));
+  };
+  switch (schema.type) {
+    case INT32:
+      if (int_value == nullptr || *int_value < std::numeric_limits<int32_t>::min() ||
+          *int_value > std::numeric_limits<int32_t>::max()) {
+        return false;
+      }
+      return !may_contain(static_cast<int32_t>(*int_value));
+    case INT64: return int_value != nullptr && !may_contain(*int_value);
+    case FLOAT:
+    case DOUBLE: {
+      if (str_value != nullptr) { return false; }
+      auto const value = int_value != nullptr ? static_cast<double>(*int_value) : *fp_value;
+      // Zero and NaN values have multiple encodings
+      if (value == 0 || std::isnan(value)) { return false; }
+      if (schema.type == DOUBLE) { return !may_contain(value); }
+      auto const float_value = static_cast<float>(value);
+      return static_cast<double>(float_value) == value && !may_contain(float_value);
+    }
+    case BYTE_ARRAY:
+      if (schema.converted_type == DECIMAL || str_value == nullptr) { return false; }
+      return !bloom_filter_may_contain(
+        bitset.data(),
+        bitset.size(),
+        xxhash64(reinterpret_cast<uint8_t const*>(str_value->data()), str_value->size()));
+    default: return false;
+  }
+}
+
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
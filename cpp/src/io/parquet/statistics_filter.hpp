@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file statistics_filter.hpp
+ * @brief Evaluation of reader filters against Parquet statistics and Bloom filters
+ */
+
+#pragma once
+
+#include "parquet.hpp"
+
+#include <cudf/io/types.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace parquet {
+
+/**
+ * @brief Returns whether the column chunk statistics prove that no row of the row group satisfies
+ * the predicate.
+ *
+ * Chunks without statistics, or with statistics whose ordering is not known (e.g. INT96 and
+ * FIXED_LEN_BYTE_ARRAY columns), are never excluded.
+ *
+ * @throw cudf::logic_error if the predicate value cannot be compared with the column type
+ *
+ * @param chunk Metadata of the column chunk, including its encoded statistics
+ * @param schema Schema element of the (leaf) column
+ * @param num_rows Number of rows in the row group
+ * @param predicate Predicate to evaluate
+ *
+ * @return `true` if the row group can be skipped
+ */
+bool is_chunk_excluded(ColumnChunkMetaData const& chunk,
+                       SchemaElement const& schema,
+                       int64_t num_rows,
+                       column_predicate const& predicate);
+
+/**
+ * @brief Returns whether the column index proves that no row of a page satisfies the predicate.
+ *
+ * @throw cudf::logic_error if the predicate value cannot be compared with the column type
+ *
+ * @param column_index Column index of the column chunk
+ * @param page Index of the data page in the column chunk
+ * @param schema Schema element of the (leaf) column
+ * @param predicate Predicate to evaluate
+ *
+ * @return `true` if the page can be skipped
+ */
+bool is_page_excluded(ColumnIndex const& column_index,
+                      size_t page,
+                      SchemaElement const& schema,
+                      column_predicate const& predicate);
+
+/**
+ * @brief Returns whether the Bloom filter of a column chunk proves that no row of the row group
+ * satisfies the predicate.
+ *
+ * Only `EQUAL` and `IN` predicates can be evaluated. Values that have multiple plain encodings
+ * (e.g. zero floating-point values) and unsigned columns are never excluded.
+ *
+ * @param bitset Split-block Bloom filter bitset of the column chunk
+ * @param schema Schema element of the (leaf) column
+ * @param predicate Predicate to evaluate
+ *
+ * @return `true` if the row group can be skipped
+ */
+bool is_bloom_filter_excluded(std::vector<uint8_t> const& bitset,
+                              SchemaElement const& schema,
+                              column_predicate const& predicate);
+
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
@@ -22,7 +22,10 @@
 #include "writer_impl.hpp"
 #include <io/statistics/column_statistics.cuh>
 
+#include "bloom_filter.hpp"
 #include "compact_protocol_writer.hpp"
+#include <io/comp/io_comp.h>
+#include <io/comp/nvcomp_adapter.hpp>
 #include <io/utilities/column_utils.cuh>
 #include <io/utilities/config_utils.hpp>
 
@@ -39,11 +42,10 @@
 #include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
 
-#include <nvcomp/snappy.h>
-
 #include <thrust/binary_search.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <numeric>
 #include <utility>
@@ -70,6 +72,9 @@ parquet::Compression to_parquet_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return parquet::Compression::SNAPPY;
+    case compression_type::GZIP: return parquet::Compression::GZIP;
+    case compression_type::LZ4: return parquet::Compression::LZ4_RAW;
+    case compression_type::ZSTD: return parquet::Compression::ZSTD;
     case compression_type::NONE: return parquet::Compression::UNCOMPRESSED;
     default:
       CUDF_EXPECTS(false, "Unsupported compression type");
@@ -77,6 +82,109 @@ parquet::Compression to_parquet_compression(compression_type compression)
   }
 }
 
+/**
+ * @brief Returns the stream type of the host compressor used for a parquet compression codec
+ */
+int to_host_stream_type(parquet::Compression compression)
+{
+  switch (compression) {
+    case parquet::Compression::GZIP: return IO_UNCOMP_STREAM_TYPE_GZIP;
+    case parquet::Compression::LZ4_RAW: return IO_UNCOMP_STREAM_TYPE_LZ4;
+    case parquet::Compression::ZSTD: return IO_UNCOMP_STREAM_TYPE_ZSTD;
+    default: CUDF_FAIL("Unsupported compression type");
+  }
+}
+
+/**
+ * @brief Returns whether pages compressed with `compression` are compressed with nvCOMP
+ */
+bool use_nvcomp(parquet::Compression compression)
+{
+  return (compression == parquet::Compression::SNAPPY or
+          compression == parquet::Compression::LZ4_RAW) and
+         nvcomp_integration::is_stable_enabled();
+}
+
+/**
+ * @brief Returns the nvCOMP compression type of a parquet compression codec
+ */
+nvcomp::compression_type to_nvcomp_compression(parquet::Compression compression)
+{
+  return compression == parquet::Compression::LZ4_RAW ? nvcomp::compression_type::LZ4
+                                                      : nvcomp::compression_type::SNAPPY;
+}
+
+/**
+ * @brief Returns the space to reserve for each compressed page, for pages of up to
+ * `max_page_uncomp_data_size` bytes
+ */
+size_t max_compressed_page_size(parquet::Compression compression,
+                                std::optional<int> compression_level,
+                                size_t max_page_uncomp_data_size)
+{
+  switch (compression) {
+    case parquet::Compression::UNCOMPRESSED: return 0;
+    // The GPU snappy compressor shares the bound of nvCOMP
+    case parquet::Compression::SNAPPY:
+      return nvcomp::batched_compress_get_max_output_chunk_size(nvcomp::compression_type::SNAPPY,
+                                                                max_page_uncomp_data_size);
+    default:
+      if (use_nvcomp(compression)) {
+        return nvcomp::batched_compress_get_max_output_chunk_size(
+          to_nvcomp_compression(compression), max_page_uncomp_data_size);
+      }
+      return HostCompressor::Create(to_host_stream_type(compression), compression_level)
+        ->GetMaxCompressedSize(max_page_uncomp_data_size);
+  }
+}
+
+/**
+ * @brief Builds the page index (column index and offset index) of an encoded column chunk
+ *
+ * The page statistics are taken from the encoded data page headers.
+ *
+ * @param ck Encoded column chunk
+ * @param pages Host copy of the pages of the chunk
+ * @param chunk_data Host copy of the chunk data (page headers and page data)
+ * @param chunk_offset Offset of the chunk data in the file
+ *
+ * @return The column index and the offset index of the chunk
+ */
+std::pair<ColumnIndex, OffsetIndex> build_page_index(gpu::EncColumnChunk const& ck,
+                                                     host_span<gpu::EncPage const> pages,
+                                                     uint8_t const* chunk_data,
+                                                     size_t chunk_offset)
+{
+  ColumnIndex column_index;
+  OffsetIndex offset_index;
+  size_t page_offset = 0;
+  for (auto const& page : pages) {
+    auto const page_size = page.hdr_size + page.max_data_size;
+    if (page.page_type == PageType::DATA_PAGE) {
+      PageHeader header;
+      CompactProtocolReader cp(chunk_data + page_offset, page.hdr_size);
+      CUDF_EXPECTS(cp.read(&header), "Cannot parse encoded page header");
+      auto const& stats = header.data_page_header.statistics;
+      // Pages of NaN values have no min/max but are not null pages
+      auto const is_null_page = stats.null_count == header.data_page_header.num_values;
+      column_index.null_pages.push_back(is_null_page);
+      column_index.min_values.emplace_back(is_null_page ? std::string{}
+                                                        : std::string(stats.min_value.cbegin(),
+                                                                      stats.min_value.cend()));
+      column_index.max_values.emplace_back(is_null_page ? std::string{}
+                                                        : std::string(stats.max_value.cbegin(),
+                                                                      stats.max_value.cend()));
+      column_index.null_counts.push_back(std::max<int64_t>(stats.null_count, 0));
+      offset_index.page_locations.push_back(
+        {static_cast<int64_t>(chunk_offset + page_offset),
+         static_cast<int32_t>(page_size),
+         static_cast<int64_t>(page.start_row) - static_cast<int64_t>(ck.start_row)});
+    }
+    page_offset += page_size;
+  }
+  return {std::move(column_index), std::move(offset_index)};
+}
+
 }  // namespace
 
 struct aggregate_writer_metadata {
@@ -180,6 +288,11 @@ struct aggregate_writer_metadata {
     int64_t num_rows = 0;
     std::vector<RowGroup> row_groups;
     std::vector<KeyValue> key_value_metadata;
+    // Page index and Bloom filter bitset of each column chunk, indexed by row group and column;
+    // written before the footer
+    std::vector<std::vector<ColumnIndex>> column_indexes;
+    std::vector<std::vector<OffsetIndex>> offset_indexes;
+    std::vector<std::vector<std::vector<uint8_t>>> bloom_filters;
   };
   std::vector<per_file_metadata> files;
   std::string created_by         = "";
@@ -249,6 +362,9 @@ struct schema_tree_node : public SchemaElement {
   LinkedColPtr leaf_column;
   statistics_dtype stats_dtype;
   int32_t ts_scale;
+  double bloom_filter_fpp    = 0;  // False positive probability of the Bloom filter; 0 if disabled
+  // Whether the values use the BYTE_STREAM_SPLIT encoding
+  bool use_byte_stream_split = false;
 
   // TODO(fut): Think about making schema a class that holds a vector of schema_tree_nodes. The
   // function construct_schema_tree could be its constructor. It can have method to get the per
@@ -649,6 +765,12 @@ std::vector<schema_tree_node> construct_schema_tree(LinkedColVector const& linke
         col_schema.name = (schema[parent_idx].name == "list") ? "element" : col_meta.get_name();
         col_schema.parent_idx  = parent_idx;
         col_schema.leaf_column = col;
+        if (col_meta.is_bloom_filter_enabled()) {
+          col_schema.bloom_filter_fpp = col_meta.get_bloom_filter_fpp();
+        }
+        col_schema.use_byte_stream_split =
+          col_meta.is_enabled_byte_stream_split() and
+          (col_schema.type == Type::FLOAT or col_schema.type == Type::DOUBLE);
         schema.push_back(col_schema);
       }
     };
@@ -683,6 +805,8 @@ struct parquet_column_view {
 
   [[nodiscard]] column_view cudf_column_view() const { return cudf_col; }
   [[nodiscard]] parquet::Type physical_type() const { return schema_node.type; }
+  [[nodiscard]] double bloom_filter_fpp() const { return schema_node.bloom_filter_fpp; }
+  [[nodiscard]] bool use_byte_stream_split() const { return schema_node.use_byte_stream_split; }
 
   std::vector<std::string> const& get_path_in_schema() { return path_in_schema; }
 
@@ -884,6 +1008,31 @@ void writer::impl::init_page_sizes(hostdevice_2dvector<gpu::EncColumnChunk>& chu
   chunks.device_to_host(stream, true);
 }
 
+/**
+ * @brief Returns whether the estimated cardinality of a chunk rules out dictionary encoding.
+ *
+ * The dictionary of the chunk is assumed to be too large, or larger than the plain encoded data,
+ * only when this holds for an estimate several standard errors below the sketch estimate, so that
+ * estimation errors fall back to the exact dictionary pass.
+ */
+bool is_dictionary_unprofitable(gpu::EncColumnChunk const& chunk)
+{
+  if (chunk.est_dict_entries < 0 or chunk.num_values == 0) { return false; }
+
+  // Four standard errors of the HyperLogLog estimate
+  auto const margin = 4 * 1.04 / std::sqrt(static_cast<double>(gpu::CARDINALITY_SKETCH_SIZE));
+  auto const min_num_entries = static_cast<size_type>(chunk.est_dict_entries * (1 - margin));
+  if (min_num_entries > MAX_DICT_SIZE) { return true; }
+
+  // Distinct values are assumed to be as large as the average value of the chunk
+  auto const avg_value_size = static_cast<double>(chunk.plain_data_size) / chunk.num_values;
+  auto const nbits = CompactProtocolReader::NumRequiredBits(std::max(min_num_entries - 1, 0));
+  auto const min_dict_enc_size =
+    min_num_entries * avg_value_size + util::div_rounding_up_safe<int64_t>(
+                                         static_cast<int64_t>(chunk.num_values) * nbits, 8);
+  return min_dict_enc_size >= chunk.plain_data_size;
+}
+
 auto build_chunk_dictionaries(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
                               host_span<gpu::parquet_column_device_view const> col_desc,
                               device_2dspan<gpu::PageFragment const> frags,
@@ -899,11 +1048,36 @@ auto build_chunk_dictionaries(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
 
   if (h_chunks.size() == 0) { return std::make_pair(std::move(dict_data), std::move(dict_index)); }
 
+  auto const can_use_dictionary = [&](gpu::EncColumnChunk const& chunk) {
+    return col_desc[chunk.col_desc_id].physical_type != Type::BOOLEAN and
+           not chunk.use_byte_stream_split and chunk.num_values > 0;
+  };
+
+  // Estimate the number of distinct values of each chunk with a HyperLogLog sketch, so that the
+  // chunks that can't benefit from a dictionary skip the (much more expensive) hash map pass
+  auto const num_sketches = std::count_if(h_chunks.begin(), h_chunks.end(), can_use_dictionary);
+  rmm::device_uvector<uint32_t> sketches(num_sketches * gpu::CARDINALITY_SKETCH_SIZE, stream);
+  CUDA_TRY(cudaMemsetAsync(sketches.data(), 0, sketches.size() * sizeof(uint32_t), stream.value()));
+  size_t sketch_idx = 0;
+  for (auto& chunk : h_chunks) {
+    chunk.est_dict_entries = -1;
+    chunk.hll_sketch       = can_use_dictionary(chunk)
+                               ? sketches.data() + gpu::CARDINALITY_SKETCH_SIZE * sketch_idx++
+                               : nullptr;
+  }
+  if (num_sketches > 0) {
+    chunks.host_to_device(stream);
+    gpu::populate_chunk_cardinality_sketches(chunks, frags, stream);
+    gpu::estimate_chunk_cardinalities(chunks.device_view().flat_view(), stream);
+    chunks.device_to_host(stream, true);
+  }
+
   // Allocate slots for each chunk
   std::vector<rmm::device_uvector<gpu::slot_type>> hash_maps_storage;
   hash_maps_storage.reserve(h_chunks.size());
   for (auto& chunk : h_chunks) {
-    if (col_desc[chunk.col_desc_id].physical_type == Type::BOOLEAN) {
+    chunk.hll_sketch = nullptr;
+    if (not can_use_dictionary(chunk) or is_dictionary_unprofitable(chunk)) {
       chunk.use_dictionary = false;
     } else {
       chunk.use_dictionary = true;
@@ -970,6 +1144,82 @@ auto build_chunk_dictionaries(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
   return std::make_pair(std::move(dict_data), std::move(dict_index));
 }
 
+/**
+ * @brief Returns whether Bloom filters can be built for a column of the given physical type
+ */
+bool is_bloom_filter_supported(Type physical_type)
+{
+  switch (physical_type) {
+    case Type::INT32:
+    case Type::INT64:
+    case Type::FLOAT:
+    case Type::DOUBLE:
+    case Type::BYTE_ARRAY: return true;
+    default: return false;
+  }
+}
+
+/**
+ * @brief Builds the Bloom filters of the column chunks
+ *
+ * Filters are sized for the number of distinct values of the chunk when the chunk is dictionary
+ * encoded, and for its number of values otherwise. Must be called after the dictionaries are
+ * built.
+ *
+ * @param chunks Column chunks [rowgroup][column]
+ * @param bloom_filter_fpp False positive probability of the filter of each column; 0 for none
+ * @param frags Column fragments
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Filter bitset of each chunk, in the flattened order of `chunks`; empty if no chunk has a
+ * filter
+ */
+std::vector<std::vector<uint8_t>> build_chunk_bloom_filters(
+  hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
+  host_span<double const> bloom_filter_fpp,
+  device_2dspan<gpu::PageFragment const> frags,
+  rmm::cuda_stream_view stream)
+{
+  auto h_chunks = chunks.host_view().flat_view();
+
+  std::vector<size_t> filter_offsets(h_chunks.size() + 1, 0);
+  for (size_t c = 0; c < h_chunks.size(); ++c) {
+    auto const& ck          = h_chunks[c];
+    auto const fpp          = bloom_filter_fpp[ck.col_desc_id];
+    auto const num_distinct = ck.use_dictionary ? ck.num_dict_entries : ck.num_values;
+    auto const filter_size  = (fpp > 0) ? bloom_filter_size(num_distinct, fpp) : 0;
+    filter_offsets[c + 1]   = filter_offsets[c] + filter_size;
+  }
+  if (filter_offsets.back() == 0) { return {}; }
+
+  rmm::device_buffer filters(filter_offsets.back(), stream);
+  CUDA_TRY(cudaMemsetAsync(filters.data(), 0, filters.size(), stream.value()));
+  for (size_t c = 0; c < h_chunks.size(); ++c) {
+    auto& ck             = h_chunks[c];
+    ck.bloom_filter_size = filter_offsets[c + 1] - filter_offsets[c];
+    ck.bloom_filter      = (ck.bloom_filter_size != 0)
+                             ? reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(filters.data()) +
+                                                           filter_offsets[c])
+                             : nullptr;
+  }
+  chunks.host_to_device(stream);
+  gpu::populate_chunk_bloom_filters(chunks, frags, stream);
+
+  auto const h_filters = cudf::detail::make_std_vector_sync(
+    device_span<uint8_t const>{static_cast<uint8_t const*>(filters.data()), filters.size()},
+    stream);
+
+  // The filters are copied to the host; clear the device pointers that are about to be freed
+  std::vector<std::vector<uint8_t>> bitsets(h_chunks.size());
+  for (size_t c = 0; c < h_chunks.size(); ++c) {
+    bitsets[c].assign(h_filters.begin() + filter_offsets[c],
+                      h_filters.begin() + filter_offsets[c + 1]);
+    h_chunks[c].bloom_filter = nullptr;
+  }
+  chunks.host_to_device(stream);
+  return bitsets;
+}
+
 void writer::impl::init_encoder_pages(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
                                       device_span<gpu::parquet_column_device_view const> col_desc,
                                       device_span<gpu::EncPage> pages,
@@ -1005,79 +1255,6 @@ void writer::impl::init_encoder_pages(hostdevice_2dvector<gpu::EncColumnChunk>&
   stream.synchronize();
 }
 
-void snappy_compress(device_span<gpu_inflate_input_s const> comp_in,
-                     device_span<gpu_inflate_status_s> comp_stat,
-                     size_t max_page_uncomp_data_size,
-                     rmm::cuda_stream_view stream)
-{
-  size_t num_comp_pages = comp_in.size();
-  try {
-    size_t temp_size;
-    nvcompStatus_t nvcomp_status = nvcompBatchedSnappyCompressGetTempSize(
-      num_comp_pages, max_page_uncomp_data_size, nvcompBatchedSnappyDefaultOpts, &temp_size);
-
-    CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
-                 "Error in getting snappy compression scratch size");
-
-    // Not needed now but nvcomp API makes no promises about future
-    rmm::device_buffer scratch(temp_size, stream);
-    // Analogous to comp_in.srcDevice
-    rmm::device_uvector<void const*> uncompressed_data_ptrs(num_comp_pages, stream);
-    // Analogous to comp_in.srcSize
-    rmm::device_uvector<size_t> uncompressed_data_sizes(num_comp_pages, stream);
-    // Analogous to comp_in.dstDevice
-    rmm::device_uvector<void*> compressed_data_ptrs(num_comp_pages, stream);
-    // Analogous to comp_stat.bytes_written
-    rmm::device_uvector<size_t> compressed_bytes_written(num_comp_pages, stream);
-    // nvcomp does not currently use comp_in.dstSize. Cannot assume that the output will fit in
-    // the space allocated unless one uses the API nvcompBatchedSnappyCompressGetOutputSize()
-
-    // Prepare the vectors
-    auto comp_it = thrust::make_zip_iterator(uncompressed_data_ptrs.begin(),
-                                             uncompressed_data_sizes.begin(),
-                                             compressed_data_ptrs.begin());
-    thrust::transform(rmm::exec_policy(stream),
-                      comp_in.begin(),
-                      comp_in.end(),
-                      comp_it,
-                      [] __device__(gpu_inflate_input_s in) {
-                        return thrust::make_tuple(in.srcDevice, in.srcSize, in.dstDevice);
-                      });
-    nvcomp_status = nvcompBatchedSnappyCompressAsync(uncompressed_data_ptrs.data(),
-                                                     uncompressed_data_sizes.data(),
-                                                     max_page_uncomp_data_size,
-                                                     num_comp_pages,
-                                                     scratch.data(),  // Not needed rn but future
-                                                     scratch.size(),
-                                                     compressed_data_ptrs.data(),
-                                                     compressed_bytes_written.data(),
-                                                     nvcompBatchedSnappyDefaultOpts,
-                                                     stream.value());
-
-    CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess, "Error in snappy compression");
-
-    // nvcomp also doesn't use comp_out.status . It guarantees that given enough output space,
-    // compression will succeed.
-    // The other `comp_out` field is `reserved` which is for internal cuIO debugging and can be 0.
-    thrust::transform(rmm::exec_policy(stream),
-                      compressed_bytes_written.begin(),
-                      compressed_bytes_written.end(),
-                      comp_stat.begin(),
-                      [] __device__(size_t size) {
-                        gpu_inflate_status_s status{};
-                        status.bytes_written = size;
-                        return status;
-                      });
-    return;
-  } catch (...) {
-    // If we reach this then there was an error in compressing so set an error status for each page
-    thrust::for_each(rmm::exec_policy(stream),
-                     comp_stat.begin(),
-                     comp_stat.end(),
-                     [] __device__(gpu_inflate_status_s & stat) { stat.status = 1; });
-  };
-}
-
 void writer::impl::encode_pages(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
                                 device_span<gpu::EncPage> pages,
                                 size_t max_page_uncomp_data_size,
@@ -1105,15 +1282,19 @@ void writer::impl::encode_pages(hostdevice_2dvector<gpu::EncColumnChunk>& chunks
   device_span<gpu_inflate_status_s> comp_stat{compression_status.data(), compression_status.size()};
 
   gpu::EncodePages(batch_pages, comp_in, comp_stat, stream);
-  switch (compression_) {
-    case parquet::Compression::SNAPPY:
-      if (nvcomp_integration::is_stable_enabled()) {
-        snappy_compress(comp_in, comp_stat, max_page_uncomp_data_size, stream);
-      } else {
-        CUDA_TRY(gpu_snap(comp_in.data(), comp_stat.data(), pages_in_batch, stream));
-      }
-      break;
-    default: break;
+  if (compression_ != parquet::Compression::UNCOMPRESSED) {
+    if (use_nvcomp(compression_)) {
+      nvcomp::batched_compress(to_nvcomp_compression(compression_),
+                               comp_in,
+                               comp_stat,
+                               max_page_uncomp_data_size,
+                               stream);
+    } else if (compression_ == parquet::Compression::SNAPPY) {
+      CUDA_TRY(gpu_snap(comp_in.data(), comp_stat.data(), pages_in_batch, stream));
+    } else {
+      host_compress(
+        to_host_stream_type(compression_), compression_level_, comp_in, comp_stat, stream);
+    }
   }
   // TBD: Not clear if the official spec actually allows dynamically turning off compression at the
   // chunk-level
@@ -1141,6 +1322,7 @@ writer::impl::impl(std::vector<std::unique_ptr<data_sink>> sinks,
     max_row_group_size{options.get_row_group_size_bytes()},
     max_row_group_rows{options.get_row_group_size_rows()},
     compression_(to_parquet_compression(options.get_compression())),
+    compression_level_(options.get_compression_level()),
     stats_granularity_(options.get_stats_level()),
     int96_timestamps(options.is_enabled_int96_timestamps()),
     kv_md(options.get_key_value_metadata()),
@@ -1163,6 +1345,7 @@ writer::impl::impl(std::vector<std::unique_ptr<data_sink>> sinks,
     max_row_group_size{options.get_row_group_size_bytes()},
     max_row_group_rows{options.get_row_group_size_rows()},
     compression_(to_parquet_compression(options.get_compression())),
+    compression_level_(options.get_compression_level()),
     stats_granularity_(options.get_stats_level()),
     int96_timestamps(options.is_enabled_int96_timestamps()),
     kv_md(options.get_key_value_metadata()),
@@ -1368,10 +1551,11 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
         ck.fragments   = &fragments.device_view()[c][f];
         ck.stats =
           (not frag_stats.is_empty()) ? frag_stats.data() + c * num_fragments + f : nullptr;
-        ck.start_row         = start_row;
-        ck.num_rows          = (uint32_t)row_group.num_rows;
-        ck.first_fragment    = c * num_fragments + f;
-        auto chunk_fragments = fragments[c].subspan(f, fragments_in_chunk);
+        ck.start_row             = start_row;
+        ck.num_rows              = (uint32_t)row_group.num_rows;
+        ck.first_fragment        = c * num_fragments + f;
+        ck.use_byte_stream_split = parquet_columns[c].use_byte_stream_split();
+        auto chunk_fragments     = fragments[c].subspan(f, fragments_in_chunk);
         // In fragment struct, add a pointer to the chunk it belongs to
         // In each fragment in chunk_fragments, update the chunk pointer here.
         for (auto& frag : chunk_fragments) {
@@ -1387,7 +1571,8 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
           });
         auto& column_chunk_meta          = row_group.columns[c].meta_data;
         column_chunk_meta.type           = parquet_columns[c].physical_type();
-        column_chunk_meta.encodings      = {Encoding::PLAIN, Encoding::RLE};
+        column_chunk_meta.encodings      = {
+          ck.use_byte_stream_split ? Encoding::BYTE_STREAM_SPLIT : Encoding::PLAIN, Encoding::RLE};
         column_chunk_meta.path_in_schema = parquet_columns[c].get_path_in_schema();
         column_chunk_meta.codec          = UNCOMPRESSED;
         column_chunk_meta.num_values     = ck.num_values;
@@ -1403,10 +1588,49 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
     for (int rg = 0; rg < num_rg_in_part[p]; rg++) {
       size_t global_rg = global_rowgroup_base[p] + rg;
       for (int col = 0; col < num_columns; col++) {
-        if (chunks.host_view()[rg][col].use_dictionary) {
-          md->file(p).row_groups[global_rg].columns[col].meta_data.encodings.push_back(
-            Encoding::PLAIN_DICTIONARY);
+        auto const& ck     = chunks.host_view()[rg + first_rg_in_part[p]][col];
+        auto& column_chunk = md->file(p).row_groups[global_rg].columns[col];
+        if (ck.use_dictionary) {
+          column_chunk.meta_data.encodings.push_back(Encoding::PLAIN_DICTIONARY);
         }
+        std::string column_path;
+        for (auto const& name : column_chunk.meta_data.path_in_schema) {
+          column_path += (column_path.empty() ? "" : ".") + name;
+        }
+        // The hash map is only allocated for the chunks whose dictionary pass was not skipped;
+        // the count of distinct values is exact unless the pass stopped at the size limit
+        auto const is_dict_skipped = ck.est_dict_entries >= 0 and ck.dict_map_slots == nullptr;
+        auto const is_count_exact =
+          ck.dict_map_slots != nullptr and ck.num_dict_entries <= MAX_DICT_SIZE;
+        column_chunk_encodings.push_back({column_path,
+                                          static_cast<size_type>(p),
+                                          static_cast<size_type>(global_rg),
+                                          ck.use_dictionary,
+                                          is_dict_skipped,
+                                          ck.est_dict_entries,
+                                          is_count_exact ? ck.num_dict_entries : -1});
+      }
+    }
+  }
+
+  // Bloom filters are sized with the dictionary sizes, so they are built after the dictionaries
+  std::vector<double> bloom_filter_fpp(num_columns);
+  std::transform(parquet_columns.begin(),
+                 parquet_columns.end(),
+                 bloom_filter_fpp.begin(),
+                 [](auto const& pcol) {
+                   return is_bloom_filter_supported(pcol.physical_type()) ? pcol.bloom_filter_fpp()
+                                                                          : 0.;
+                 });
+  auto const bloom_filters = build_chunk_bloom_filters(chunks, bloom_filter_fpp, fragments, stream);
+  if (not bloom_filters.empty()) {
+    for (size_t p = 0; p < partitions.size(); p++) {
+      auto& file = md->file(p);
+      file.bloom_filters.resize(file.row_groups.size());
+      for (int rg = 0; rg < num_rg_in_part[p]; rg++) {
+        size_t global_rg = global_rowgroup_base[p] + rg;
+        auto const first = bloom_filters.begin() + (first_rg_in_part[p] + rg) * num_columns;
+        file.bloom_filters[global_rg].assign(first, first + num_columns);
       }
     }
   }
@@ -1423,13 +1647,8 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
                       return std::max(max_page_size, chunk.max_page_data_size);
                     });
 
-  size_t max_page_comp_data_size = 0;
-  if (compression_ != parquet::Compression::UNCOMPRESSED) {
-    auto status = nvcompBatchedSnappyCompressGetMaxOutputChunkSize(
-      max_page_uncomp_data_size, nvcompBatchedSnappyDefaultOpts, &max_page_comp_data_size);
-    CUDF_EXPECTS(status == nvcompStatus_t::nvcompSuccess,
-                 "Error in getting compressed size from nvcomp");
-  }
+  auto const max_page_comp_data_size =
+    max_compressed_page_size(compression_, compression_level_, max_page_uncomp_data_size);
 
   // Find which partition a rg belongs to
   std::vector<int> rg_to_part;
@@ -1543,11 +1762,28 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
       (stats_granularity_ == statistics_freq::STATISTICS_PAGE) ? page_stats.data() : nullptr,
       (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? page_stats.data() + num_pages
                                                                : nullptr);
+    // The page index is built from the encoded page headers, which requires host copies of the
+    // pages and of the chunk data
+    auto const write_page_index = (stats_granularity_ == statistics_freq::STATISTICS_PAGE);
+    auto const h_batch_pages =
+      write_page_index
+        ? cudf::detail::make_std_vector_sync(
+            device_span<gpu::EncPage const>{pages.data() + first_page_in_batch, pages_in_batch},
+            stream)
+        : std::vector<gpu::EncPage>{};
+
     std::vector<std::future<void>> write_tasks;
     for (; r < rnext; r++) {
       int p           = rg_to_part[r];
       int global_r    = global_rowgroup_base[p] + r - first_rg_in_part[p];
-      auto& row_group = md->file(p).row_groups[global_r];
+      auto& file      = md->file(p);
+      auto& row_group = file.row_groups[global_r];
+      if (write_page_index) {
+        file.column_indexes.resize(file.row_groups.size());
+        file.offset_indexes.resize(file.row_groups.size());
+        file.column_indexes[global_r].resize(num_columns);
+        file.offset_indexes[global_r].resize(num_columns);
+      }
       for (auto i = 0; i < num_columns; i++) {
         gpu::EncColumnChunk& ck = chunks[r][i];
         auto& column_chunk_meta = row_group.columns[i].meta_data;
@@ -1559,7 +1795,8 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
           dev_bfr = ck.uncompressed_bfr;
         }
 
-        if (out_sink_[p]->is_device_write_preferred(ck.compressed_size)) {
+        auto const is_device_write = out_sink_[p]->is_device_write_preferred(ck.compressed_size);
+        if (is_device_write) {
           // let the writer do what it wants to retrieve the data from the gpu.
           write_tasks.push_back(out_sink_[p]->device_write_async(
             dev_bfr + ck.ck_stat_size, ck.compressed_size, stream));
@@ -1573,7 +1810,8 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
                                      stream.value()));
             stream.synchronize();
           }
-        } else {
+        }
+        if (!is_device_write || write_page_index) {
           if (!host_bfr) {
             host_bfr = pinned_buffer<uint8_t>{[](size_t size) {
                                                 uint8_t* ptr = nullptr;
@@ -1589,12 +1827,22 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
                                    cudaMemcpyDeviceToHost,
                                    stream.value()));
           stream.synchronize();
+        }
+        if (!is_device_write) {
           out_sink_[p]->host_write(host_bfr.get() + ck.ck_stat_size, ck.compressed_size);
           if (ck.ck_stat_size != 0) {
             column_chunk_meta.statistics_blob.resize(ck.ck_stat_size);
             memcpy(column_chunk_meta.statistics_blob.data(), host_bfr.get(), ck.ck_stat_size);
           }
         }
+        if (write_page_index) {
+          auto const first_page = ck.first_page - first_page_in_batch;
+          std::tie(file.column_indexes[global_r][i], file.offset_indexes[global_r][i]) =
+            build_page_index(ck,
+                             {h_batch_pages.data() + first_page, ck.num_pages},
+                             host_bfr.get() + ck.ck_stat_size,
+                             current_chunk_offset[p]);
+        }
         row_group.total_byte_size += ck.compressed_size;
         column_chunk_meta.data_page_offset =
           current_chunk_offset[p] + ((ck.use_dictionary) ? ck.dictionary_size : 0);
@@ -1621,6 +1869,50 @@ std::unique_ptr<std::vector<uint8_t>> writer::impl::close(
   for (size_t p = 0; p < out_sink_.size(); p++) {
     std::vector<uint8_t> buffer;
     CompactProtocolWriter cpw(&buffer);
+
+    // Bloom filters and page indexes are stored between the last row group and the footer: first
+    // the Bloom filters of all chunks, then their column indexes and their offset indexes
+    auto& file = md->file(p);
+    for (size_t r = 0; r < file.bloom_filters.size(); ++r) {
+      for (size_t c = 0; c < file.bloom_filters[r].size(); ++c) {
+        auto const& bitset = file.bloom_filters[r][c];
+        if (bitset.empty()) { continue; }
+        BloomFilterHeader header;
+        header.num_bytes                      = static_cast<int32_t>(bitset.size());
+        header.algorithm.isset.BLOCK          = true;
+        header.hash.isset.XXHASH              = true;
+        header.compression.isset.UNCOMPRESSED = true;
+        buffer.resize(0);
+        cpw.write(header);
+        auto& chunk_meta               = file.row_groups[r].columns[c].meta_data;
+        chunk_meta.bloom_filter_offset = current_chunk_offset[p];
+        chunk_meta.bloom_filter_length = static_cast<int32_t>(buffer.size() + bitset.size());
+        out_sink_[p]->host_write(buffer.data(), buffer.size());
+        out_sink_[p]->host_write(bitset.data(), bitset.size());
+        current_chunk_offset[p] += buffer.size() + bitset.size();
+      }
+    }
+    for (size_t r = 0; r < file.column_indexes.size(); ++r) {
+      for (size_t c = 0; c < file.column_indexes[r].size(); ++c) {
+        buffer.resize(0);
+        auto& chunk               = file.row_groups[r].columns[c];
+        chunk.column_index_length = static_cast<int32_t>(cpw.write(file.column_indexes[r][c]));
+        chunk.column_index_offset = current_chunk_offset[p];
+        out_sink_[p]->host_write(buffer.data(), buffer.size());
+        current_chunk_offset[p] += buffer.size();
+      }
+    }
+    for (size_t r = 0; r < file.offset_indexes.size(); ++r) {
+      for (size_t c = 0; c < file.offset_indexes[r].size(); ++c) {
+        buffer.resize(0);
+        auto& chunk               = file.row_groups[r].columns[c];
+        chunk.offset_index_length = static_cast<int32_t>(cpw.write(file.offset_indexes[r][c]));
+        chunk.offset_index_offset = current_chunk_offset[p];
+        out_sink_[p]->host_write(buffer.data(), buffer.size());
+        current_chunk_offset[p] += buffer.size();
+      }
+    }
+
     file_ender_s fendr;
     buffer.resize(0);
     fendr.footer_len = static_cast<uint32_t>(cpw.write(md->get_metadata(p)));
@@ -1690,6 +1982,12 @@ std::unique_ptr<std::vector<uint8_t>> writer::close(
   return _impl->close(column_chunks_file_path);
 }
 
+// Forward to implementation
+std::vector<parquet_column_chunk_encoding> const& writer::column_chunk_encodings() const
+{
+  return _impl->get_column_chunk_encodings();
+}
+
 std::unique_ptr<std::vector<uint8_t>> writer::merge_row_group_metadata(
   std::vector<std::unique_ptr<std::vector<uint8_t>>> const& metadata_list)
 {
@@ -36,6 +36,7 @@
 #include <rmm/cuda_stream_view.hpp>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -118,6 +119,14 @@ class writer::impl {
   std::unique_ptr<std::vector<uint8_t>> close(
     std::vector<std::string> const& column_chunks_file_path = {});
 
+  /**
+   * @brief Returns the encoding decision of each column chunk written so far, in write order.
+   */
+  [[nodiscard]] std::vector<parquet_column_chunk_encoding> const& get_column_chunk_encodings() const
+  {
+    return column_chunk_encodings;
+  }
+
  private:
   /**
    * @brief Gather page fragments
@@ -211,6 +220,7 @@ class writer::impl {
   size_t max_row_group_size          = default_row_group_size_bytes;
   size_type max_row_group_rows       = default_row_group_size_rows;
   Compression compression_           = Compression::UNCOMPRESSED;
+  std::optional<int> compression_level_;
   statistics_freq stats_granularity_ = statistics_freq::STATISTICS_NONE;
   bool int96_timestamps              = false;
   // Overall file metadata.  Filled in during the process and written during write_chunked_end()
@@ -219,6 +229,8 @@ class writer::impl {
   std::vector<std::map<std::string, std::string>> kv_md;
   // optional user metadata
   std::unique_ptr<table_input_metadata> table_meta;
+  // Encoding decision of each written column chunk
+  std::vector<parquet_column_chunk_encoding> column_chunk_encodings;
   // to track if the output has been written to sink
   bool closed = false;
   // To track if the last write(table) call completed successfully
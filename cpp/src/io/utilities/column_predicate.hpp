@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Host-side statistics of a single column in a block of rows (row group, stripe, etc.).
+ *
+ * Any of the optional members can be absent if the file does not store them.
+ */
+template <typename T>
+struct block_statistics {
+  std::optional<T> min;
+  std::optional<T> max;
+  std::optional<int64_t> null_count;
+  int64_t num_rows = 0;
+};
+
+/**
+ * @brief Returns whether the statistics prove that no row of the block satisfies `column op value`.
+ *
+ * Null values never satisfy a comparison, so blocks that only contain nulls are excluded by all
+ * operators except `IS_NULL`. The result is conservative: missing statistics never exclude a block.
+ *
+ * @param stats Statistics of the column in the block
+ * @param op Comparison operator
+ * @param value Value to compare against; ignored for `IS_NULL` and `IS_NOT_NULL`
+ *
+ * @return `true` if the block can be skipped
+ */
+template <typename T>
+bool is_block_excluded(block_statistics<T> const& stats, predicate_op op, T const& value)
+{
+  auto const all_nulls = stats.null_count.has_value() && stats.null_count.value() >= stats.num_rows;
+  switch (op) {
+    case predicate_op::IS_NULL: return stats.null_count.has_value() && stats.null_count == 0;
+    case predicate_op::IS_NOT_NULL: return all_nulls;
+    default: break;
+  }
+  if (all_nulls) { return true; }
+  if (!stats.min.has_value() || !stats.max.has_value()) { return false; }
+
+  auto const& min = stats.min.value();
+  auto const& max = stats.max.value();
+  switch (op) {
+    case predicate_op::EQUAL: return value < min || max < value;
+    case predicate_op::NOT_EQUAL:
+      return !(min < value) && !(value < min) && !(max < value) && !(value < max);
+    case predicate_op::LESS: return !(min < value);
+    case predicate_op::LESS_EQUAL: return value < min;
+    case predicate_op::GREATER: return !(value < max);
+    case predicate_op::GREATER_EQUAL: return max < value;
+    default: return false;
+  }
+}
+
+/**
+ * @brief Returns whether a block can be skipped for an `IN` predicate, i.e. whether it can be
+ * skipped for each of the values of the predicate as an `EQUAL` predicate.
+ *
+ * @param predicate `IN` predicate
+ * @param is_excluded Callable that evaluates a `column_predicate` against the block
+ *
+ * @return `true` if the block can be skipped
+ */
+template <typename Excluded>
+bool is_in_list_excluded(column_predicate const& predicate, Excluded const& is_excluded)
+{
+  return std::all_of(predicate.values.cbegin(), predicate.values.cend(), [&](auto const& value) {
+    return is_excluded(column_predicate{predicate.column_name, predicate_op::EQUAL, value});
+  });
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
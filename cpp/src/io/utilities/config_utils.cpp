@@ -83,4 +83,28 @@ bool is_stable_enabled() { return is_all_enabled() or get_env_policy() == usage_
 
 }  // namespace nvcomp_integration
 
+namespace host_decompression_integration {
+
+namespace {
+/**
+ * @brief Defines which codecs to decompress on the host.
+ */
+enum class usage_policy : uint8_t { AUTO, ALWAYS };
+
+/**
+ * @brief Get the current usage policy.
+ */
+usage_policy get_env_policy()
+{
+  static auto const env_val = getenv_or("LIBCUDF_HOST_DECOMPRESSION_POLICY", "AUTO");
+  if (env_val == "AUTO") return usage_policy::AUTO;
+  if (env_val == "ALWAYS") return usage_policy::ALWAYS;
+  CUDF_FAIL("Invalid LIBCUDF_HOST_DECOMPRESSION_POLICY value: " + env_val);
+}
+}  // namespace
+
+bool is_always_enabled() { return get_env_policy() == usage_policy::ALWAYS; }
+
+}  // namespace host_decompression_integration
+
 }  // namespace cudf::io::detail
@@ -53,4 +53,13 @@ bool is_stable_enabled();
 
 }  // namespace nvcomp_integration
 
+namespace host_decompression_integration {
+
+/**
+ * @brief Returns true if all codecs with a host decompressor are decompressed on the host.
+ */
+bool is_always_enabled();
+
+}  // namespace host_decompression_integration
+
 }  // namespace cudf::io::detail
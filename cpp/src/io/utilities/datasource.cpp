@@ -22,6 +22,7 @@
 
 #include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 namespace cudf {
@@ -34,7 +35,9 @@ namespace {
 class file_source : public datasource {
  public:
   explicit file_source(const char* filepath)
-    : _file(filepath, O_RDONLY), _cufile_in(detail::make_cufile_input(filepath))
+    : _file(filepath, O_RDONLY),
+      _filepath(filepath),
+      _cufile_in(detail::make_cufile_input(filepath))
   {
   }
 
@@ -79,12 +82,54 @@ class file_source : public datasource {
     return _cufile_in->read_async(offset, read_size, dst, stream);
   }
 
+  std::future<size_t> host_read_async(size_t offset, size_t size, uint8_t* dst) override
+  {
+    CUDF_EXPECTS(offset <= _file.size(), "Offset is past end of file");
+
+    // Clamp length to available data
+    auto const read_size = std::min(size, _file.size() - offset);
+    return detail::pread_async(_file.desc(), offset, read_size, dst);
+  }
+
+  std::vector<std::unique_ptr<datasource::buffer>> host_read_batch(
+    std::vector<range> const& ranges) override
+  {
+    // Issue all reads before waiting on any of them so that they are all in flight at once
+    std::vector<std::vector<uint8_t>> data(ranges.size());
+    std::vector<std::future<size_t>> read_tasks;
+    read_tasks.reserve(ranges.size());
+    for (size_t r = 0; r < ranges.size(); ++r) {
+      CUDF_EXPECTS(ranges[r].offset <= _file.size(), "Offset is past end of file");
+      data[r].resize(std::min(ranges[r].size, _file.size() - ranges[r].offset));
+      read_tasks.emplace_back(
+        detail::pread_async(_file.desc(), ranges[r].offset, data[r].size(), data[r].data()));
+    }
+
+    std::vector<std::unique_ptr<datasource::buffer>> buffers;
+    buffers.reserve(ranges.size());
+    for (size_t r = 0; r < ranges.size(); ++r) {
+      data[r].resize(read_tasks[r].get());
+      buffers.emplace_back(buffer::create(std::move(data[r])));
+    }
+    return buffers;
+  }
+
   [[nodiscard]] size_t size() const override { return _file.size(); }
 
+  [[nodiscard]] detail::file_identity identity() const
+  {
+    struct stat st;
+    CUDF_EXPECTS(fstat(_file.desc(), &st) != -1, "Cannot query file status");
+    auto const mtime_ns = static_cast<int64_t>(st.st_mtim.tv_sec) * 1'000'000'000 +
+                          static_cast<int64_t>(st.st_mtim.tv_nsec);
+    return {_filepath, static_cast<size_t>(st.st_size), mtime_ns};
+  }
+
  protected:
   detail::file_wrapper _file;
 
  private:
+  std::string const _filepath;
   std::unique_ptr<detail::cufile_input_impl> _cufile_in;
 };
 
@@ -109,10 +154,7 @@ class memory_mapped_source : public file_source {
 
   std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
   {
-    CUDF_EXPECTS(offset >= _map_offset, "Requested offset is outside mapping");
-
-    // Clamp length to available data in the mapped region
-    auto const read_size = std::min(size, _map_size - (offset - _map_offset));
+    auto const read_size = mapped_read_size(offset, size);
 
     return std::make_unique<non_owning_buffer>(
       static_cast<uint8_t*>(_map_addr) + (offset - _map_offset), read_size);
@@ -120,17 +162,42 @@ class memory_mapped_source : public file_source {
 
   size_t host_read(size_t offset, size_t size, uint8_t* dst) override
   {
-    CUDF_EXPECTS(offset >= _map_offset, "Requested offset is outside mapping");
-
-    // Clamp length to available data in the mapped region
-    auto const read_size = std::min(size, _map_size - (offset - _map_offset));
+    auto const read_size = mapped_read_size(offset, size);
 
     auto const src = static_cast<uint8_t*>(_map_addr) + (offset - _map_offset);
     std::memcpy(dst, src, read_size);
     return read_size;
   }
 
+  // Served from the mapping, instead of the `pread` calls of the base class that would ignore the
+  // mapped window
+  std::future<size_t> host_read_async(size_t offset, size_t size, uint8_t* dst) override
+  {
+    return datasource::host_read_async(offset, size, dst);
+  }
+
+  // The buffers are views of the mapping; no data is copied
+  std::vector<std::unique_ptr<datasource::buffer>> host_read_batch(
+    std::vector<range> const& ranges) override
+  {
+    return datasource::host_read_batch(ranges);
+  }
+
  private:
+  /**
+   * @brief Returns the number of bytes of the given range that are in the mapped region.
+   *
+   * @throws cudf::logic_error if the offset is outside the mapped region
+   */
+  [[nodiscard]] size_t mapped_read_size(size_t offset, size_t size) const
+  {
+    CUDF_EXPECTS(offset >= _map_offset && offset - _map_offset <= _map_size,
+                 "Requested offset is outside mapping");
+
+    // Clamp length to available data in the mapped region
+    return std::min(size, _map_size - (offset - _map_offset));
+  }
+
   void map(int fd, size_t offset, size_t size)
   {
     CUDF_EXPECTS(offset < _file.size(), "Offset is past end of file");
@@ -166,24 +233,21 @@ class direct_read_source : public file_source {
 
   std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
   {
-    lseek(_file.desc(), offset, SEEK_SET);
-
     // Clamp length to available data
     ssize_t const read_size = std::min(size, _file.size() - offset);
 
+    // Use `pread` so that concurrent `host_read_async` calls don't race on the file position
     std::vector<uint8_t> v(read_size);
-    CUDF_EXPECTS(read(_file.desc(), v.data(), read_size) == read_size, "read failed");
+    CUDF_EXPECTS(pread(_file.desc(), v.data(), read_size, offset) == read_size, "read failed");
     return buffer::create(std::move(v));
   }
 
   size_t host_read(size_t offset, size_t size, uint8_t* dst) override
   {
-    lseek(_file.desc(), offset, SEEK_SET);
-
     // Clamp length to available data
     auto const read_size = std::min(size, _file.size() - offset);
 
-    CUDF_EXPECTS(read(_file.desc(), dst, read_size) == static_cast<ssize_t>(read_size),
+    CUDF_EXPECTS(pread(_file.desc(), dst, read_size, offset) == static_cast<ssize_t>(read_size),
                  "read failed");
     return read_size;
   }
@@ -210,6 +274,16 @@ class user_datasource_wrapper : public datasource {
     return source->host_read(offset, size);
   }
 
+  std::future<size_t> host_read_async(size_t offset, size_t size, uint8_t* dst) override
+  {
+    return source->host_read_async(offset, size, dst);
+  }
+
+  std::vector<std::unique_ptr<buffer>> host_read_batch(std::vector<range> const& ranges) override
+  {
+    return source->host_read_batch(ranges);
+  }
+
   [[nodiscard]] bool supports_device_read() const override
   {
     return source->supports_device_read();
@@ -238,6 +312,13 @@ class user_datasource_wrapper : public datasource {
 
 }  // namespace
 
+std::optional<detail::file_identity> detail::get_file_identity(datasource const& source)
+{
+  auto const file = dynamic_cast<file_source const*>(&source);
+  if (file == nullptr) { return std::nullopt; }
+  return file->identity();
+}
+
 std::unique_ptr<datasource> datasource::create(const std::string& filepath,
                                                size_t offset,
                                                size_t size)
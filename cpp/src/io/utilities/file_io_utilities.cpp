@@ -20,9 +20,13 @@
 #include <rmm/device_buffer.hpp>
 
 #include <dlfcn.h>
+#include <unistd.h>
 
+#include <algorithm>
+#include <cerrno>
 #include <fstream>
 #include <numeric>
+#include <thread>
 
 namespace cudf {
 namespace io {
@@ -49,6 +53,91 @@ file_wrapper::file_wrapper(std::string const& filepath, int flags, mode_t mode)
 
 file_wrapper::~file_wrapper() { close(fd); }
 
+namespace {
+
+template <typename DataT,
+          typename F,
+          typename ResultT = std::invoke_result_t<F, DataT*, size_t, size_t>>
+std::vector<std::future<ResultT>> make_sliced_tasks(
+  F function, DataT* ptr, size_t offset, size_t size, cudf::detail::thread_pool& pool)
+{
+  std::vector<std::future<ResultT>> slice_tasks;
+  constexpr size_t max_slice_bytes = 4 * 1024 * 1024;
+  size_t const n_slices            = util::div_rounding_up_safe(size, max_slice_bytes);
+  size_t slice_offset              = 0;
+  for (size_t t = 0; t < n_slices; ++t) {
+    DataT* ptr_slice = ptr + slice_offset;
+
+    size_t const slice_size = (t == n_slices - 1) ? size - slice_offset : max_slice_bytes;
+    slice_tasks.push_back(pool.submit(function, ptr_slice, slice_size, offset + slice_offset));
+
+    slice_offset += slice_size;
+  }
+  return slice_tasks;
+}
+
+}  // namespace
+
+cudf::detail::thread_pool& host_read_pool()
+{
+  // Host reads are latency-bound; keep enough reads in flight to saturate NVMe and network storage
+  static cudf::detail::thread_pool pool(std::stoi(getenv_or("LIBCUDF_HOST_READ_THREADS", "32")));
+  return pool;
+}
+
+cudf::detail::thread_pool& footer_parse_pool()
+{
+  static cudf::detail::thread_pool pool(std::max(
+    std::stoi(getenv_or("LIBCUDF_FOOTER_PARSE_THREADS",
+                        std::to_string(std::thread::hardware_concurrency()))),
+    1));
+  return pool;
+}
+
+cudf::detail::thread_pool& host_decompression_pool()
+{
+  static cudf::detail::thread_pool pool(std::max(
+    std::stoi(getenv_or("LIBCUDF_HOST_DECOMPRESSION_THREADS",
+                        std::to_string(std::thread::hardware_concurrency()))),
+    1));
+  return pool;
+}
+
+cudf::detail::thread_pool& host_compression_pool()
+{
+  static cudf::detail::thread_pool pool(std::max(
+    std::stoi(getenv_or("LIBCUDF_HOST_COMPRESSION_THREADS",
+                        std::to_string(std::thread::hardware_concurrency()))),
+    1));
+  return pool;
+}
+
+std::future<size_t> pread_async(int fd, size_t offset, size_t size, uint8_t* dst)
+{
+  auto read_slice = [fd](uint8_t* dst, size_t size, size_t offset) -> size_t {
+    size_t bytes_read = 0;
+    while (bytes_read < size) {
+      auto const res = pread(fd, dst + bytes_read, size - bytes_read, offset + bytes_read);
+      if (res == -1 and errno == EINTR) { continue; }
+      CUDF_EXPECTS(res != -1, "Error reading from a file");
+      if (res == 0) { break; }  // end of file
+      bytes_read += res;
+    }
+    return bytes_read;
+  };
+
+  auto slice_tasks = make_sliced_tasks(read_slice, dst, offset, size, host_read_pool());
+
+  auto waiter = [](auto slice_tasks) -> size_t {
+    return std::accumulate(
+      slice_tasks.begin(), slice_tasks.end(), size_t{0}, [](auto sum, auto& task) {
+        return sum + task.get();
+      });
+  };
+  // Deferred for the same reason as `cufile_input_impl::read_async`; the slices are already queued
+  return std::async(std::launch::deferred, waiter, std::move(slice_tasks));
+}
+
 #ifdef CUFILE_FOUND
 
 /**
@@ -185,31 +274,6 @@ std::unique_ptr<datasource::buffer> cufile_input_impl::read(size_t offset,
   return datasource::buffer::create(std::move(out_data));
 }
 
-namespace {
-
-template <typename DataT,
-          typename F,
-          typename ResultT = std::invoke_result_t<F, DataT*, size_t, size_t>>
-std::vector<std::future<ResultT>> make_sliced_tasks(
-  F function, DataT* ptr, size_t offset, size_t size, cudf::detail::thread_pool& pool)
-{
-  std::vector<std::future<ResultT>> slice_tasks;
-  constexpr size_t max_slice_bytes = 4 * 1024 * 1024;
-  size_t const n_slices            = util::div_rounding_up_safe(size, max_slice_bytes);
-  size_t slice_offset              = 0;
-  for (size_t t = 0; t < n_slices; ++t) {
-    DataT* ptr_slice = ptr + slice_offset;
-
-    size_t const slice_size = (t == n_slices - 1) ? size % max_slice_bytes : max_slice_bytes;
-    slice_tasks.push_back(pool.submit(function, ptr_slice, slice_size, offset + slice_offset));
-
-    slice_offset += slice_size;
-  }
-  return slice_tasks;
-}
-
-}  // namespace
-
 std::future<size_t> cufile_input_impl::read_async(size_t offset,
                                                   size_t size,
                                                   uint8_t* dst,
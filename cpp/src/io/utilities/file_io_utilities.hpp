@@ -16,9 +16,9 @@
 
 #pragma once
 
-#ifdef CUFILE_FOUND
 #include "thread_pool.hpp"
 
+#ifdef CUFILE_FOUND
 #include <cudf_test/file_utilities.hpp>
 #include <cufile.h>
 #endif
@@ -28,7 +28,14 @@
 #include <cudf/io/datasource.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <algorithm>
+#include <future>
+#include <memory>
+#include <optional>
 #include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
 namespace cudf {
 namespace io {
@@ -49,6 +56,155 @@ class file_wrapper {
   [[nodiscard]] auto desc() const { return fd; }
 };
 
+/**
+ * @brief Identifies the contents of a file, for caching data derived from the file.
+ *
+ * A file that is modified in place is expected to change its size and/or modification time.
+ */
+struct file_identity {
+  std::string path;  ///< Path used to open the file
+  size_t size;       ///< File size in bytes
+  int64_t mtime_ns;  ///< Last modification time, in nanoseconds since the epoch
+
+  bool operator<(file_identity const& other) const
+  {
+    return std::tie(path, size, mtime_ns) < std::tie(other.path, other.size, other.mtime_ns);
+  }
+};
+
+/**
+ * @brief Returns the identity of the file that backs the given source.
+ *
+ * @param source Datasource to identify
+ *
+ * @return The file identity, or `std::nullopt` if the source is not backed by a file (e.g. host
+ * buffers and user-implemented sources)
+ */
+std::optional<file_identity> get_file_identity(datasource const& source);
+
+/**
+ * @brief Returns the process-wide thread pool used for asynchronous host reads.
+ *
+ * The number of threads can be set through the `LIBCUDF_HOST_READ_THREADS` environment variable.
+ */
+cudf::detail::thread_pool& host_read_pool();
+
+/**
+ * @brief Returns the process-wide thread pool used to parse file footers of multi-source reads.
+ *
+ * Kept separate from `host_read_pool()` because parsing tasks block on host reads themselves. The
+ * number of threads can be set through the `LIBCUDF_FOOTER_PARSE_THREADS` environment variable
+ * and defaults to the number of hardware threads.
+ */
+cudf::detail::thread_pool& footer_parse_pool();
+
+/**
+ * @brief Parses the footer of each source, concurrently on the `footer_parse_pool()` when there
+ * are multiple sources.
+ *
+ * Footers of different files are independent, so parsing them concurrently overlaps the latency
+ * of many small footer reads.
+ *
+ * @param sources Sources to parse the footers of
+ * @param parse Function that returns the parsed footer of a `datasource*`
+ * @return The parsed footers, in the order of the sources
+ */
+template <typename ParseFn>
+auto parse_footers(std::vector<std::unique_ptr<datasource>> const& sources, ParseFn const& parse)
+{
+  std::vector<std::invoke_result_t<ParseFn const&, datasource*>> footers;
+  footers.reserve(sources.size());
+  if (sources.size() <= 1) {
+    for (auto const& source : sources) {
+      footers.emplace_back(parse(source.get()));
+    }
+    return footers;
+  }
+
+  std::vector<std::future<typename decltype(footers)::value_type>> parse_tasks;
+  parse_tasks.reserve(sources.size());
+  for (auto const& source : sources) {
+    parse_tasks.emplace_back(
+      footer_parse_pool().submit([&parse, src = source.get()] { return parse(src); }));
+  }
+  // Wait for all tasks before rethrowing any error, as the tasks reference the sources
+  for (auto const& task : parse_tasks) {
+    task.wait();
+  }
+  for (auto& task : parse_tasks) {
+    footers.emplace_back(task.get());
+  }
+  return footers;
+}
+
+/**
+ * @brief Returns the process-wide thread pool used to decompress independent blocks of compressed
+ * data on the host (e.g. the blocks of a BGZF file).
+ *
+ * The number of threads can be set through the `LIBCUDF_HOST_DECOMPRESSION_THREADS` environment
+ * variable and defaults to the number of hardware threads.
+ */
+cudf::detail::thread_pool& host_decompression_pool();
+
+/**
+ * @brief Returns the process-wide thread pool used by the writers to compress independent blocks
+ * on the host.
+ *
+ * The number of threads can be set through the `LIBCUDF_HOST_COMPRESSION_THREADS` environment
+ * variable and defaults to the number of hardware threads.
+ */
+cudf::detail::thread_pool& host_compression_pool();
+
+/**
+ * @brief Calls `loop(i)` for each `i` in `[begin, end)` on a thread pool and waits for all calls.
+ *
+ * Unlike `thread_pool::parallelize_loop`, the range may be empty, and an exception thrown by a call
+ * is rethrown to the caller instead of terminating the process.
+ *
+ * @param pool Thread pool that runs the calls
+ * @param begin First index of the range
+ * @param end Index past the last one of the range
+ * @param loop Function that takes the index
+ */
+template <typename F>
+void parallel_for(cudf::detail::thread_pool& pool, size_t begin, size_t end, F const& loop)
+{
+  if (begin >= end) { return; }
+  auto const num_tasks  = std::min<size_t>(std::max(pool.get_thread_count(), 1), end - begin);
+  auto const block_size = (end - begin + num_tasks - 1) / num_tasks;
+  std::vector<std::future<void>> tasks;
+  for (auto start = begin; start < end; start += block_size) {
+    tasks.push_back(pool.submit([&loop, start, stop = std::min(start + block_size, end)]() {
+      for (auto i = start; i < stop; ++i) {
+        loop(i);
+      }
+    }));
+  }
+  // The calls reference the caller's state; wait for all of them before rethrowing any exception
+  for (auto& task : tasks) {
+    task.wait();
+  }
+  for (auto& task : tasks) {
+    task.get();
+  }
+}
+
+/**
+ * @brief Asynchronously reads a range of a file into host memory using `pread` calls.
+ *
+ * Large reads are split into slices that are read concurrently on the `host_read_pool()`.
+ *
+ *  @throws cudf::logic_error on read error
+ *
+ * @param fd File descriptor of the file to read from
+ * @param offset Number of bytes from the start of the file
+ * @param size Number of bytes to read
+ * @param dst Address of the existing host memory
+ *
+ * @return The number of bytes read as an std::future
+ */
+std::future<size_t> pread_async(int fd, size_t offset, size_t size, uint8_t* dst);
+
 /**
  * @brief Base class for cuFile input/output.
  *
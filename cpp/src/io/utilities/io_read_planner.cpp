@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io_read_planner.hpp"
+
+#include <io/utilities/config_utils.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+namespace {
+
+size_t default_max_gap()
+{
+  static auto const max_gap = std::stoull(getenv_or("LIBCUDF_IO_COALESCE_MAX_GAP", "65536"));
+  return max_gap;
+}
+
+size_t default_max_request_size()
+{
+  static auto const max_size =
+    std::stoull(getenv_or("LIBCUDF_IO_COALESCE_MAX_REQUEST_SIZE", "67108864"));
+  return max_size;
+}
+
+}  // namespace
+
+io_read_planner::io_read_planner() : io_read_planner(default_max_gap(), default_max_request_size())
+{
+}
+
+read_plan io_read_planner::plan(host_span<byte_range const> ranges) const
+{
+  read_plan result;
+  result.read_index.resize(ranges.size(), 0);
+
+  std::vector<size_t> order(ranges.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](auto lhs, auto rhs) {
+    return ranges[lhs].offset < ranges[rhs].offset;
+  });
+
+  size_t num_nonempty = 0;
+  std::vector<size_t> empty_ranges;
+  for (auto const idx : order) {
+    auto const& range = ranges[idx];
+    if (range.size == 0) {
+      empty_ranges.push_back(idx);
+      continue;
+    }
+    ++num_nonempty;
+    result.requested_bytes += range.size;
+
+    auto const range_end = range.offset + range.size;
+    if (not result.reads.empty()) {
+      auto& last          = result.reads.back();
+      auto const last_end = last.offset + last.size;
+      auto const new_end  = std::max(last_end, range_end);
+      // Overlapping ranges must share a read; otherwise merge only within the configured limits
+      if (range.offset < last_end or
+          (range.offset - last_end <= _max_gap and new_end - last.offset <= _max_request_size)) {
+        // Only the gap between the ranges is read without being requested
+        if (range.offset > last_end) { result.over_read_bytes += range.offset - last_end; }
+        last.size              = new_end - last.offset;
+        result.read_index[idx] = result.reads.size() - 1;
+        continue;
+      }
+    }
+    result.reads.push_back({range.offset, range.size});
+    result.read_index[idx] = result.reads.size() - 1;
+  }
+
+  // Empty ranges don't need any data; point them at the closest preceding read
+  for (auto const idx : empty_ranges) {
+    auto const it = std::upper_bound(
+      result.reads.cbegin(), result.reads.cend(), ranges[idx].offset, [](auto offset, auto& read) {
+        return offset < read.offset;
+      });
+    result.read_index[idx] = (it == result.reads.cbegin()) ? 0 : (it - result.reads.cbegin() - 1);
+  }
+
+  result.requests_saved = num_nonempty - result.reads.size();
+
+  return result;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
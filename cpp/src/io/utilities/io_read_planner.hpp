@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file io_read_planner.hpp
+ * @brief cuDF-IO utility for coalescing byte range reads
+ */
+
+#pragma once
+
+#include <cudf/utilities/span.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Byte range requested by a reader.
+ */
+struct byte_range {
+  size_t offset;  ///< Bytes from the start of the source
+  size_t size;    ///< Number of bytes
+};
+
+/**
+ * @brief A single read that covers one or more requested byte ranges.
+ */
+struct coalesced_read {
+  size_t offset;  ///< Bytes from the start of the source
+  size_t size;    ///< Number of bytes to read, including the gaps between the covered ranges
+};
+
+/**
+ * @brief Result of planning the reads for a set of byte ranges.
+ */
+struct read_plan {
+  std::vector<coalesced_read> reads;  ///< Reads to issue, sorted by offset
+  std::vector<size_t> read_index;     ///< Index of the read covering each requested range
+  size_t requested_bytes = 0;         ///< Total size of the requested ranges, overlaps included
+  size_t over_read_bytes = 0;         ///< Bytes of the gaps read between merged ranges
+  size_t requests_saved  = 0;         ///< Non-empty requested ranges minus the number of reads
+
+  /**
+   * @brief Returns the offset of the requested range `range_idx` within its read buffer.
+   */
+  [[nodiscard]] size_t offset_in_read(size_t range_idx, byte_range const& range) const
+  {
+    return range.offset - reads[read_index[range_idx]].offset;
+  }
+};
+
+/**
+ * @brief Coalesces requested byte ranges into fewer, larger reads.
+ *
+ * Ranges that are closer than `max_gap` bytes are merged into a single read, reading through the
+ * gap between them, as long as the merged read does not exceed `max_request_size` bytes. Ranges
+ * that are larger than `max_request_size` on their own are read as a single request. Overlapping
+ * ranges are always merged.
+ *
+ * On high-latency storage reading through a small hole is much cheaper than issuing another
+ * request; the planner reports the over-read bytes and the saved requests so the trade-off can be
+ * evaluated. The readers return them in `table_metadata`.
+ */
+class io_read_planner {
+ public:
+  /**
+   * @brief Constructs a planner with the default limits.
+   *
+   * The defaults can be set with the `LIBCUDF_IO_COALESCE_MAX_GAP` and
+   * `LIBCUDF_IO_COALESCE_MAX_REQUEST_SIZE` environment variables (in bytes).
+   */
+  io_read_planner();
+
+  /**
+   * @brief Constructs a planner with the given limits.
+   *
+   * @param max_gap Maximum number of unrequested bytes to read between two ranges
+   * @param max_request_size Maximum size of a read that merges multiple ranges
+   */
+  io_read_planner(size_t max_gap, size_t max_request_size)
+    : _max_gap{max_gap}, _max_request_size{max_request_size}
+  {
+  }
+
+  /**
+   * @brief Plans the reads for the requested ranges.
+   *
+   * Empty ranges are mapped to the read that precedes them (or to the first read) and don't
+   * affect the plan.
+   *
+   * @param ranges Requested byte ranges; all ranges must be from the same source
+   *
+   * @return The coalesced reads and the mapping from requested ranges to reads
+   */
+  [[nodiscard]] read_plan plan(host_span<byte_range const> ranges) const;
+
+  [[nodiscard]] size_t max_gap() const { return _max_gap; }
+  [[nodiscard]] size_t max_request_size() const { return _max_request_size; }
+
+ private:
+  size_t _max_gap;
+  size_t _max_request_size;
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
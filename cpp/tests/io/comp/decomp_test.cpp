@@ -15,13 +15,23 @@
  */
 
 #include <io/comp/gpuinflate.h>
+#include <io/comp/host_batch_decompressor.hpp>
+#include <io/comp/io_comp.h>
+#include <io/comp/io_uncomp.h>
+#include <io/comp/nvcomp_adapter.hpp>
 
 #include <cudf_test/base_fixture.hpp>
 
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/io/types.hpp>
+
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <algorithm>
+#include <optional>
+#include <string>
 #include <vector>
 
 /**
@@ -175,4 +185,295 @@ TEST_F(BrotliDecompressTest, HelloWorld)
   EXPECT_EQ(output, input);
 }
 
+/**
+ * @brief Fixture for the host decompressors used for codecs without device support
+ */
+struct HostDecompressTest : public cudf::test::BaseFixture {
+  std::vector<uint8_t> Decompress(int stream_type,
+                                  std::vector<uint8_t> const& compressed,
+                                  size_t decompressed_size) const
+  {
+    std::vector<uint8_t> decompressed(decompressed_size);
+    auto decompressor = cudf::io::HostDecompressor::Create(stream_type);
+    auto const written = decompressor->Decompress(
+      decompressed.data(), decompressed.size(), compressed.data(), compressed.size());
+    decompressed.resize(written);
+    return decompressed;
+  }
+
+  std::vector<uint8_t> repeated_text() const
+  {
+    std::string text;
+    for (int i = 0; i < 10; ++i) {
+      text += "hello world, ";
+    }
+    return std::vector<uint8_t>(text.cbegin(), text.cend());
+  }
+};
+
+// Frame with a single compressed block, Huffman-coded literals and one sequence
+std::vector<uint8_t> const zstd_repeated_text{
+  0x28, 0xb5, 0x2f, 0xfd, 0x20, 0x82, 0xad, 0x00, 0x00, 0x70, 0x68, 0x65, 0x6c, 0x6c, 0x6f,
+  0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x2c, 0x20, 0x68, 0x01, 0x00, 0x11, 0xd2, 0xa9, 0x04};
+
+// Raw block with a literal run, an overlapping match and the trailing literals
+std::vector<uint8_t> const lz4_repeated_text{0xdf, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77,
+                                             0x6f, 0x72, 0x6c, 0x64, 0x2c, 0x20, 0x0d, 0x00,
+                                             0x5d, 0x50, 0x72, 0x6c, 0x64, 0x2c, 0x20};
+
+TEST_F(HostDecompressTest, Zstd)
+{
+  auto const expected = repeated_text();
+  EXPECT_EQ(Decompress(cudf::io::IO_UNCOMP_STREAM_TYPE_ZSTD, zstd_repeated_text, expected.size()),
+            expected);
+
+  // Concatenated frames decompress to the concatenated content
+  auto two_frames = zstd_repeated_text;
+  two_frames.insert(two_frames.end(), zstd_repeated_text.cbegin(), zstd_repeated_text.cend());
+  auto two_texts = expected;
+  two_texts.insert(two_texts.end(), expected.cbegin(), expected.cend());
+  EXPECT_EQ(Decompress(cudf::io::IO_UNCOMP_STREAM_TYPE_ZSTD, two_frames, two_texts.size()),
+            two_texts);
+
+  // Destination too small, and truncated input
+  EXPECT_TRUE(
+    Decompress(cudf::io::IO_UNCOMP_STREAM_TYPE_ZSTD, zstd_repeated_text, expected.size() - 1)
+      .empty());
+  auto const truncated =
+    std::vector<uint8_t>(zstd_repeated_text.cbegin(), zstd_repeated_text.cend() - 3);
+  EXPECT_TRUE(Decompress(cudf::io::IO_UNCOMP_STREAM_TYPE_ZSTD, truncated, expected.size()).empty());
+}
+
+TEST_F(HostDecompressTest, ZstdChecksum)
+{
+  auto const expected = repeated_text();
+  // Same frame with the content checksum flag, followed by the checksum
+  auto with_checksum = zstd_repeated_text;
+  with_checksum[4]   = 0x24;
+  with_checksum.insert(with_checksum.end(), {0xee, 0xff, 0xbe, 0xbb});
+  EXPECT_EQ(Decompress(cudf::io::IO_UNCOMP_STREAM_TYPE_ZSTD, with_checksum, expected.size()),
+            expected);
+
+  auto corrupted = with_checksum;
+  corrupted.back() ^= 1;
+  EXPECT_TRUE(Decompress(cudf::io::IO_UNCOMP_STREAM_TYPE_ZSTD, corrupted, expected.size()).empty());
+}
+
+TEST_F(HostDecompressTest, Lz4)
+{
+  auto const expected = repeated_text();
+  EXPECT_EQ(Decompress(cudf::io::IO_UNCOMP_STREAM_TYPE_LZ4, lz4_repeated_text, expected.size()),
+            expected);
+
+  // Hadoop framing: big-endian decompressed and compressed sizes before each block
+  std::vector<uint8_t> hadoop{0, 0, 0, static_cast<uint8_t>(expected.size()), 0, 0, 0, 0};
+  hadoop[7] = static_cast<uint8_t>(lz4_repeated_text.size());
+  hadoop.insert(hadoop.end(), lz4_repeated_text.cbegin(), lz4_repeated_text.cend());
+  EXPECT_EQ(Decompress(cudf::io::IO_UNCOMP_STREAM_TYPE_LZ4_HADOOP, hadoop, expected.size()),
+            expected);
+  // Unframed blocks are accepted as well
+  EXPECT_EQ(
+    Decompress(cudf::io::IO_UNCOMP_STREAM_TYPE_LZ4_HADOOP, lz4_repeated_text, expected.size()),
+    expected);
+}
+
+TEST_F(HostDecompressTest, DeviceBlocks)
+{
+  auto const expected = repeated_text();
+  rmm::device_buffer src{
+    zstd_repeated_text.data(), zstd_repeated_text.size(), rmm::cuda_stream_default};
+  rmm::device_buffer dst{expected.size(), rmm::cuda_stream_default};
+
+  std::vector<cudf::io::gpu_inflate_input_s> inputs{
+    {src.data(), src.size(), dst.data(), dst.size()}};
+  std::vector<cudf::io::gpu_inflate_status_s> outputs(1);
+  cudf::io::host_decompress(
+    cudf::io::IO_UNCOMP_STREAM_TYPE_ZSTD, inputs, outputs, rmm::cuda_stream_default);
+  EXPECT_EQ(outputs[0].status, 0);
+  EXPECT_EQ(outputs[0].bytes_written, expected.size());
+
+  std::vector<uint8_t> decompressed(expected.size());
+  ASSERT_CUDA_SUCCEEDED(
+    cudaMemcpy(decompressed.data(), dst.data(), decompressed.size(), cudaMemcpyDeviceToHost));
+  EXPECT_EQ(decompressed, expected);
+}
+
+TEST_F(HostDecompressTest, Batch)
+{
+  auto const expected = repeated_text();
+  auto const truncated =
+    std::vector<uint8_t>(zstd_repeated_text.cbegin(), zstd_repeated_text.cend() - 3);
+
+  // Blocks of different codecs, and a block that fails to decompress
+  std::vector<std::pair<std::vector<uint8_t> const*, int>> const blocks{
+    {&zstd_repeated_text, cudf::io::IO_UNCOMP_STREAM_TYPE_ZSTD},
+    {&lz4_repeated_text, cudf::io::IO_UNCOMP_STREAM_TYPE_LZ4},
+    {&truncated, cudf::io::IO_UNCOMP_STREAM_TYPE_ZSTD},
+    {&lz4_repeated_text, cudf::io::IO_UNCOMP_STREAM_TYPE_LZ4},
+    {&zstd_repeated_text, cudf::io::IO_UNCOMP_STREAM_TYPE_ZSTD}};
+  std::vector<std::vector<uint8_t>> decompressed(blocks.size(),
+                                                 std::vector<uint8_t>(expected.size()));
+  std::vector<cudf::io::host_decompression_task> tasks;
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    tasks.push_back({*blocks[i].first, decompressed[i], blocks[i].second});
+  }
+  std::vector<cudf::io::gpu_inflate_status_s> outputs(tasks.size());
+
+  cudf::detail::thread_pool pool(3);
+  cudf::io::host_batch_decompressor decompressor(pool);
+  decompressor.decompress(tasks, outputs);
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    if (i == 2) {
+      EXPECT_NE(outputs[i].status, 0);
+    } else {
+      EXPECT_EQ(outputs[i].status, 0);
+      EXPECT_EQ(outputs[i].bytes_written, expected.size());
+      EXPECT_EQ(decompressed[i], expected);
+    }
+  }
+
+  auto const stats = decompressor.statistics();
+  ASSERT_EQ(stats.size(), 2u);
+  EXPECT_EQ(stats[0].stream_type, cudf::io::IO_UNCOMP_STREAM_TYPE_LZ4);
+  EXPECT_EQ(stats[0].num_blocks, 2u);
+  EXPECT_EQ(stats[0].num_failed, 0u);
+  EXPECT_EQ(stats[1].stream_type, cudf::io::IO_UNCOMP_STREAM_TYPE_ZSTD);
+  EXPECT_EQ(stats[1].num_blocks, 3u);
+  EXPECT_EQ(stats[1].num_failed, 1u);
+  EXPECT_EQ(stats[1].compressed_bytes, 2 * zstd_repeated_text.size() + truncated.size());
+  EXPECT_EQ(stats[1].decompressed_bytes, 2 * expected.size());
+
+  // Codecs without a host decompressor
+  std::vector<cudf::io::host_decompression_task> const lzo{
+    {zstd_repeated_text, decompressed[0], cudf::io::IO_UNCOMP_STREAM_TYPE_LZO}};
+  std::vector<cudf::io::gpu_inflate_status_s> lzo_outputs(lzo.size());
+  EXPECT_THROW(decompressor.decompress(lzo, lzo_outputs), cudf::logic_error);
+}
+
+TEST_F(HostDecompressTest, ReaderStatistics)
+{
+  auto const zstd_stats = [] {
+    auto const stats = cudf::io::get_host_decompression_statistics();
+    auto const it    = std::find_if(stats.cbegin(), stats.cend(), [](auto const& s) {
+      return s.compression == cudf::io::compression_type::ZSTD;
+    });
+    return it != stats.cend() ? *it
+                              : cudf::io::host_decompression_statistics{
+                                  cudf::io::compression_type::ZSTD, 0, 0, 0, 0, 0.};
+  };
+  auto const before = zstd_stats();
+
+  auto const expected = repeated_text();
+  std::vector<uint8_t> decompressed(expected.size());
+  std::vector<cudf::io::host_decompression_task> const tasks{
+    {zstd_repeated_text, decompressed, cudf::io::IO_UNCOMP_STREAM_TYPE_ZSTD}};
+  std::vector<cudf::io::gpu_inflate_status_s> outputs(tasks.size());
+  cudf::io::reader_host_decompressor().decompress(tasks, outputs);
+  EXPECT_EQ(decompressed, expected);
+
+  // Blocks decompressed for the readers are reported by the public statistics
+  auto const after = zstd_stats();
+  EXPECT_EQ(after.num_blocks, before.num_blocks + 1);
+  EXPECT_EQ(after.num_failed, before.num_failed);
+  EXPECT_EQ(after.compressed_bytes, before.compressed_bytes + zstd_repeated_text.size());
+  EXPECT_EQ(after.decompressed_bytes, before.decompressed_bytes + expected.size());
+  EXPECT_GE(after.busy_seconds, before.busy_seconds);
+}
+
+/**
+ * @brief Fixture for the host compressors, verified with the matching host decompressors
+ */
+struct HostCompressTest : public HostDecompressTest {
+  std::vector<uint8_t> RoundTrip(int stream_type,
+                                 std::vector<uint8_t> const& input,
+                                 std::optional<int> level = std::nullopt) const
+  {
+    auto compressor = cudf::io::HostCompressor::Create(stream_type, level);
+    std::vector<uint8_t> compressed(compressor->GetMaxCompressedSize(input.size()));
+    auto const written =
+      compressor->Compress(compressed.data(), compressed.size(), input.data(), input.size());
+    EXPECT_GT(written, 0u);
+    compressed.resize(written);
+    return Decompress(stream_type, compressed, input.size());
+  }
+
+  std::vector<uint8_t> mixed_data() const
+  {
+    // Text runs interleaved with pseudo-random bytes, spanning several ZSTD blocks
+    std::vector<uint8_t> data;
+    uint32_t state = 12345;
+    while (data.size() < 300000) {
+      auto const text = repeated_text();
+      data.insert(data.end(), text.cbegin(), text.cend());
+      for (int i = 0; i < 100; ++i) {
+        state = state * 1103515245 + 12345;
+        data.push_back(static_cast<uint8_t>(state >> 24) % 16);
+      }
+    }
+    return data;
+  }
+};
+
+TEST_F(HostCompressTest, Zstd)
+{
+  auto const input = mixed_data();
+  for (int level : {1, 3, 9, 19}) {
+    EXPECT_EQ(RoundTrip(cudf::io::IO_UNCOMP_STREAM_TYPE_ZSTD, input, level), input);
+  }
+  EXPECT_EQ(RoundTrip(cudf::io::IO_UNCOMP_STREAM_TYPE_ZSTD, repeated_text()), repeated_text());
+  EXPECT_EQ(RoundTrip(cudf::io::IO_UNCOMP_STREAM_TYPE_ZSTD, std::vector<uint8_t>(1000, 7)),
+            std::vector<uint8_t>(1000, 7));
+}
+
+TEST_F(HostCompressTest, Deflate)
+{
+  auto const input = mixed_data();
+  EXPECT_EQ(RoundTrip(cudf::io::IO_UNCOMP_STREAM_TYPE_GZIP, input), input);
+  EXPECT_EQ(RoundTrip(cudf::io::IO_UNCOMP_STREAM_TYPE_INFLATE, input, 9), input);
+}
+
+TEST_F(HostCompressTest, Lz4)
+{
+  auto const input = mixed_data();
+  EXPECT_EQ(RoundTrip(cudf::io::IO_UNCOMP_STREAM_TYPE_LZ4, input), input);
+  EXPECT_EQ(RoundTrip(cudf::io::IO_UNCOMP_STREAM_TYPE_LZ4, repeated_text()), repeated_text());
+}
+
+TEST_F(HostCompressTest, Lz4NvcompDecode)
+{
+  // nvCOMP does not share any code with the host codec, so it catches format bugs that a
+  // round trip through our own decoder would hide
+  auto const stream = rmm::cuda_stream_default;
+  auto const input  = mixed_data();
+  auto compressor   = cudf::io::HostCompressor::Create(cudf::io::IO_UNCOMP_STREAM_TYPE_LZ4);
+  std::vector<uint8_t> compressed(compressor->GetMaxCompressedSize(input.size()));
+  auto const written =
+    compressor->Compress(compressed.data(), compressed.size(), input.data(), input.size());
+  ASSERT_GT(written, 0u);
+
+  rmm::device_buffer src{compressed.data(), written, stream};
+  rmm::device_buffer dst{input.size(), stream};
+  std::vector<cudf::io::gpu_inflate_input_s> inputs{
+    {src.data(), src.size(), dst.data(), dst.size()}};
+  auto const d_inputs = cudf::detail::make_device_uvector_sync(inputs, stream);
+  rmm::device_uvector<cudf::io::gpu_inflate_status_s> d_statuses(1, stream);
+  cudf::io::nvcomp::batched_decompress(
+    cudf::io::nvcomp::compression_type::LZ4, d_inputs, d_statuses, input.size(), true, stream);
+
+  std::vector<uint8_t> decompressed(input.size());
+  ASSERT_CUDA_SUCCEEDED(
+    cudaMemcpy(decompressed.data(), dst.data(), decompressed.size(), cudaMemcpyDeviceToHost));
+  EXPECT_EQ(decompressed, input);
+}
+
+TEST_F(HostCompressTest, InvalidLevel)
+{
+  EXPECT_THROW(cudf::io::HostCompressor::Create(cudf::io::IO_UNCOMP_STREAM_TYPE_ZSTD, 0),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::io::HostCompressor::Create(cudf::io::IO_UNCOMP_STREAM_TYPE_ZSTD, 23),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::io::HostCompressor::Create(cudf::io::IO_UNCOMP_STREAM_TYPE_GZIP, 10),
+               cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
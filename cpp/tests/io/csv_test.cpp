@@ -1258,6 +1258,49 @@ TEST_F(CsvReaderTest, TypeInferenceWithDecimal)
   expect_column_data_equal(dbl_col, result_view.column(2));
 }
 
+TEST_F(CsvReaderTest, TypeInferenceSample)
+{
+  // The first rows don't have the floating-point value of the second column, nor the null of the
+  // first column
+  std::string buffer = "1,1,a\n2,2,b\n3,3.5,c\n,4,d\n5,5,e\n";
+  auto const source  = cudf_io::source_info{buffer.c_str(), buffer.size()};
+  auto const builder = [&]() { return cudf_io::csv_reader_options::builder(source).header(-1); };
+
+  auto const full_result = cudf_io::read_csv(builder().build());
+  auto const full_view   = full_result.tbl->view();
+  ASSERT_EQ(full_view.num_columns(), 3);
+  EXPECT_EQ(full_view.column(0).type().id(), type_id::FLOAT64);
+  EXPECT_EQ(full_view.column(1).type().id(), type_id::FLOAT64);
+  EXPECT_EQ(full_view.column(2).type().id(), type_id::STRING);
+
+  // Columns with values outside of the sample that don't fit the inferred type are promoted
+  std::vector<cudf_io::csv_reader_options> const sampled_opts{
+    builder().type_inference_rows(2).build(),
+    builder().type_inference_bytes(4).build(),
+    builder().type_inference_rows(2).type_inference_ranges(2).build(),
+    builder().type_inference_rows(100).build()};
+  for (auto const& opts : sampled_opts) {
+    auto const result = cudf_io::read_csv(opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(full_view, result.tbl->view());
+  }
+
+  // Columns that fit the sampled type are not promoted
+  std::string int_buffer = "1,a\n2,b\n-3,c\n4,d\n";
+  cudf_io::csv_reader_options int_opts =
+    cudf_io::csv_reader_options::builder(
+      cudf_io::source_info{int_buffer.c_str(), int_buffer.size()})
+      .header(-1)
+      .type_inference_rows(1);
+  auto const int_result = cudf_io::read_csv(int_opts);
+  auto const int_view   = int_result.tbl->view();
+  EXPECT_EQ(int_view.column(0).type().id(), type_id::INT64);
+  expect_column_data_equal(std::vector<int64_t>{1, 2, -3, 4}, int_view.column(0));
+  expect_column_data_equal(std::vector<std::string>{"a", "b", "c", "d"}, int_view.column(1));
+
+  EXPECT_THROW(cudf_io::csv_reader_options::builder(source).type_inference_ranges(0),
+               cudf::logic_error);
+}
+
 TEST_F(CsvReaderTest, SkipRowsXorSkipFooter)
 {
   std::string buffer = "1,2,3";
@@ -2228,4 +2271,131 @@ TEST_F(CsvReaderTest, CsvDefaultOptionsWriteReadMatch)
   EXPECT_EQ(new_table_and_metadata.metadata.column_names[1], "1");
 }
 
+TEST_F(CsvReaderTest, GzipCompressedInput)
+{
+  // "a,b\n1,2.5\n3,4.5\n-5,6.5\n", compressed with gzip
+  std::vector<char> const compressed{
+    '\x1f', '\x8b', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', '\x02', '\x03',
+    '\x4b', '\xd4', '\x49', '\xe2', '\x32', '\xd4', '\x31', '\xd2', '\x33', '\xe5',
+    '\x32', '\xd6', '\x31', '\x01', '\x92', '\xba', '\xa6', '\x3a', '\x66', '\x40',
+    '\x0a', '\x00', '\xf2', '\x24', '\xd4', '\xc7', '\x17', '\x00', '\x00', '\x00'};
+
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(
+      cudf_io::source_info{compressed.data(), compressed.size()})
+      .compression(cudf_io::compression_type::GZIP)
+      .dtypes({dtype<int32_t>(), dtype<double>()});
+  auto result = cudf_io::read_csv(in_opts);
+
+  const auto result_table = result.tbl->view();
+  ASSERT_EQ(result_table.num_columns(), 2);
+  EXPECT_EQ(result.metadata.column_names[0], "a");
+  EXPECT_EQ(result.metadata.column_names[1], "b");
+  expect_column_data_equal(std::vector<int32_t>{1, 3, -5}, result_table.column(0));
+  expect_column_data_equal(std::vector<double>{2.5, 4.5, 6.5}, result_table.column(1));
+}
+
+TEST_F(CsvReaderTest, GzipMultiMemberInput)
+{
+  // "1,2.5\n3,4.5\n-5,6.5\n", compressed with gzip
+  std::vector<char> const member{
+    '\x1f', '\x8b', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', '\x02', '\x03', '\x33', '\xd4',
+    '\x31', '\xd2', '\x33', '\xe5', '\x32', '\xd6', '\x31', '\x01', '\x92', '\xba', '\xa6', '\x3a',
+    '\x66', '\x40', '\x0a', '\x00', '\x0c', '\xd8', '\xa5', '\x4e', '\x13', '\x00', '\x00', '\x00'};
+  // Concatenated gzip files are decompressed as the concatenation of their contents
+  std::vector<char> compressed;
+  for (int i = 0; i < 3; ++i) {
+    compressed.insert(compressed.end(), member.cbegin(), member.cend());
+  }
+
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(
+      cudf_io::source_info{compressed.data(), compressed.size()})
+      .compression(cudf_io::compression_type::GZIP)
+      .dtypes({dtype<int32_t>(), dtype<double>()})
+      .header(-1);
+  auto result = cudf_io::read_csv(in_opts);
+
+  const auto result_table = result.tbl->view();
+  ASSERT_EQ(result_table.num_columns(), 2);
+  expect_column_data_equal(std::vector<int32_t>{1, 3, -5, 1, 3, -5, 1, 3, -5},
+                           result_table.column(0));
+  expect_column_data_equal(std::vector<double>{2.5, 4.5, 6.5, 2.5, 4.5, 6.5, 2.5, 4.5, 6.5},
+                           result_table.column(1));
+
+  // Byte ranges of multi-member sources cannot be indexed
+  std::vector<char> index;
+  EXPECT_THROW(cudf_io::write_gzip_index(cudf_io::source_info{compressed.data(), compressed.size()},
+                                         cudf_io::sink_info{&index}),
+               cudf::logic_error);
+}
+
+TEST_F(CsvReaderTest, Bzip2MultiStreamInput)
+{
+  // "1,2.5\n3,4.5\n-5,6.5\n", compressed with bzip2
+  std::vector<char> const stream{
+    '\x42', '\x5a', '\x68', '\x39', '\x31', '\x41', '\x59', '\x26', '\x53', '\x59', '\xe5',
+    '\x1a', '\x3a', '\x75', '\x00', '\x00', '\x05', '\x58', '\x00', '\x00', '\x10', '\x00',
+    '\x07', '\x3f', '\x00', '\x20', '\x00', '\x22', '\x06', '\x86', '\x21', '\x00', '\x30',
+    '\x53', '\xa6', '\xc2', '\x6c', '\x1a', '\xa7', '\x2e', '\xfc', '\x5d', '\xc9', '\x14',
+    '\xe1', '\x42', '\x43', '\x94', '\x68', '\xe9', '\xd4'};
+  // Concatenated bzip2 files are decompressed as the concatenation of their contents
+  std::vector<char> compressed;
+  for (int i = 0; i < 2; ++i) {
+    compressed.insert(compressed.end(), stream.cbegin(), stream.cend());
+  }
+
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(
+      cudf_io::source_info{compressed.data(), compressed.size()})
+      .compression(cudf_io::compression_type::BZIP2)
+      .dtypes({dtype<int32_t>(), dtype<double>()})
+      .header(-1);
+  auto result = cudf_io::read_csv(in_opts);
+
+  const auto result_table = result.tbl->view();
+  ASSERT_EQ(result_table.num_columns(), 2);
+  expect_column_data_equal(std::vector<int32_t>{1, 3, -5, 1, 3, -5}, result_table.column(0));
+  expect_column_data_equal(std::vector<double>{2.5, 4.5, 6.5, 2.5, 4.5, 6.5},
+                           result_table.column(1));
+}
+
+TEST_F(CsvReaderTest, GzipIndexByteRange)
+{
+  // "1,2.5\n3,4.5\n-5,6.5\n", compressed with gzip
+  std::vector<char> const compressed{
+    '\x1f', '\x8b', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', '\x02', '\x03', '\x33', '\xd4',
+    '\x31', '\xd2', '\x33', '\xe5', '\x32', '\xd6', '\x31', '\x01', '\x92', '\xba', '\xa6', '\x3a',
+    '\x66', '\x40', '\x0a', '\x00', '\x0c', '\xd8', '\xa5', '\x4e', '\x13', '\x00', '\x00', '\x00'};
+  auto const source = cudf_io::source_info{compressed.data(), compressed.size()};
+
+  // Byte ranges of compressed data can only be read with an index
+  cudf_io::csv_reader_options no_index_opts =
+    cudf_io::csv_reader_options::builder(source)
+      .compression(cudf_io::compression_type::GZIP)
+      .header(-1)
+      .byte_range_offset(5)
+      .byte_range_size(6);
+  EXPECT_THROW(cudf_io::read_csv(no_index_opts), cudf::logic_error);
+
+  std::vector<char> index;
+  cudf_io::write_gzip_index(source, cudf_io::sink_info{&index});
+
+  // Only the row that starts within the range of the uncompressed data is read
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(source)
+      .compression(cudf_io::compression_type::GZIP)
+      .compression_index(cudf_io::source_info{index.data(), index.size()})
+      .dtypes({dtype<int32_t>(), dtype<double>()})
+      .header(-1)
+      .byte_range_offset(5)
+      .byte_range_size(6);
+  auto result = cudf_io::read_csv(in_opts);
+
+  const auto result_table = result.tbl->view();
+  ASSERT_EQ(result_table.num_columns(), 2);
+  expect_column_data_equal(std::vector<int32_t>{3}, result_table.column(0));
+  expect_column_data_equal(std::vector<double>{4.5}, result_table.column(1));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <io/utilities/io_read_planner.hpp>
+
+#include <cudf/io/datasource.hpp>
+
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+// Base test fixture for tests
+struct DatasourceTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+
+std::vector<uint8_t> write_test_file(std::string const& filepath, size_t size)
+{
+  std::vector<uint8_t> data(size);
+  std::iota(data.begin(), data.end(), 0);
+  std::ofstream outfile(filepath, std::ofstream::out | std::ofstream::binary);
+  outfile.write(reinterpret_cast<char const*>(data.data()), data.size());
+  outfile.close();
+  return data;
+}
+
+}  // namespace
+
+TEST_F(DatasourceTest, HostReadAsync)
+{
+  auto const filepath = temp_env->get_temp_filepath("HostReadAsync.bin");
+  // Larger than a single read slice to exercise the parallel reads
+  auto const expected = write_test_file(filepath, 9 * 1024 * 1024 + 7);
+
+  auto source = cudf::io::datasource::create(filepath);
+  std::vector<uint8_t> result(expected.size());
+  auto read_size = source->host_read_async(0, result.size(), result.data());
+  EXPECT_EQ(read_size.get(), expected.size());
+  EXPECT_EQ(result, expected);
+
+  // Reads past the end are clamped
+  std::vector<uint8_t> tail(100);
+  auto const tail_offset = expected.size() - 10;
+  EXPECT_EQ(source->host_read_async(tail_offset, tail.size(), tail.data()).get(), 10);
+  EXPECT_TRUE(std::equal(tail.begin(), tail.begin() + 10, expected.begin() + tail_offset));
+}
+
+TEST_F(DatasourceTest, HostReadBatch)
+{
+  auto const filepath = temp_env->get_temp_filepath("HostReadBatch.bin");
+  auto const expected = write_test_file(filepath, 1024 * 1024);
+
+  std::vector<cudf::io::datasource::range> ranges{
+    {0, 16}, {4096, 100000}, {512 * 1024, 3}, {expected.size() - 50, 100}};
+
+  auto source  = cudf::io::datasource::create(filepath);
+  auto buffers = source->host_read_batch(ranges);
+  ASSERT_EQ(buffers.size(), ranges.size());
+  for (size_t r = 0; r < ranges.size(); ++r) {
+    auto const expected_size = std::min(ranges[r].size, expected.size() - ranges[r].offset);
+    ASSERT_EQ(buffers[r]->size(), expected_size);
+    EXPECT_TRUE(std::equal(buffers[r]->data(),
+                           buffers[r]->data() + expected_size,
+                           expected.begin() + ranges[r].offset));
+  }
+}
+
+TEST_F(DatasourceTest, HostReadMappedWindow)
+{
+  auto const filepath = temp_env->get_temp_filepath("HostReadMappedWindow.bin");
+  auto const expected = write_test_file(filepath, 1024 * 1024);
+
+  // The mapping starts at the page that contains the offset
+  size_t const offset = 256 * 1024 + 100;
+  size_t const size   = 128 * 1024;
+  auto source         = cudf::io::datasource::create(filepath, offset, size);
+  auto const map_end  = offset + size;
+
+  // Async and batch reads are clamped to the mapped window, like the synchronous reads
+  std::vector<uint8_t> dst(1000);
+  EXPECT_EQ(source->host_read_async(map_end - 10, dst.size(), dst.data()).get(), 10);
+  EXPECT_TRUE(std::equal(dst.begin(), dst.begin() + 10, expected.begin() + map_end - 10));
+
+  auto buffers = source->host_read_batch({{offset, 16}, {map_end - 50, 100}});
+  ASSERT_EQ(buffers.size(), 2);
+  EXPECT_EQ(buffers[0]->size(), 16);
+  EXPECT_TRUE(std::equal(buffers[0]->data(), buffers[0]->data() + 16, expected.begin() + offset));
+  EXPECT_EQ(buffers[1]->size(), 50);
+  EXPECT_TRUE(std::equal(
+    buffers[1]->data(), buffers[1]->data() + 50, expected.begin() + map_end - 50));
+
+  // Offsets outside of the mapping are rejected
+  EXPECT_THROW(source->host_read_async(0, dst.size(), dst.data()).get(), cudf::logic_error);
+  EXPECT_THROW(source->host_read_batch({{0, 16}}), cudf::logic_error);
+  EXPECT_THROW(source->host_read_batch({{map_end + 1, 16}}), cudf::logic_error);
+}
+
+TEST_F(DatasourceTest, HostReadBatchDefault)
+{
+  std::vector<char> data(1000);
+  std::iota(data.begin(), data.end(), 0);
+
+  // Host buffer sources use the default, sequential implementation
+  auto source  = cudf::io::datasource::create(cudf::io::host_buffer{data.data(), data.size()});
+  auto buffers = source->host_read_batch({{10, 20}, {900, 100}});
+  ASSERT_EQ(buffers.size(), 2);
+  EXPECT_EQ(buffers[0]->size(), 20);
+  EXPECT_EQ(buffers[0]->data()[0], 10);
+  EXPECT_EQ(buffers[1]->size(), 100);
+  EXPECT_EQ(buffers[1]->data()[99], static_cast<uint8_t>(999));
+
+  std::vector<uint8_t> dst(5);
+  EXPECT_EQ(source->host_read_async(3, dst.size(), dst.data()).get(), dst.size());
+  EXPECT_EQ(dst[4], 7);
+}
+
+struct IoReadPlannerTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(IoReadPlannerTest, CoalesceWithinGap)
+{
+  using cudf::io::detail::byte_range;
+  cudf::io::detail::io_read_planner const planner(100, 1000);
+
+  // Unsorted input; the {5, 3} range overlaps with {0, 10}
+  std::vector<byte_range> ranges{
+    {500, 10}, {0, 10}, {20, 10}, {200, 50}, {255, 0}, {1000, 2000}, {3000, 10}, {5, 3}};
+  auto const plan = planner.plan(ranges);
+
+  ASSERT_EQ(plan.reads.size(), 5);
+  EXPECT_EQ(plan.reads[0].offset, 0);
+  EXPECT_EQ(plan.reads[0].size, 30);
+  EXPECT_EQ(plan.reads[1].offset, 200);
+  EXPECT_EQ(plan.reads[1].size, 50);
+  EXPECT_EQ(plan.reads[2].offset, 500);
+  // A range larger than the maximum request size is read on its own
+  EXPECT_EQ(plan.reads[3].offset, 1000);
+  EXPECT_EQ(plan.reads[3].size, 2000);
+  EXPECT_EQ(plan.reads[4].offset, 3000);
+
+  std::vector<size_t> const expected_read_index{2, 0, 0, 1, 1, 3, 4, 0};
+  EXPECT_EQ(plan.read_index, expected_read_index);
+  EXPECT_EQ(plan.offset_in_read(2, ranges[2]), 20);
+
+  EXPECT_EQ(plan.requested_bytes, 2093);
+  // Only the gap between {0, 10} and {20, 10} is read without being requested
+  EXPECT_EQ(plan.over_read_bytes, 10);
+  EXPECT_EQ(plan.requests_saved, 2);
+}
+
+TEST_F(IoReadPlannerTest, OverlapsDoNotHideGaps)
+{
+  using cudf::io::detail::byte_range;
+  cudf::io::detail::io_read_planner const planner(100, 1000);
+
+  // The duplicated range is requested twice, but its bytes are only read once
+  std::vector<byte_range> ranges{{0, 100}, {0, 100}, {150, 10}};
+  auto const plan = planner.plan(ranges);
+
+  ASSERT_EQ(plan.reads.size(), 1);
+  EXPECT_EQ(plan.reads[0].size, 160);
+  EXPECT_EQ(plan.requested_bytes, 210);
+  EXPECT_EQ(plan.over_read_bytes, 50);
+  EXPECT_EQ(plan.requests_saved, 2);
+}
+
+TEST_F(IoReadPlannerTest, NoGap)
+{
+  using cudf::io::detail::byte_range;
+  cudf::io::detail::io_read_planner const planner(0, 1 << 20);
+
+  // Only exactly adjacent ranges are merged
+  std::vector<byte_range> ranges{{0, 10}, {10, 10}, {21, 10}};
+  auto const plan = planner.plan(ranges);
+
+  ASSERT_EQ(plan.reads.size(), 2);
+  EXPECT_EQ(plan.reads[0].size, 20);
+  EXPECT_EQ(plan.over_read_bytes, 0);
+  EXPECT_EQ(plan.requests_saved, 1);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -1312,6 +1312,42 @@ TEST_F(OrcWriterTest, StripeSizeInvalid)
     cudf::logic_error);
 }
 
+TEST_F(OrcWriterTest, CompressionTypes)
+{
+  constexpr auto num_rows = 20000;
+  auto ints = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 123; });
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value " + std::to_string(i % 57); });
+  int32_col col0(ints, ints + num_rows);
+  str_col col1(strings, strings + num_rows);
+  table_view expected({col0, col1});
+
+  auto write_and_read = [&](cudf_io::compression_type compression, std::optional<int> level) {
+    std::vector<char> out_buffer;
+    auto out_opts =
+      cudf_io::orc_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+        .compression(compression);
+    if (level.has_value()) { out_opts.compression_level(level.value()); }
+    cudf_io::write_orc(out_opts);
+
+    auto in_opts = cudf_io::orc_reader_options::builder(
+      cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, cudf_io::read_orc(in_opts).tbl->view());
+  };
+
+  for (auto compression : {cudf_io::compression_type::ZLIB,
+                           cudf_io::compression_type::LZ4,
+                           cudf_io::compression_type::ZSTD}) {
+    write_and_read(compression, std::nullopt);
+  }
+  write_and_read(cudf_io::compression_type::ZLIB, 9);
+  write_and_read(cudf_io::compression_type::ZSTD, 1);
+  write_and_read(cudf_io::compression_type::ZSTD, 19);
+
+  EXPECT_THROW(write_and_read(cudf_io::compression_type::ZSTD, 23), cudf::logic_error);
+  EXPECT_THROW(write_and_read(cudf_io::compression_type::ZLIB, 10), cudf::logic_error);
+}
+
 TEST_F(OrcWriterTest, TestMap)
 {
   auto const num_rows       = 1200000;
@@ -1486,4 +1522,283 @@ TEST_F(OrcWriterTest, DecimalOptionsNested)
                                       result.tbl->view().column(0).child(1).child(0).child(1));
 }
 
+TEST_F(OrcReaderTest, FilterStripes)
+{
+  constexpr auto num_rows        = 20000;
+  constexpr auto rows_per_stripe = 5000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  int64_col times(sequence, sequence + num_rows);
+  auto names = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "stripe" + std::to_string(i / rows_per_stripe); });
+  str_col strings(names, names + num_rows);
+  table_view expected({times, strings});
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("times");
+  expected_metadata.column_metadata[1].set_name("names");
+
+  auto filepath = temp_env->get_temp_filepath("OrcFilterStripes.orc");
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .stripe_size_rows(rows_per_stripe)
+      .row_index_stride(rows_per_stripe);
+  cudf_io::write_orc(out_opts);
+
+  // Only the last two stripes can contain times >= 12000
+  cudf_io::orc_reader_options in_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath})
+      .filters({{"times", cudf_io::predicate_op::GREATER_EQUAL, int64_t{12000}}});
+  auto result = cudf_io::read_orc(in_opts);
+  EXPECT_EQ(result.metadata.num_stripes_pruned, 2);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {10000, num_rows})[0], result.tbl->view());
+
+  // Filters are combined as a conjunction and applied on top of the stripes selection
+  in_opts.set_stripes({{0, 1, 3}});
+  in_opts.set_filters({{"times", cudf_io::predicate_op::GREATER_EQUAL, int64_t{3000}},
+                       {"names", cudf_io::predicate_op::LESS_EQUAL, std::string("stripe1")}});
+  result = cudf_io::read_orc(in_opts);
+  EXPECT_EQ(result.metadata.num_stripes_pruned, 1);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {0, 10000})[0], result.tbl->view());
+
+  // All stripes pruned
+  in_opts.set_stripes({});
+  in_opts.set_filters({{"times", cudf_io::predicate_op::LESS, int64_t{0}}});
+  result = cudf_io::read_orc(in_opts);
+  EXPECT_EQ(result.metadata.num_stripes_pruned, 4);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+
+  in_opts.set_filters({{"missing", cudf_io::predicate_op::EQUAL, int64_t{0}}});
+  EXPECT_THROW(cudf_io::read_orc(in_opts), cudf::logic_error);
+  in_opts.set_filters({{"times", cudf_io::predicate_op::EQUAL, std::string("0")}});
+  EXPECT_THROW(cudf_io::read_orc(in_opts), cudf::logic_error);
+  EXPECT_THROW(in_opts.set_skip_rows(10), cudf::logic_error);
+}
+
+TEST_F(OrcReaderTest, FilterRowGroups)
+{
+  constexpr auto num_rows        = 20000;
+  constexpr auto rows_per_stripe = 10000;
+  constexpr auto rows_per_group  = 2000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  int64_col times(sequence, sequence + num_rows);
+  int32_col values(sequence, sequence + num_rows, validity);
+  auto names = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "name" + std::to_string(i); });
+  str_col strings(names, names + num_rows, validity);
+  table_view expected({times, values, strings});
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("times");
+  expected_metadata.column_metadata[1].set_name("values");
+  expected_metadata.column_metadata[2].set_name("names");
+
+  auto filepath = temp_env->get_temp_filepath("OrcFilterRowGroups.orc");
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .stripe_size_rows(rows_per_stripe)
+      .row_index_stride(rows_per_group);
+  cudf_io::write_orc(out_opts);
+
+  // Both stripes overlap the range; two row groups of the first stripe and three of the second
+  // stripe don't
+  cudf_io::orc_reader_options in_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath})
+      .filters({{"times", cudf_io::predicate_op::GREATER_EQUAL, int64_t{5000}},
+                {"times", cudf_io::predicate_op::LESS, int64_t{13000}}});
+  auto result = cudf_io::read_orc(in_opts);
+  EXPECT_EQ(result.metadata.num_stripes_pruned, 0);
+  EXPECT_EQ(result.metadata.num_row_groups_pruned, 5);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {4000, 14000})[0], result.tbl->view());
+
+  // Row groups are not skipped when the row index is not used
+  in_opts.enable_use_index(false);
+  result = cudf_io::read_orc(in_opts);
+  EXPECT_EQ(result.metadata.num_row_groups_pruned, 0);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+  // All row groups of the remaining stripe pruned
+  in_opts.enable_use_index(true);
+  in_opts.set_filters({{"times", cudf_io::predicate_op::GREATER_EQUAL, int64_t{5000}},
+                       {"times", cudf_io::predicate_op::LESS, int64_t{4000}}});
+  result = cudf_io::read_orc(in_opts);
+  EXPECT_EQ(result.metadata.num_stripes_pruned, 1);
+  EXPECT_EQ(result.metadata.num_row_groups_pruned, 5);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+  EXPECT_EQ(result.tbl->num_columns(), 3);
+}
+
+TEST_F(OrcWriterTest, BloomFilter)
+{
+  constexpr auto num_rows       = 20000;
+  constexpr auto rows_per_group = 2000;
+  // Each key appears once, but every row group spans almost the full range of keys
+  auto keys = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return int64_t{(i % 10) * 2000 + i / 10}; });
+  int64_col col(keys, keys + num_rows);
+  table_view expected({col});
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("keys").set_bloom_filter();
+
+  auto filepath = temp_env->get_temp_filepath("OrcBloomFilter.orc");
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .row_index_stride(rows_per_group);
+  cudf_io::write_orc(out_opts);
+
+  // Key 9000 is only in the sixth row group; statistics can't exclude any row group
+  cudf_io::orc_reader_options in_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath})
+      .filters({{"keys", cudf_io::predicate_op::EQUAL, int64_t{9000}}});
+  auto result = cudf_io::read_orc(in_opts);
+  EXPECT_EQ(result.metadata.num_row_groups_pruned, 9);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {10000, 12000})[0], result.tbl->view());
+
+  // Key 2100 is in the first row group
+  in_opts.set_filters({{"keys", cudf_io::predicate_op::IN, {}, {int64_t{9000}, int64_t{2100}}}});
+  result = cudf_io::read_orc(in_opts);
+  EXPECT_EQ(result.metadata.num_row_groups_pruned, 8);
+  EXPECT_EQ(result.tbl->num_rows(), 2 * rows_per_group);
+}
+
+TEST_F(OrcReaderTest, TailReadSize)
+{
+  constexpr auto num_rows        = 20000;
+  constexpr auto rows_per_stripe = 5000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  int64_col times(sequence, sequence + num_rows);
+  auto names = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "name" + std::to_string(i); });
+  str_col strings(names, names + num_rows);
+  table_view expected({times, strings});
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("times");
+  expected_metadata.column_metadata[1].set_name("names");
+
+  auto filepath = temp_env->get_temp_filepath("OrcTailReadSize.orc");
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .stripe_size_rows(rows_per_stripe);
+  cudf_io::write_orc(out_opts);
+
+  // A tail that only holds the postscript; the footer and the stripe statistics are read separately
+  for (size_t tail_read_size : {size_t{0}, cudf_io::default_orc_tail_read_size}) {
+    cudf_io::orc_reader_options in_opts =
+      cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath})
+        .tail_read_size(tail_read_size);
+    auto result = cudf_io::read_orc(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+    in_opts.set_filters({{"times", cudf_io::predicate_op::LESS, int64_t{rows_per_stripe}}});
+    result = cudf_io::read_orc(in_opts);
+    EXPECT_EQ(result.metadata.num_stripes_pruned, 3);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {0, rows_per_stripe})[0],
+                                  result.tbl->view());
+  }
+}
+
+TEST_F(OrcReaderTest, ChunkedRead)
+{
+  constexpr auto num_rows        = 20000;
+  constexpr auto rows_per_stripe = 5000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  int64_col times(sequence, sequence + num_rows);
+  auto names = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "name" + std::to_string(i); });
+  str_col strings(names, names + num_rows);
+  table_view expected({times, strings});
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("times");
+  expected_metadata.column_metadata[1].set_name("names");
+
+  auto filepath = temp_env->get_temp_filepath("OrcChunkedRead.orc");
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .stripe_size_rows(rows_per_stripe);
+  cudf_io::write_orc(out_opts);
+
+  auto read_chunks = [&](std::size_t chunk_read_limit, cudf_io::orc_reader_options options) {
+    auto reader = cudf_io::chunked_orc_reader(chunk_read_limit, options);
+    std::vector<cudf_io::table_with_metadata> chunks;
+    while (reader.has_next()) {
+      chunks.push_back(reader.read_chunk());
+    }
+    EXPECT_THROW(reader.read_chunk(), cudf::logic_error);
+    return chunks;
+  };
+  auto concatenate = [](std::vector<cudf_io::table_with_metadata> const& chunks) {
+    std::vector<table_view> views;
+    for (auto const& chunk : chunks) {
+      views.push_back(chunk.tbl->view());
+    }
+    return cudf::concatenate(views);
+  };
+
+  auto const in_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).build();
+  {
+    // No limit
+    auto chunks = read_chunks(0, in_opts);
+    ASSERT_EQ(chunks.size(), 1);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, chunks[0].tbl->view());
+  }
+  {
+    // A stripe per chunk
+    auto chunks = read_chunks(1, in_opts);
+    ASSERT_EQ(chunks.size(), num_rows / rows_per_stripe);
+    for (auto const& chunk : chunks) {
+      EXPECT_EQ(chunk.tbl->num_rows(), rows_per_stripe);
+    }
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, concatenate(chunks)->view());
+  }
+  {
+    // Row bounds within stripes
+    auto opts = in_opts;
+    opts.set_skip_rows(7000);
+    opts.set_num_rows(10000);
+    auto chunks = read_chunks(1, opts);
+    EXPECT_EQ(chunks.size(), 3);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {7000, 17000})[0],
+                                  concatenate(chunks)->view());
+  }
+  {
+    // Selected stripes
+    auto opts = in_opts;
+    opts.set_stripes({{1, 2}});
+    auto chunks = read_chunks(1, opts);
+    EXPECT_EQ(chunks.size(), 2);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {rows_per_stripe, 3 * rows_per_stripe})[0],
+                                  concatenate(chunks)->view());
+  }
+  {
+    // The pruned stripes are reported with the first chunk
+    auto opts = in_opts;
+    opts.set_filters({{"times", cudf_io::predicate_op::GREATER_EQUAL, int64_t{10000}}});
+    auto chunks = read_chunks(1, opts);
+    ASSERT_EQ(chunks.size(), 2);
+    EXPECT_EQ(chunks[0].metadata.num_stripes_pruned, 2);
+    EXPECT_EQ(chunks[1].metadata.num_stripes_pruned, 0);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {10000, num_rows})[0],
+                                  concatenate(chunks)->view());
+  }
+  {
+    // All the stripes are pruned
+    auto opts = in_opts;
+    opts.set_filters({{"times", cudf_io::predicate_op::LESS, int64_t{0}}});
+    auto chunks = read_chunks(1, opts);
+    ASSERT_EQ(chunks.size(), 1);
+    EXPECT_EQ(chunks[0].tbl->num_rows(), 0);
+    EXPECT_EQ(chunks[0].tbl->num_columns(), 2);
+  }
+}
+
 CUDF_TEST_PROGRAM_MAIN()
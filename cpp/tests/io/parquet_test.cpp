@@ -20,6 +20,7 @@
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/parquet.hpp>
+#include <cudf/io/parquet_metadata.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -35,6 +36,8 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <type_traits>
 
@@ -3177,6 +3180,769 @@ TEST_F(ParquetReaderTest, EmptyOutput)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
 }
 
+TEST_F(ParquetReaderTest, FooterCache)
+{
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int32_t> col(sequence, sequence + 20000);
+  table_view expected({col});
+
+  auto filepath = temp_env->get_temp_filepath("FooterCache.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .row_group_size_rows(5000);
+  cudf_io::write_parquet(out_opts);
+
+  cudf_io::set_parquet_footer_cache_capacity(1 << 20);
+  cudf_io::clear_parquet_footer_cache();
+  auto const initial = cudf_io::get_parquet_footer_cache_statistics();
+
+  // Read one row group at a time; only the first read parses the footer
+  for (int rg = 0; rg < 4; ++rg) {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+        .row_groups({{rg}});
+    auto result = cudf_io::read_parquet(read_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {rg * 5000, (rg + 1) * 5000})[0],
+                                  result.tbl->view());
+  }
+  auto stats = cudf_io::get_parquet_footer_cache_statistics();
+  EXPECT_EQ(stats.misses - initial.misses, 1);
+  EXPECT_EQ(stats.hits - initial.hits, 3);
+  EXPECT_EQ(stats.entries, 1);
+
+  // Rewriting the file changes its identity
+  column_wrapper<int32_t> col2(sequence, sequence + 100);
+  table_view expected2({col2});
+  cudf_io::parquet_writer_options out_opts2 =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected2);
+  cudf_io::write_parquet(out_opts2);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected2, result.tbl->view());
+  stats = cudf_io::get_parquet_footer_cache_statistics();
+  EXPECT_EQ(stats.misses - initial.misses, 2);
+
+  // Disabling the cache releases all entries
+  cudf_io::set_parquet_footer_cache_capacity(0);
+  EXPECT_EQ(cudf_io::get_parquet_footer_cache_statistics().entries, 0);
+}
+
+TEST_F(ParquetReaderTest, FilterRowGroups)
+{
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto names    = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "name_" + std::to_string(10000 + i); });
+  column_wrapper<int32_t> col0(sequence, sequence + 20000);
+  column_wrapper<double> col1(sequence, sequence + 20000);
+  cudf::test::strings_column_wrapper col2(names, names + 20000);
+  table_view expected({col0, col1, col2});
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("ints");
+  expected_metadata.column_metadata[1].set_name("doubles");
+  expected_metadata.column_metadata[2].set_name("strings");
+
+  auto filepath = temp_env->get_temp_filepath("FilterRowGroups.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .row_group_size_rows(5000);
+  cudf_io::write_parquet(out_opts);
+
+  auto read_filtered = [&](std::vector<cudf_io::column_predicate> filters) {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+        .filters(std::move(filters));
+    return cudf_io::read_parquet(read_opts);
+  };
+
+  {
+    auto result = read_filtered({{"ints", cudf_io::predicate_op::GREATER_EQUAL, int64_t{15000}}});
+    EXPECT_EQ(result.metadata.num_row_groups_pruned, 3);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {15000, 20000})[0], result.tbl->view());
+  }
+  {
+    // Conjunction of terms on different columns
+    auto result = read_filtered({{"doubles", cudf_io::predicate_op::LESS, 10000.0},
+                                 {"strings", cudf_io::predicate_op::GREATER, "name_14999"}});
+    EXPECT_EQ(result.metadata.num_row_groups_pruned, 3);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {5000, 10000})[0], result.tbl->view());
+  }
+  {
+    // Statistics can't exclude row groups based on nulls in non-null columns
+    auto result = read_filtered({{"ints", cudf_io::predicate_op::IS_NOT_NULL, int64_t{0}}});
+    EXPECT_EQ(result.metadata.num_row_groups_pruned, 0);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  }
+  {
+    auto result = read_filtered({{"ints", cudf_io::predicate_op::EQUAL, int64_t{-1}}});
+    EXPECT_EQ(result.metadata.num_row_groups_pruned, 4);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+
+  EXPECT_THROW(read_filtered({{"ints", cudf_io::predicate_op::EQUAL, std::string{"a"}}}),
+               cudf::logic_error);
+  EXPECT_THROW(read_filtered({{"missing", cudf_io::predicate_op::EQUAL, int64_t{0}}}),
+               cudf::logic_error);
+}
+
+TEST_F(ParquetReaderTest, CoalescedReadStatistics)
+{
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int32_t> col0(sequence, sequence + 1000);
+  column_wrapper<double> col1(sequence, sequence + 1000);
+  column_wrapper<int64_t> col2(sequence, sequence + 1000);
+  table_view expected({col0, col1, col2});
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("ints");
+  expected_metadata.column_metadata[1].set_name("doubles");
+  expected_metadata.column_metadata[2].set_name("longs");
+
+  auto filepath = temp_env->get_temp_filepath("CoalescedReadStatistics.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata);
+  cudf_io::write_parquet(out_opts);
+
+  // The chunk of the skipped column is a small gap between the selected ones, and is read through
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .columns({"ints", "longs"});
+  auto const result = cudf_io::read_parquet(read_opts);
+
+  EXPECT_GT(result.metadata.num_bytes_requested, 0);
+  EXPECT_GT(result.metadata.num_bytes_over_read, 0);
+  EXPECT_EQ(result.metadata.num_read_requests_saved, 1);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({col0, col2}), result.tbl->view());
+}
+
+TEST_F(ParquetReaderTest, PageIndexRowSelection)
+{
+  constexpr auto num_rows = 400000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  auto names = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "name_" + std::to_string(i); });
+  column_wrapper<int64_t> col0(sequence, sequence + num_rows);
+  column_wrapper<double> col1(sequence, sequence + num_rows, valids);
+  cudf::test::strings_column_wrapper col2(names, names + num_rows);
+  table_view expected({col0, col1, col2});
+
+  // Page statistics also write the page index, which lets the reader only fetch the pages that
+  // overlap the selected rows
+  auto filepath = temp_env->get_temp_filepath("PageIndexRowSelection.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .stats_level(cudf_io::statistics_freq::STATISTICS_PAGE)
+      .row_group_size_rows(num_rows / 2);
+  cudf_io::write_parquet(out_opts);
+
+  auto read_rows = [&](cudf::size_type skip, cudf::size_type count) {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+        .skip_rows(skip)
+        .num_rows(count);
+    return cudf_io::read_parquet(read_opts);
+  };
+
+  for (auto const& [skip_rows, rows] : std::vector<std::pair<cudf::size_type, cudf::size_type>>{
+         {0, 1}, {123456, 30000}, {num_rows / 2 - 10, 20}, {num_rows - 5, 5}, {1, num_rows - 2}}) {
+    auto result = read_rows(skip_rows, rows);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {skip_rows, skip_rows + rows})[0],
+                                  result.tbl->view());
+  }
+}
+
+TEST_F(ParquetReaderTest, PageIndexFilterNaNPages)
+{
+  constexpr auto num_rows = 1000;
+  auto nans               = cudf::detail::make_counting_transform_iterator(
+    0, [](auto) { return std::numeric_limits<double>::quiet_NaN(); });
+  column_wrapper<double> col0(nans, nans + num_rows);
+  table_view expected({col0});
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("nans");
+
+  // Pages of NaN values have no min/max but hold values; they must not be pruned as null pages
+  auto filepath = temp_env->get_temp_filepath("PageIndexFilterNaNPages.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .stats_level(cudf_io::statistics_freq::STATISTICS_PAGE);
+  cudf_io::write_parquet(out_opts);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .filters({{"nans", cudf_io::predicate_op::NOT_EQUAL, 1.0}});
+  auto result = cudf_io::read_parquet(read_opts);
+  EXPECT_EQ(result.tbl->num_rows(), num_rows);
+}
+
+TEST_F(ParquetReaderTest, ChunkedRead)
+{
+  constexpr auto num_rows = 400000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  auto names = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "name_" + std::to_string(i); });
+  column_wrapper<int64_t> col0(sequence, sequence + num_rows);
+  column_wrapper<double> col1(sequence, sequence + num_rows, valids);
+  cudf::test::strings_column_wrapper col2(names, names + num_rows);
+  table_view expected({col0, col1, col2});
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("ints");
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedRead.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .stats_level(cudf_io::statistics_freq::STATISTICS_PAGE)
+      .row_group_size_rows(num_rows / 4);
+  cudf_io::write_parquet(out_opts);
+
+  auto read_chunks = [&](std::size_t chunk_read_limit, cudf_io::parquet_reader_options options) {
+    auto reader = cudf_io::chunked_parquet_reader(chunk_read_limit, options);
+    std::vector<cudf_io::table_with_metadata> chunks;
+    while (reader.has_next()) {
+      chunks.push_back(reader.read_chunk());
+    }
+    EXPECT_THROW(reader.read_chunk(), cudf::logic_error);
+    return chunks;
+  };
+  auto concatenate = [](std::vector<cudf_io::table_with_metadata> const& chunks) {
+    std::vector<table_view> views;
+    for (auto const& chunk : chunks) {
+      views.push_back(chunk.tbl->view());
+    }
+    return cudf::concatenate(views);
+  };
+
+  auto const read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).build();
+  {
+    // No limit
+    auto chunks = read_chunks(0, read_opts);
+    ASSERT_EQ(chunks.size(), 1);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, chunks[0].tbl->view());
+  }
+  {
+    // Row groups are only split on the page boundaries shared by all the columns
+    auto chunks = read_chunks(1024 * 1024, read_opts);
+    EXPECT_GE(chunks.size(), 4);
+    for (auto const& chunk : chunks) {
+      EXPECT_GT(chunk.tbl->num_rows(), 0);
+    }
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, concatenate(chunks)->view());
+  }
+  {
+    // Each row group is split into multiple chunks
+    auto opts = read_opts;
+    opts.set_columns({"ints"});
+    auto chunks = read_chunks(256 * 1024, opts);
+    EXPECT_GT(chunks.size(), 4);
+    for (auto const& chunk : chunks) {
+      EXPECT_GT(chunk.tbl->num_rows(), 0);
+    }
+    CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({col0}), concatenate(chunks)->view());
+  }
+  {
+    // Row bounds
+    auto opts = read_opts;
+    opts.set_skip_rows(123456);
+    opts.set_num_rows(200000);
+    auto chunks = read_chunks(1024 * 1024, opts);
+    EXPECT_GT(chunks.size(), 1);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {123456, 323456})[0],
+                                  concatenate(chunks)->view());
+  }
+  {
+    // The pruned row groups are reported with the first chunk
+    auto opts = read_opts;
+    opts.set_filters({{"ints", cudf_io::predicate_op::GREATER_EQUAL, int64_t{300000}}});
+    auto chunks = read_chunks(1024 * 1024, opts);
+    EXPECT_EQ(chunks[0].metadata.num_row_groups_pruned, 3);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {300000, num_rows})[0],
+                                  concatenate(chunks)->view());
+  }
+  {
+    // All the row groups are pruned
+    auto opts = read_opts;
+    opts.set_filters({{"ints", cudf_io::predicate_op::LESS, int64_t{0}}});
+    auto chunks = read_chunks(1024 * 1024, opts);
+    ASSERT_EQ(chunks.size(), 1);
+    EXPECT_EQ(chunks[0].tbl->num_rows(), 0);
+    EXPECT_EQ(chunks[0].tbl->num_columns(), 3);
+  }
+}
+
+TEST_F(ParquetReaderTest, BloomFilter)
+{
+  constexpr auto rows_per_group = 5000;
+  constexpr auto num_rows       = 4 * rows_per_group;
+  // Every row group covers the whole value range, so min/max statistics can't prune any of them
+  auto values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return 8 * (i % rows_per_group) + i / rows_per_group; });
+  auto keys = cudf::detail::make_counting_transform_iterator(
+    0, [&](auto i) { return "key_" + std::to_string(values[i]); });
+  column_wrapper<int32_t> col0(values, values + num_rows);
+  cudf::test::strings_column_wrapper col1(keys, keys + num_rows);
+  table_view expected({col0, col1});
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("ints").set_bloom_filter();
+  expected_metadata.column_metadata[1].set_name("keys").set_bloom_filter();
+
+  auto filepath = temp_env->get_temp_filepath("BloomFilter.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .row_group_size_rows(rows_per_group);
+  cudf_io::write_parquet(out_opts);
+
+  auto read_filtered = [&](std::vector<cudf_io::column_predicate> filters) {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+        .filters(std::move(filters));
+    return cudf_io::read_parquet(read_opts);
+  };
+
+  // 9874 is only stored in the third row group
+  auto const slice = cudf::slice(expected, {2 * rows_per_group, 3 * rows_per_group})[0];
+  {
+    auto result = read_filtered({{"ints", cudf_io::predicate_op::EQUAL, int64_t{9874}}});
+    EXPECT_EQ(result.metadata.num_row_groups_pruned, 3);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(slice, result.tbl->view());
+  }
+  {
+    auto result = read_filtered({{"keys", cudf_io::predicate_op::EQUAL, "key_9874"}});
+    EXPECT_EQ(result.metadata.num_row_groups_pruned, 3);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(slice, result.tbl->view());
+  }
+  {
+    // Within the min/max range of every row group, but not in the file
+    auto result = read_filtered({{"ints", cudf_io::predicate_op::EQUAL, int64_t{32007}},
+                                 {"keys", cudf_io::predicate_op::EQUAL, "key_32007"}});
+    EXPECT_EQ(result.metadata.num_row_groups_pruned, 4);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+  {
+    // Bloom filters only apply to equality predicates
+    auto result = read_filtered({{"ints", cudf_io::predicate_op::NOT_EQUAL, int64_t{32007}}});
+    EXPECT_EQ(result.metadata.num_row_groups_pruned, 0);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  }
+
+  EXPECT_THROW(expected_metadata.column_metadata[0].set_bloom_filter(1.0), cudf::logic_error);
+}
+
+TEST_F(ParquetReaderTest, DeltaEncodings)
+{
+  // 130 rows in one row group, with a single page per column; each page holds two blocks of
+  // deltas.
+  //  ints:  required int32, DELTA_BINARY_PACKED, i * 3 - 100 + i % 5
+  //  longs: optional int64, DELTA_BINARY_PACKED, i * 1000000007, null if i % 3 == 0
+  //  names: required string, DELTA_LENGTH_BYTE_ARRAY, to_string(i * 7)
+  //  paths: required string, DELTA_BYTE_ARRAY, "dir/" + to_string(i / 10) + "/file" + to_string(i)
+  const unsigned char delta_parquet[] = {
+      0x50, 0x41, 0x52, 0x31, 0x15, 0x00, 0x15, 0x82, 0x01, 0x15, 0x82, 0x01, 0x2c, 0x15, 0x84,
+      0x02, 0x15, 0x0a, 0x15, 0x06, 0x15, 0x06, 0x00, 0x00, 0x80, 0x01, 0x04, 0x82, 0x01, 0xc7,
+      0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x6d, 0x8b, 0xb6, 0x45, 0xdb, 0xa2, 0x6d, 0xd1, 0xb6,
+      0x68, 0x5b, 0xb4, 0x2d, 0xda, 0x16, 0x6d, 0x8b, 0xb6, 0x45, 0xdb, 0xa2, 0x6d, 0xd1, 0xb6,
+      0x68, 0x5b, 0xb4, 0x2d, 0xda, 0x16, 0x6d, 0x8b, 0xb6, 0x45, 0xdb, 0xa2, 0x6d, 0xd1, 0xb6,
+      0x68, 0x5b, 0xb4, 0x2d, 0xda, 0x16, 0x6d, 0x8b, 0xb6, 0x08, 0x00, 0x00, 0x00, 0x00, 0x15,
+      0x00, 0x15, 0xa0, 0x06, 0x15, 0xa0, 0x06, 0x2c, 0x15, 0x84, 0x02, 0x15, 0x0a, 0x15, 0x06,
+      0x15, 0x06, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x23, 0xb6, 0x6d, 0xdb, 0xb6, 0x6d, 0xdb,
+      0xb6, 0x6d, 0xdb, 0xb6, 0x6d, 0xdb, 0xb6, 0x6d, 0xdb, 0xb6, 0x01, 0x80, 0x01, 0x04, 0x56,
+      0x8e, 0xa8, 0xd6, 0xb9, 0x07, 0x8e, 0xa8, 0xd6, 0xb9, 0x07, 0x1e, 0x1e, 0x1e, 0x00, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0xc0, 0x81, 0xb2, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x28, 0x6b, 0xee, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+      0x00, 0x15, 0x92, 0x06, 0x15, 0x92, 0x06, 0x2c, 0x15, 0x84, 0x02, 0x15, 0x0c, 0x15, 0x06,
+      0x15, 0x06, 0x00, 0x00, 0x80, 0x01, 0x04, 0x82, 0x01, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x37, 0x31, 0x34, 0x32, 0x31,
+      0x32, 0x38, 0x33, 0x35, 0x34, 0x32, 0x34, 0x39, 0x35, 0x36, 0x36, 0x33, 0x37, 0x30, 0x37,
+      0x37, 0x38, 0x34, 0x39, 0x31, 0x39, 0x38, 0x31, 0x30, 0x35, 0x31, 0x31, 0x32, 0x31, 0x31,
+      0x39, 0x31, 0x32, 0x36, 0x31, 0x33, 0x33, 0x31, 0x34, 0x30, 0x31, 0x34, 0x37, 0x31, 0x35,
+      0x34, 0x31, 0x36, 0x31, 0x31, 0x36, 0x38, 0x31, 0x37, 0x35, 0x31, 0x38, 0x32, 0x31, 0x38,
+      0x39, 0x31, 0x39, 0x36, 0x32, 0x30, 0x33, 0x32, 0x31, 0x30, 0x32, 0x31, 0x37, 0x32, 0x32,
+      0x34, 0x32, 0x33, 0x31, 0x32, 0x33, 0x38, 0x32, 0x34, 0x35, 0x32, 0x35, 0x32, 0x32, 0x35,
+      0x39, 0x32, 0x36, 0x36, 0x32, 0x37, 0x33, 0x32, 0x38, 0x30, 0x32, 0x38, 0x37, 0x32, 0x39,
+      0x34, 0x33, 0x30, 0x31, 0x33, 0x30, 0x38, 0x33, 0x31, 0x35, 0x33, 0x32, 0x32, 0x33, 0x32,
+      0x39, 0x33, 0x33, 0x36, 0x33, 0x34, 0x33, 0x33, 0x35, 0x30, 0x33, 0x35, 0x37, 0x33, 0x36,
+      0x34, 0x33, 0x37, 0x31, 0x33, 0x37, 0x38, 0x33, 0x38, 0x35, 0x33, 0x39, 0x32, 0x33, 0x39,
+      0x39, 0x34, 0x30, 0x36, 0x34, 0x31, 0x33, 0x34, 0x32, 0x30, 0x34, 0x32, 0x37, 0x34, 0x33,
+      0x34, 0x34, 0x34, 0x31, 0x34, 0x34, 0x38, 0x34, 0x35, 0x35, 0x34, 0x36, 0x32, 0x34, 0x36,
+      0x39, 0x34, 0x37, 0x36, 0x34, 0x38, 0x33, 0x34, 0x39, 0x30, 0x34, 0x39, 0x37, 0x35, 0x30,
+      0x34, 0x35, 0x31, 0x31, 0x35, 0x31, 0x38, 0x35, 0x32, 0x35, 0x35, 0x33, 0x32, 0x35, 0x33,
+      0x39, 0x35, 0x34, 0x36, 0x35, 0x35, 0x33, 0x35, 0x36, 0x30, 0x35, 0x36, 0x37, 0x35, 0x37,
+      0x34, 0x35, 0x38, 0x31, 0x35, 0x38, 0x38, 0x35, 0x39, 0x35, 0x36, 0x30, 0x32, 0x36, 0x30,
+      0x39, 0x36, 0x31, 0x36, 0x36, 0x32, 0x33, 0x36, 0x33, 0x30, 0x36, 0x33, 0x37, 0x36, 0x34,
+      0x34, 0x36, 0x35, 0x31, 0x36, 0x35, 0x38, 0x36, 0x36, 0x35, 0x36, 0x37, 0x32, 0x36, 0x37,
+      0x39, 0x36, 0x38, 0x36, 0x36, 0x39, 0x33, 0x37, 0x30, 0x30, 0x37, 0x30, 0x37, 0x37, 0x31,
+      0x34, 0x37, 0x32, 0x31, 0x37, 0x32, 0x38, 0x37, 0x33, 0x35, 0x37, 0x34, 0x32, 0x37, 0x34,
+      0x39, 0x37, 0x35, 0x36, 0x37, 0x36, 0x33, 0x37, 0x37, 0x30, 0x37, 0x37, 0x37, 0x37, 0x38,
+      0x34, 0x37, 0x39, 0x31, 0x37, 0x39, 0x38, 0x38, 0x30, 0x35, 0x38, 0x31, 0x32, 0x38, 0x31,
+      0x39, 0x38, 0x32, 0x36, 0x38, 0x33, 0x33, 0x38, 0x34, 0x30, 0x38, 0x34, 0x37, 0x38, 0x35,
+      0x34, 0x38, 0x36, 0x31, 0x38, 0x36, 0x38, 0x38, 0x37, 0x35, 0x38, 0x38, 0x32, 0x38, 0x38,
+      0x39, 0x38, 0x39, 0x36, 0x39, 0x30, 0x33, 0x15, 0x00, 0x15, 0xb8, 0x06, 0x15, 0xb8, 0x06,
+      0x2c, 0x15, 0x84, 0x02, 0x15, 0x0e, 0x15, 0x06, 0x15, 0x06, 0x00, 0x00, 0x80, 0x01, 0x04,
+      0x82, 0x01, 0x00, 0x0f, 0x05, 0x04, 0x04, 0x05, 0x12, 0x21, 0x84, 0x10, 0x42, 0x48, 0x3c,
+      0x84, 0x10, 0x42, 0x08, 0xa1, 0xf0, 0x10, 0x42, 0x08, 0x21, 0x84, 0xc2, 0x43, 0x88, 0x88,
+      0x88, 0x18, 0x8f, 0x88, 0x88, 0x88, 0x18, 0x8f, 0x88, 0x88, 0x88, 0x18, 0x8f, 0x88, 0x88,
+      0x88, 0x18, 0x8f, 0x88, 0x88, 0x88, 0x18, 0x8f, 0x88, 0x88, 0x88, 0x18, 0x8f, 0x88, 0x88,
+      0x08, 0xa1, 0x10, 0x11, 0x42, 0x08, 0x21, 0x84, 0x00, 0x44, 0x08, 0x21, 0x84, 0x10, 0x02,
+      0x10, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x04, 0x82, 0x01,
+      0x16, 0x13, 0x05, 0x05, 0x05, 0x05, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x2a, 0x0e, 0xa5, 0x94,
+      0x52, 0x4a, 0xa9, 0x38, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0xe2, 0x50, 0x4a, 0x29, 0xa5, 0x94,
+      0x8a, 0x43, 0x29, 0xa5, 0x94, 0x52, 0x2a, 0x0e, 0xa5, 0x94, 0x52, 0x4a, 0xa9, 0x38, 0x94,
+      0x52, 0x4a, 0x29, 0xa5, 0xe2, 0x50, 0x4a, 0x29, 0xa5, 0x94, 0x8a, 0x43, 0x29, 0xa5, 0x94,
+      0x52, 0x2a, 0x0e, 0xa5, 0x94, 0x52, 0x4a, 0xa9, 0x19, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0xa4,
+      0x50, 0x4a, 0x29, 0xa5, 0x94, 0x92, 0x42, 0x29, 0xa5, 0x94, 0x52, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x64, 0x69, 0x72, 0x2f, 0x30, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x30, 0x31, 0x32, 0x33,
+      0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x31, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x31, 0x30, 0x31,
+      0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x32, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x32,
+      0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x33, 0x2f, 0x66, 0x69, 0x6c,
+      0x65, 0x33, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x34, 0x2f, 0x66,
+      0x69, 0x6c, 0x65, 0x34, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x35,
+      0x2f, 0x66, 0x69, 0x6c, 0x65, 0x35, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+      0x39, 0x36, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x36, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+      0x37, 0x38, 0x39, 0x37, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x37, 0x30, 0x31, 0x32, 0x33, 0x34,
+      0x35, 0x36, 0x37, 0x38, 0x39, 0x38, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x38, 0x30, 0x31, 0x32,
+      0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x39, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x39, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x31, 0x30, 0x2f, 0x66, 0x69, 0x6c,
+      0x65, 0x31, 0x30, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x31, 0x2f,
+      0x66, 0x69, 0x6c, 0x65, 0x31, 0x31, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+      0x39, 0x32, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x31, 0x32, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+      0x36, 0x37, 0x38, 0x39, 0x15, 0x02, 0x19, 0x5c, 0x48, 0x06, 0x73, 0x63, 0x68, 0x65, 0x6d,
+      0x61, 0x15, 0x08, 0x00, 0x15, 0x02, 0x25, 0x00, 0x18, 0x04, 0x69, 0x6e, 0x74, 0x73, 0x00,
+      0x15, 0x04, 0x25, 0x02, 0x18, 0x05, 0x6c, 0x6f, 0x6e, 0x67, 0x73, 0x00, 0x15, 0x0c, 0x25,
+      0x00, 0x18, 0x05, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x25, 0x00, 0x00, 0x15, 0x0c, 0x25, 0x00,
+      0x18, 0x05, 0x70, 0x61, 0x74, 0x68, 0x73, 0x25, 0x00, 0x00, 0x16, 0x84, 0x02, 0x19, 0x1c,
+      0x19, 0x4c, 0x26, 0x08, 0x1c, 0x15, 0x02, 0x19, 0x25, 0x0a, 0x06, 0x19, 0x18, 0x04, 0x69,
+      0x6e, 0x74, 0x73, 0x15, 0x00, 0x16, 0x84, 0x02, 0x16, 0xaa, 0x01, 0x16, 0xaa, 0x01, 0x26,
+      0x08, 0x00, 0x00, 0x26, 0xb2, 0x01, 0x1c, 0x15, 0x04, 0x19, 0x25, 0x0a, 0x06, 0x19, 0x18,
+      0x05, 0x6c, 0x6f, 0x6e, 0x67, 0x73, 0x15, 0x00, 0x16, 0x84, 0x02, 0x16, 0xc8, 0x06, 0x16,
+      0xc8, 0x06, 0x26, 0xb2, 0x01, 0x00, 0x00, 0x26, 0xfa, 0x07, 0x1c, 0x15, 0x0c, 0x19, 0x25,
+      0x0c, 0x06, 0x19, 0x18, 0x05, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x15, 0x00, 0x16, 0x84, 0x02,
+      0x16, 0xba, 0x06, 0x16, 0xba, 0x06, 0x26, 0xfa, 0x07, 0x00, 0x00, 0x26, 0xb4, 0x0e, 0x1c,
+      0x15, 0x0c, 0x19, 0x25, 0x0e, 0x06, 0x19, 0x18, 0x05, 0x70, 0x61, 0x74, 0x68, 0x73, 0x15,
+      0x00, 0x16, 0x84, 0x02, 0x16, 0xe0, 0x06, 0x16, 0xe0, 0x06, 0x26, 0xb4, 0x0e, 0x00, 0x00,
+      0x16, 0x8c, 0x15, 0x16, 0x84, 0x02, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x50, 0x41, 0x52,
+      0x31};
+  unsigned int delta_parquet_len = 1576;
+
+  cudf_io::parquet_reader_options read_opts = cudf_io::parquet_reader_options::builder(
+    cudf_io::source_info{reinterpret_cast<const char*>(delta_parquet), delta_parquet_len});
+  auto result = cudf_io::read_parquet(read_opts);
+
+  constexpr int num_rows = 130;
+  auto ints_seq  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(i * 3 - 100 + i % 5); });
+  auto longs_seq = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int64_t>(i) * 1000000007; });
+  auto validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  std::vector<std::string> names(num_rows);
+  std::vector<std::string> paths(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    names[i] = std::to_string(i * 7);
+    paths[i] = "dir/" + std::to_string(i / 10) + "/file" + std::to_string(i);
+  }
+
+  column_wrapper<int32_t> ints(ints_seq, ints_seq + num_rows);
+  column_wrapper<int64_t> longs(longs_seq, longs_seq + num_rows, validity);
+  cudf::test::strings_column_wrapper names_col(names.begin(), names.end());
+  cudf::test::strings_column_wrapper paths_col(paths.begin(), paths.end());
+
+  ASSERT_EQ(result.tbl->view().num_columns(), 4);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->view().column(0), ints);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->view().column(1), longs);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->view().column(2), names_col);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->view().column(3), paths_col);
+
+  // Skipping rows starts decoding in the middle of the expanded pages
+  read_opts.set_skip_rows(100);
+  read_opts.set_num_rows(20);
+  auto const sliced = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sliced.tbl->view().column(1),
+                                 cudf::slice(longs, {100, 120})[0]);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sliced.tbl->view().column(3),
+                                 cudf::slice(paths_col, {100, 120})[0]);
+}
+
+TEST_F(ParquetReaderTest, ReadMetadata)
+{
+  constexpr auto num_rows = 10000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 4 != 3; });
+  column_wrapper<int32_t> ints(sequence, sequence + num_rows, validity);
+  std::vector<std::string> const names{"kiwi", "apple", "fig", "banana"};
+  auto name_elements = cudf::detail::make_counting_transform_iterator(
+    0, [&](auto i) { return names[i % names.size()]; });
+  column_wrapper<cudf::string_view> strings(name_elements, name_elements + num_rows);
+  table_view expected({ints, strings});
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("ints");
+  expected_metadata.column_metadata[1].set_name("strings").set_nullability(false);
+
+  std::vector<char> out_buffer;
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+      .metadata(&expected_metadata)
+      .key_value_metadata({{{"origin", "ReadMetadata"}}})
+      .compression(cudf_io::compression_type::SNAPPY)
+      .row_group_size_rows(num_rows / 2);
+  cudf_io::write_parquet(out_opts);
+
+  auto const metadata = cudf_io::read_parquet_metadata(
+    cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+
+  EXPECT_EQ(metadata.num_rows, num_rows);
+  EXPECT_EQ(metadata.key_value_metadata.at("origin"), "ReadMetadata");
+
+  ASSERT_EQ(metadata.schema.children.size(), 2);
+  EXPECT_FALSE(metadata.schema.physical_type.has_value());
+  EXPECT_EQ(metadata.schema.children[0].name, "ints");
+  EXPECT_EQ(metadata.schema.children[0].physical_type, cudf_io::parquet_physical_type::INT32);
+  EXPECT_EQ(metadata.schema.children[0].repetition_type,
+            cudf_io::parquet_repetition_type::OPTIONAL);
+  EXPECT_EQ(metadata.schema.children[1].name, "strings");
+  EXPECT_EQ(metadata.schema.children[1].physical_type,
+            cudf_io::parquet_physical_type::BYTE_ARRAY);
+  EXPECT_EQ(metadata.schema.children[1].repetition_type,
+            cudf_io::parquet_repetition_type::REQUIRED);
+
+  ASSERT_EQ(metadata.row_groups.size(), 2);
+  for (int rg = 0; rg < 2; ++rg) {
+    auto const& row_group = metadata.row_groups[rg];
+    EXPECT_EQ(row_group.num_rows, num_rows / 2);
+    EXPECT_GT(row_group.total_byte_size, 0);
+    ASSERT_EQ(row_group.columns.size(), 2);
+
+    auto const& int_chunk = row_group.columns[0];
+    EXPECT_EQ(int_chunk.path_in_schema, std::vector<std::string>{"ints"});
+    EXPECT_EQ(int_chunk.codec, cudf_io::parquet_compression::SNAPPY);
+    EXPECT_EQ(int_chunk.num_values, num_rows / 2);
+    EXPECT_GT(int_chunk.total_compressed_size, 0);
+    EXPECT_GT(int_chunk.data_page_offset, 0);
+    EXPECT_NE(std::find(int_chunk.encodings.cbegin(),
+                        int_chunk.encodings.cend(),
+                        cudf_io::parquet_encoding::RLE),
+              int_chunk.encodings.cend());
+    EXPECT_EQ(int_chunk.statistics.null_count, num_rows / 8);
+    ASSERT_TRUE(int_chunk.statistics.minimum.has_value());
+    ASSERT_TRUE(int_chunk.statistics.maximum.has_value());
+    EXPECT_EQ(std::get<int64_t>(int_chunk.statistics.minimum.value()), rg * num_rows / 2);
+    EXPECT_EQ(std::get<int64_t>(int_chunk.statistics.maximum.value()), (rg + 1) * num_rows / 2 - 2);
+
+    auto const& string_chunk = row_group.columns[1];
+    EXPECT_EQ(string_chunk.physical_type, cudf_io::parquet_physical_type::BYTE_ARRAY);
+    EXPECT_EQ(string_chunk.statistics.null_count, 0);
+    ASSERT_TRUE(string_chunk.statistics.minimum.has_value());
+    ASSERT_TRUE(string_chunk.statistics.maximum.has_value());
+    EXPECT_EQ(std::get<std::string>(string_chunk.statistics.minimum.value()), "apple");
+    EXPECT_EQ(std::get<std::string>(string_chunk.statistics.maximum.value()), "kiwi");
+  }
+}
+
+TEST_F(ParquetWriterTest, CompressionTypes)
+{
+  constexpr auto num_rows = 20000;
+  auto ints = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 123; });
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value " + std::to_string(i % 57); });
+  column_wrapper<int32_t> col0(ints, ints + num_rows);
+  cudf::test::strings_column_wrapper col1(strings, strings + num_rows);
+  table_view expected({col0, col1});
+
+  auto write_and_read = [&](cudf_io::compression_type compression, std::optional<int> level) {
+    std::vector<char> out_buffer;
+    auto out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+        .compression(compression);
+    if (level.has_value()) { out_opts.compression_level(level.value()); }
+    cudf_io::write_parquet(out_opts);
+
+    auto in_opts = cudf_io::parquet_reader_options::builder(
+      cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, cudf_io::read_parquet(in_opts).tbl->view());
+  };
+
+  for (auto compression : {cudf_io::compression_type::GZIP,
+                           cudf_io::compression_type::LZ4,
+                           cudf_io::compression_type::ZSTD}) {
+    write_and_read(compression, std::nullopt);
+  }
+  write_and_read(cudf_io::compression_type::GZIP, 9);
+  write_and_read(cudf_io::compression_type::ZSTD, 1);
+  write_and_read(cudf_io::compression_type::ZSTD, 19);
+
+  EXPECT_THROW(write_and_read(cudf_io::compression_type::ZSTD, 23), cudf::logic_error);
+  EXPECT_THROW(write_and_read(cudf_io::compression_type::GZIP, 10), cudf::logic_error);
+}
+
+TEST_F(ParquetWriterTest, ByteStreamSplit)
+{
+  constexpr auto num_rows = 20000;
+  auto floats   = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<float>(std::sin(i * 0.001)); });
+  auto doubles  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return 20.0 + std::cos(i * 0.0001) * 0.5; });
+  auto ints     = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  column_wrapper<float> col0(floats, floats + num_rows, validity);
+  column_wrapper<double> col1(doubles, doubles + num_rows);
+  column_wrapper<int32_t> col2(ints, ints + num_rows);
+  table_view expected({col0, col1, col2});
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("floats").set_byte_stream_split(true);
+  expected_metadata.column_metadata[1].set_name("doubles").set_byte_stream_split(true);
+  // Ignored for integral columns
+  expected_metadata.column_metadata[2].set_name("ints").set_byte_stream_split(true);
+
+  for (auto compression : {cudf_io::compression_type::NONE, cudf_io::compression_type::SNAPPY}) {
+    std::vector<char> out_buffer;
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+        .metadata(&expected_metadata)
+        .compression(compression);
+    cudf_io::write_parquet(out_opts);
+
+    cudf_io::parquet_reader_options in_opts = cudf_io::parquet_reader_options::builder(
+      cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+    auto result = cudf_io::read_parquet(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  }
+
+  // The first byte of every value comes first, then the second byte, and so on
+  std::vector<double> values{1.0, -2.5, 1e100};
+  column_wrapper<double> small_col(values.begin(), values.end());
+  table_view small_table({small_col});
+  cudf_io::table_input_metadata small_metadata(small_table);
+  small_metadata.column_metadata[0].set_name("doubles").set_byte_stream_split(true);
+  std::vector<char> out_buffer;
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&out_buffer), small_table)
+      .metadata(&small_metadata)
+      .compression(cudf_io::compression_type::NONE);
+  cudf_io::write_parquet(out_opts);
+
+  std::vector<char> split_values;
+  for (size_t k = 0; k < sizeof(double); ++k) {
+    for (auto const v : values) {
+      split_values.push_back(reinterpret_cast<char const*>(&v)[k]);
+    }
+  }
+  EXPECT_NE(
+    std::search(out_buffer.begin(), out_buffer.end(), split_values.begin(), split_values.end()),
+    out_buffer.end());
+}
+
+TEST_F(ParquetWriterTest, DictionaryCardinalityEstimate)
+{
+  constexpr auto num_rows = 100000;
+  std::vector<std::string> uuids(num_rows);
+  std::vector<std::string> categories(num_rows);
+  std::mt19937 engine{42};
+  for (int i = 0; i < num_rows; ++i) {
+    uuids[i]      = std::to_string(engine()) + "-" + std::to_string(i);
+    categories[i] = "category_" + std::to_string(i % 100);
+  }
+  cudf::test::strings_column_wrapper col0(uuids.begin(), uuids.end());
+  cudf::test::strings_column_wrapper col1(categories.begin(), categories.end());
+  table_view expected({col0, col1});
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("uuids");
+  expected_metadata.column_metadata[1].set_name("categories");
+
+  std::vector<char> out_buffer;
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+      .metadata(&expected_metadata);
+  std::vector<cudf_io::parquet_column_chunk_encoding> encoding_info;
+  cudf_io::write_parquet(out_opts, encoding_info);
+
+  ASSERT_EQ(encoding_info.size(), 2);
+
+  // Unique values: the dictionary pass is skipped up front
+  auto const& uuid_chunk = encoding_info[0];
+  EXPECT_EQ(uuid_chunk.column_path, "uuids");
+  EXPECT_EQ(uuid_chunk.row_group, 0);
+  EXPECT_FALSE(uuid_chunk.is_dictionary_encoded);
+  EXPECT_TRUE(uuid_chunk.is_dictionary_skipped);
+  EXPECT_NEAR(uuid_chunk.estimated_cardinality, num_rows, num_rows * 0.1);
+  EXPECT_EQ(uuid_chunk.cardinality, -1);
+
+  // Low cardinality: the dictionary is built, and the estimate matches the exact count
+  auto const& category_chunk = encoding_info[1];
+  EXPECT_EQ(category_chunk.column_path, "categories");
+  EXPECT_TRUE(category_chunk.is_dictionary_encoded);
+  EXPECT_FALSE(category_chunk.is_dictionary_skipped);
+  EXPECT_EQ(category_chunk.cardinality, 100);
+  EXPECT_NEAR(category_chunk.estimated_cardinality, 100, 10);
+
+  cudf_io::parquet_reader_options in_opts = cudf_io::parquet_reader_options::builder(
+    cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+  auto result = cudf_io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+TEST_F(ParquetChunkedWriterTest, ColumnChunkEncodings)
+{
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 10; });
+  column_wrapper<int32_t> col0(sequence, sequence + 1000);
+  column_wrapper<int64_t> col1(sequence, sequence + 1000);
+  table_view table({col0, col1});
+
+  std::vector<char> out_buffer;
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info(&out_buffer));
+  cudf_io::parquet_chunked_writer writer(args);
+  writer.write(table).write(table);
+  writer.close();
+
+  // One entry per column chunk, with a row group per write() call
+  auto const& encodings = writer.column_chunk_encodings();
+  ASSERT_EQ(encodings.size(), 4);
+  for (size_t i = 0; i < encodings.size(); ++i) {
+    EXPECT_EQ(encodings[i].row_group, static_cast<cudf::size_type>(i / 2));
+    EXPECT_TRUE(encodings[i].is_dictionary_encoded);
+    EXPECT_EQ(encodings[i].cardinality, 10);
+  }
+}
+
 TEST_F(ParquetWriterTest, RowGroupSizeInvalid)
 {
   const auto unused_table = std::make_unique<table>();
@@ -141,6 +141,10 @@ cdef compression_type _get_comp_type(object compression):
         return compression_type.NONE
     elif compression == "snappy":
         return compression_type.SNAPPY
+    elif compression == "zstd":
+        return compression_type.ZSTD
+    elif compression == "lz4":
+        return compression_type.LZ4
     else:
         raise ValueError(f"Unsupported `compression` type {compression}")
 
@@ -712,7 +712,7 @@ class ParquetDatasetWriter:
             If ``True``, include the dataframe’s index(es) in the file output.
             If ``False``, they will not be written to the file. If ``None``,
             index(es) other than RangeIndex will be saved as columns.
-        compression : {'snappy', None}, default 'snappy'
+        compression : {'snappy', 'zstd', 'lz4', None}, default 'snappy'
             Name of the compression to use. Use ``None`` for no compression.
         statistics : {'ROWGROUP', 'PAGE', 'NONE'}, default 'ROWGROUP'
             Level at which column statistics should be included in file.
@@ -353,7 +353,7 @@ def test_orc_reader_nodata_block(datadir):
     assert_eq(expect, got, check_categorical=False)
 
 
-@pytest.mark.parametrize("compression", [None, "snappy"])
+@pytest.mark.parametrize("compression", [None, "snappy", "zstd", "lz4"])
 @pytest.mark.parametrize(
     "reference_file, columns",
     [
@@ -624,6 +624,26 @@ def test_orc_reader_tzif_timestamps(datadir):
     assert_eq(pdf, gdf)
 
 
+def test_orc_reader_cached_timezone_tables(datadir):
+    # Timezone tables are cached across reads; files written in different
+    # timezones are read in turn, so that a table found under the wrong key
+    # would change the result
+    paths = [
+        datadir / "TestOrcFile.lima_timezone.orc",
+        datadir / "TestOrcFile.gmt.orc",
+    ]
+    try:
+        expected = [pa.orc.ORCFile(path).read().to_pandas() for path in paths]
+    except pa.ArrowIOError as e:
+        pytest.skip(".orc file is not found: %s" % e)
+
+    first_reads = [cudf.read_orc(path) for path in paths]
+    for path, first, expect in zip(paths, first_reads, expected):
+        second = cudf.read_orc(path)
+        assert_eq(first, second)
+        assert_eq(expect, second.to_pandas())
+
+
 def test_int_overflow(tmpdir):
     file_path = tmpdir.join("gdf_overflow.orc")
 
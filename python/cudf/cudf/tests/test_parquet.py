@@ -1430,6 +1430,31 @@ def test_parquet_writer_int96_timestamps(tmpdir, pdf, gdf):
     assert_eq(expect, got, check_categorical=False)
 
 
+# Files are decoded by pyarrow so that a format bug shared by the cudf
+# encoder and decoder does not go unnoticed
+@pytest.mark.parametrize("compression", ["zstd", "lz4"])
+def test_parquet_writer_compression_pyarrow_read(tmpdir, compression):
+    fname = tmpdir.join(f"gdf_{compression}.parquet")
+
+    rng = np.random.default_rng(seed=0)
+    nrows = 200000
+    expect = pd.DataFrame(
+        {
+            "repeated": np.tile(np.arange(100, dtype="int64"), nrows // 100),
+            "random": rng.integers(0, 2**62, nrows, dtype="int64"),
+            "float": rng.random(nrows),
+            "string": rng.choice(["hello", "world", "cudf", ""], nrows),
+        }
+    )
+    cudf.from_pandas(expect).to_parquet(
+        fname.strpath, compression=compression, row_group_size_rows=50000
+    )
+
+    got = pq.read_table(fname).to_pandas()
+
+    assert_eq(expect, got)
+
+
 def test_multifile_parquet_folder(tmpdir):
 
     test_pdf1 = make_pdf(nrows=10, nvalids=10 // 2)